@@ -5,6 +5,14 @@
 // --- Includes Section ---
 #include <stdio.h>
 #include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include "../common/slab.h"  // Shared fixed-size node allocator
+#include "../common/stats.h"  // Opt-in hot-path counters (compiled out by default)
+#include "../common/snapshot.h"  // mmap-able on-disk snapshots
+#include "../common/ingest.h"  // Streaming int loader for text and binary files
+#include "../common/dump.h"  // Buffered output writer
+#include "../common/hash_index.h"  // Open-addressing hash table for O(1) find
 
 // Doubly Linked List: Each node contains data, a pointer to the next node, and a pointer
 // to the previous node, allowing bidirectional traversal.
@@ -16,55 +24,170 @@ typedef struct Node {
     struct Node *prev;      // Pointer to the previous node
 } Node;
 
+// The list handle keeps the tail and the length next to the head. Appending is O(1),
+// bounds are checked without a traversal, and indexed access walks from the nearer end.
+typedef struct List {
+    Node *head;             // First node of the list (NULL when empty)
+    Node *tail;             // Last node of the list (NULL when empty)
+    int length;             // Number of nodes in the list
+} List;
+
+// Indexed mode: skip-list express lanes above the prev/next chain. Each lane jumps to a
+// node further right and stores how many list steps the jump covers (its span), so an
+// index is reached by adding spans from the top lane down instead of counting nodes.
+// A node gets an express lane on level l + 1 with probability 1/4 if it has one on
+// level l, so each level skips about 4x further than the one below it.
+#define SKIP_MAX_LEVEL 16   // 4^16 > INT_MAX, enough levels for any int length
+
+typedef struct SkipLane {
+    struct SkipLane *right; // Next lane on the same level (NULL at the end)
+    struct SkipLane *down;  // Lane of the same node one level lower (NULL on level 0)
+    Node *node;             // List node this lane stands on (NULL for the head lanes)
+    int span;               // List steps to `right`, or to one past the tail when right is NULL
+} SkipLane;
+
+// The indexed list owns a plain List and keeps the lanes in sync with it. Read it with the
+// plain functions (print_list_forward(&il.list), find, ...), but change it only through the
+// indexed_ functions while the index is attached.
+typedef struct IndexedList {
+    List list;                         // The ordinary doubly linked list
+    SkipLane *head[SKIP_MAX_LEVEL];    // Head lane of each level, standing before index 0
+    int levels;                        // Number of express levels in use
+    uint64_t seed;                     // State of the level generator
+} IndexedList;
+
+// Hashed mode: a hash index next to the list maps each distinct value to its count and the
+// first node holding it, so find's O(n) walk becomes an O(1) lookup. Like the indexed list,
+// the hashed list owns a plain List: read it with the plain functions, but change it only
+// through the hashed_ functions while the index is attached.
+typedef struct HashedList {
+    List list;                         // The ordinary doubly linked list
+    HashIndex index;                   // value -> {count, first node}
+} HashedList;
+
+// One node in a list snapshot file. Links are record indexes instead of pointers, so they
+// are valid wherever the file is mapped. save_list writes the nodes in list order, so
+// record i is also element i.
+typedef struct ListRecord {
+    int32_t data;
+    uint32_t prev;          // Record index of the previous node, or SNAPSHOT_NIL
+    uint32_t next;          // Record index of the next node, or SNAPSHOT_NIL
+} ListRecord;
+
+#define SORT_LIST_SLOTS 32  // Sorted chains of 2^0 .. 2^31 nodes cover any int length
+
+// --- Node Pool ---
+// All nodes are carved from this slab pool instead of one malloc per node.
+// Deleted nodes go back on the pool's free list, and main releases the whole arena at once.
+static SlabPool node_pool = SLAB_POOL_INIT(sizeof(Node));
+static SlabPool lane_pool = SLAB_POOL_INIT(sizeof(SkipLane));
+
 // --- Function Declarations ---
 Node* create_node(int data);
-void append(Node **head, int data);
-void insert_at(Node **head, int index, int data);
-void delete_at(Node **head, int index);
-Node* find(Node *head, int data);
-void update_at(Node *head, int index, int new_data);
-void print_list_forward(Node *head);
-void print_list_backward(Node *head);
+void init_list(List *list);
+Node* node_at(const List *list, int index);
+void append(List *list, int data);
+void insert_at(List *list, int index, int data);
+void delete_at(List *list, int index);
+Node* find(const List *list, int data);
+void update_at(List *list, int index, int new_data);
+void print_list_forward(const List *list);
+void print_list_backward(const List *list);
 void exercise_solution();
-void free_list(Node **head);
+void free_list(List *list);
+void indexed_init(IndexedList *il);
+void indexed_attach(IndexedList *il, List *list);
+void indexed_detach(IndexedList *il, List *list);
+Node* indexed_node_at(const IndexedList *il, int index);
+void indexed_append(IndexedList *il, int data);
+void indexed_insert_at(IndexedList *il, int index, int data);
+void indexed_delete_at(IndexedList *il, int index);
+void indexed_update_at(IndexedList *il, int index, int new_data);
+Node* indexed_lower_bound(const IndexedList *il, int data, int *index);
+Node* indexed_find_sorted(const IndexedList *il, int data);
+void indexed_insert_sorted(IndexedList *il, int data);
+void indexed_free(IndexedList *il);
+int save_list(const List *list, const char *path);
+int open_list_snapshot(SnapshotView *view, const char *path, int verify);
+const ListRecord* list_snapshot_at(const SnapshotView *view, int index);
+int list_snapshot_find(const SnapshotView *view, int data);
+void load_list(List *list, const SnapshotView *view);
+void append_many(List *list, const int *values, int count);
+void insert_many(List *list, int index, const int *values, int count);
+int ingest_list(List *list, const char *path, int format);
+void dump_list(const List *list, DumpWriter *out);
+void hashed_list_init(HashedList *hl);
+void hashed_list_attach(HashedList *hl, List *list);
+void hashed_list_detach(HashedList *hl, List *list);
+void hashed_append(HashedList *hl, int data);
+void hashed_insert_at(HashedList *hl, int index, int data);
+void hashed_delete_at(HashedList *hl, int index);
+void hashed_update_at(HashedList *hl, int index, int new_data);
+Node* hashed_find(const HashedList *hl, int data);
+void hashed_list_free(HashedList *hl);
+void list_stats(const List *list, DsStats *stats);
+void sort_list(List *list);
 
 // --- Main Function ---
-int main() {
+// Benchmarks include this file with DS_NO_MAIN defined to reuse the list operations.
+#ifndef DS_NO_MAIN
+int main(int argc, char *argv[]) {
+    // Bulk Load: O(n)
+    // Given a file ("-" for stdin), the program loads it instead of running the demo:
+    //   ./DDL_first numbers.txt          decimal ints separated by whitespace or commas
+    //   ./DDL_first numbers.bin --binary raw 32-bit ints
+    if (argc > 1) {
+        List loaded;
+        init_list(&loaded);
+        int format = argc > 2 && strcmp(argv[2], "--binary") == 0 ? INGEST_BINARY : INGEST_TEXT;
+        int status = ingest_list(&loaded, argv[1], format) < 0 ? 1 : 0;
+        if (status == 0 && loaded.length > 0) {
+            printf("Loaded %d elements from %s (first %d, last %d).\n", loaded.length, argv[1],
+                   loaded.head->data, loaded.tail->data);
+        } else if (status == 0) {
+            printf("Loaded 0 elements from %s.\n", argv[1]);
+        }
+        free_list(&loaded);
+        slab_destroy(&node_pool);
+        return status;
+    }
+
     // Doubly Linked List Initialization: O(1)
     // We'll start with an empty list.
-    Node *head = NULL;  // Initialize an empty list
+    List list;
+    init_list(&list);  // Initialize an empty list
 
-    // 1. Append Operation: O(n)
+    // 1. Append Operation: O(1)
     // Append elements to the list
-    append(&head, 10);  // Append 10 to the list
-    append(&head, 20);  // Append 20
-    append(&head, 30);  // Append 30
-    append(&head, 40);  // Append 40
-    append(&head, 50);  // Append 50
+    append(&list, 10);  // Append 10 to the list
+    append(&list, 20);  // Append 20
+    append(&list, 30);  // Append 30
+    append(&list, 40);  // Append 40
+    append(&list, 50);  // Append 50
 
     // Print the initial list in forward and backward direction
     printf("Initial Doubly Linked List (Forward):\n");
-    print_list_forward(head);
+    print_list_forward(&list);
 
     printf("Initial Doubly Linked List (Backward):\n");
-    print_list_backward(head);
+    print_list_backward(&list);
 
     // 2. Insert Operation: O(n)
     // Insert a new element at index 2
     printf("\nInserting 25 at index 2:\n");
-    insert_at(&head, 2, 25);  // Insert 25 at index 2
-    print_list_forward(head);  // Print after insertion
+    insert_at(&list, 2, 25);  // Insert 25 at index 2
+    print_list_forward(&list);  // Print after insertion
 
     // 3. Delete Operation: O(n)
     // Delete the element at index 4
     printf("\nDeleting element at index 4:\n");
-    delete_at(&head, 4);  // Delete element at index 4
-    print_list_forward(head);  // Print after deletion
+    delete_at(&list, 4);  // Delete element at index 4
+    print_list_forward(&list);  // Print after deletion
 
     // 4. Find Operation: O(n)
     // Find if element 40 exists in the list
     printf("\nFinding element 40 in the list:\n");
-    Node *found_node = find(head, 40);  // Find element 40
+    Node *found_node = find(&list, 40);  // Find element 40
     if (found_node != NULL) {
         printf("Element 40 found in the list.\n");
     } else {
@@ -74,149 +197,258 @@ int main() {
     // 5. Update Operation: O(n)
     // Update the element at index 3 to 99
     printf("\nUpdating element at index 3 to 99:\n");
-    update_at(head, 3, 99);  // Update index 3 to 99
-    print_list_forward(head);  // Print after update
+    update_at(&list, 3, 99);  // Update index 3 to 99
+    print_list_forward(&list);  // Print after update
+
+    // 6. Batched Insert: O(k) at either end
+    // A batch is linked into a chain first and spliced in with one walk to the index.
+    printf("\nAppending 60, 70 and inserting 1, 2, 3 at index 1:\n");
+    int more[2] = {60, 70};
+    int middle[3] = {1, 2, 3};
+    append_many(&list, more, 2);
+    insert_many(&list, 1, middle, 3);
+    print_list_forward(&list);
+
+    // 7. Indexed Mode: O(log n) expected
+    // Hand the list to an index, then access it by position and, since it is kept sorted
+    // here, by value.
+    printf("\nIndexed mode over a sorted list:\n");
+    IndexedList il;
+    indexed_init(&il);
+    free_list(&list);
+    for (int i = 1; i <= 10; i++) {
+        append(&list, i * 10);
+    }
+    indexed_attach(&il, &list);  // O(n), the list moves into the index
+    indexed_insert_sorted(&il, 35);
+    indexed_insert_sorted(&il, 5);
+    indexed_delete_at(&il, 3);
+    print_list_forward(&il.list);
+    printf("Element at index 4: %d\n", indexed_node_at(&il, 4)->data);
+    int position;
+    Node *ge = indexed_lower_bound(&il, 62, &position);
+    printf("First element >= 62: %d at index %d\n", ge->data, position);
+    printf("Element 35 %s\n", indexed_find_sorted(&il, 35) != NULL ? "found." : "not found.");
+    indexed_detach(&il, &list);  // Back to a plain list, the lanes are freed
+
+    // 8. Snapshots: save O(n), open O(1), element at index O(1) on the file
+    // The list is saved to a file, read in place through the mapping, then loaded.
+    printf("\nSaving the list to list.snap:\n");
+    SnapshotView view;
+    if (save_list(&list, "list.snap") == 0 && open_list_snapshot(&view, "list.snap", 1) == 0) {
+        printf("%llu nodes on disk, element at index 4: %d, 90 at index %d\n",
+               (unsigned long long)view.header->count, list_snapshot_at(&view, 4)->data,
+               list_snapshot_find(&view, 90));
+        List loaded;
+        load_list(&loaded, &view);
+        printf("Loaded list (Backward):\n");
+        print_list_backward(&loaded);
+        free_list(&loaded);
+        snapshot_close(&view);
+        remove("list.snap");
+    }
+
+    // 9. Hashed Mode: find in O(1) expected
+    // A hash index remembers the first node of every value; the hashed_ functions keep it
+    // in sync as nodes come and go.
+    printf("\nHashed mode: insert 70 at index 0, delete it again, update index 0 to 15:\n");
+    HashedList hl;
+    hashed_list_init(&hl);
+    hashed_list_attach(&hl, &list);  // O(n), the list moves into the hashed list
+    hashed_insert_at(&hl, 0, 70);
+    printf("First 70 is %s\n", hashed_find(&hl, 70) == hl.list.head ? "the head." : "not the head.");
+    hashed_delete_at(&hl, 0);
+    hashed_update_at(&hl, 0, 15);
+    print_list_forward(&hl.list);
+    printf("First 70 is %s, 10 %s\n", hashed_find(&hl, 70) == node_at(&hl.list, 7) ? "at index 7" : "elsewhere",
+           hashed_find(&hl, 10) != NULL ? "found." : "not found.");
+    hashed_list_detach(&hl, &list);  // Back to a plain list, the index is freed
+
+    // 10. Sort: O(n log n)
+    // The nodes are relinked in ascending order, prev links included; none is copied.
+    printf("\nSorting the list:\n");
+    sort_list(&list);
+    print_list_forward(&list);
+    print_list_backward(&list);
+
+#ifdef DS_STATS
+    // 11. Instrumentation: built with -DDS_STATS (and -DDS_STATS_PERF for hardware counters)
+    // A missed find walks every node; an update near the tail walks back from it.
+    printf("\nCounters for a missed find and an update at index 8:\n");
+    DsStats stats;
+    ds_stats_reset();
+    find(&list, 1000);
+    update_at(&list, 8, 95);
+    list_stats(&list, &stats);
+    ds_stats_print(&stats);
+#endif
 
     // --- Exercise Demonstration ---
     printf("\n--- Exercise Solution ---\n");
     exercise_solution();
 
     // Free the list memory
-    free_list(&head);
+    free_list(&list);
+
+    // Give every slab block back to malloc in one pass
+    slab_destroy(&node_pool);
+    slab_destroy(&lane_pool);
 
     return 0;
 }
+#endif // DS_NO_MAIN
 
 // --- Doubly Linked List Operations ---
 
 // 1. Create Node: O(1)
 // This function creates a new node with the given data.
+// The node comes from the slab pool, which exits on allocation failure.
 // Time complexity: O(1), since creating a node takes constant time.
 Node* create_node(int data) {
-    Node *new_node = (Node*)malloc(sizeof(Node));  // Allocate memory for a new node
-    if (!new_node) {
-        printf("Memory allocation error!\n");
-        exit(1);  // Exit if memory allocation fails
-    }
+    Node *new_node = (Node*)slab_alloc(&node_pool);  // Take a slot from the node pool
     new_node->data = data;  // Assign data
     new_node->next = NULL;  // Initialize the next pointer to NULL
     new_node->prev = NULL;  // Initialize the previous pointer to NULL
     return new_node;  // Return the new node
 }
 
-// 2. Append Operation: O(n)
-// Appending an element to the end of the list requires traversing to the end.
-// Time complexity: O(n), where n is the number of nodes in the list.
-void append(Node **head, int data) {
-    Node *new_node = create_node(data);  // Create a new node
+// 2. Init List: O(1)
+// This function sets up an empty list handle.
+// Time complexity: O(1).
+void init_list(List *list) {
+    list->head = NULL;
+    list->tail = NULL;
+    list->length = 0;
+}
 
-    // If the list is empty, make the new node the head
-    if (*head == NULL) {
-        *head = new_node;
-        return;
+// 3. Node at Index: O(n)
+// Returns the node at a valid index. Because the list can be walked both ways,
+// it starts from whichever end is closer, so at most length / 2 steps are taken.
+// The caller must check 0 <= index < length first.
+// Time complexity: O(min(index, n - index)).
+Node* node_at(const List *list, int index) {
+    Node *temp;
+    if (index < list->length / 2) {
+        temp = list->head;
+        STAT_VISIT(index + 1);
+        for (int i = 0; i < index; i++) {
+            temp = temp->next;
+        }
+    } else {
+        temp = list->tail;
+        STAT_VISIT(list->length - index);
+        for (int i = list->length - 1; i > index; i--) {
+            temp = temp->prev;
+        }
     }
+    return temp;
+}
 
-    // Traverse to the end of the list
-    Node *temp = *head;
-    while (temp->next != NULL) {
-        temp = temp->next;
+// Links `node` right before `next`, or after the tail when next is NULL.
+static void link_before(List *list, Node *next, Node *node) {
+    node->next = next;
+    node->prev = next != NULL ? next->prev : list->tail;
+    if (node->prev != NULL) {
+        node->prev->next = node;
+    } else {
+        list->head = node;  // Inserting before the first node
+    }
+    if (next != NULL) {
+        next->prev = node;
+    } else {
+        list->tail = node;  // Inserting after the last node
+    }
+    list->length++;
+}
+
+// Unlinks `node` from the list without freeing it.
+static void unlink_node(List *list, Node *node) {
+    if (node->next != NULL) {
+        node->next->prev = node->prev;
+    } else {
+        list->tail = node->prev;  // Removing the last node
+    }
+    if (node->prev != NULL) {
+        node->prev->next = node->next;
+    } else {
+        list->head = node->next;  // Removing the first node
     }
+    list->length--;
+}
+
+// 4. Append Operation: O(1)
+// The handle remembers the last node, so appending just links after the tail.
+// Time complexity: O(1), no traversal is needed.
+void append(List *list, int data) {
+    Node *new_node = create_node(data);  // Create a new node
 
-    // Append the new node at the end
-    temp->next = new_node;
-    new_node->prev = temp;
+    // Link after the current last node (an empty list gets a new head and tail)
+    link_before(list, NULL, new_node);
 }
 
-// 3. Insert at Index: O(n)
+// 5. Insert at Index: O(n)
 // Inserting an element at a specific index requires traversing to that index.
+// Indexes 0 and length are handled in O(1).
 // Time complexity: O(n), where n is the number of nodes in the list.
-void insert_at(Node **head, int index, int data) {
-    Node *new_node = create_node(data);
-
-    // If inserting at the head (index 0)
-    if (index == 0) {
-        new_node->next = *head;
-        if (*head != NULL) {
-            (*head)->prev = new_node;
-        }
-        *head = new_node;
+void insert_at(List *list, int index, int data) {
+    // Check the bounds against the stored length instead of walking the list
+    if (index < 0 || index > list->length) {
+        printf("Error: Index out of bounds.\n");
         return;
     }
 
-    // Traverse to the node before the insertion point
-    Node *temp = *head;
-    for (int i = 0; i < index - 1 && temp != NULL; i++) {
-        temp = temp->next;
-    }
-
-    // If index is out of bounds
-    if (temp == NULL) {
-        printf("Error: Index out of bounds.\n");
-        free(new_node);  // Free the allocated memory for the new node
+    // Inserting at the end is an append
+    if (index == list->length) {
+        append(list, data);
         return;
     }
 
-    // Insert the new node at the index
-    new_node->next = temp->next;
-    new_node->prev = temp;
+    Node *new_node = create_node(data);
 
-    if (temp->next != NULL) {
-        temp->next->prev = new_node;
+    // If inserting at the head (index 0)
+    if (index == 0) {
+        link_before(list, list->head, new_node);
+        return;
     }
-    temp->next = new_node;
+
+    // Find the node currently at the index; the new node goes right before it
+    link_before(list, node_at(list, index), new_node);
 }
 
-// 4. Delete at Index: O(n)
+// 6. Delete at Index: O(n)
 // Deleting an element from a specific index requires traversing to that index.
+// Deleting the head or the tail is O(1).
 // Time complexity: O(n), where n is the number of nodes in the list.
-void delete_at(Node **head, int index) {
+void delete_at(List *list, int index) {
     // If the list is empty
-    if (*head == NULL) {
+    if (list->head == NULL) {
         printf("Error: List is empty.\n");
         return;
     }
 
-    Node *temp = *head;
-
-    // If deleting the head (index 0)
-    if (index == 0) {
-        *head = temp->next;
-        if (*head != NULL) {
-            (*head)->prev = NULL;
-        }
-        free(temp);  // Free the old head node
-        return;
-    }
-
-    // Traverse to the node at the given index
-    for (int i = 0; i < index && temp != NULL; i++) {
-        temp = temp->next;
-    }
-
     // If index is out of bounds
-    if (temp == NULL) {
+    if (index < 0 || index >= list->length) {
         printf("Error: Index out of bounds.\n");
         return;
     }
 
+    // Traverse to the node at the given index
+    Node *temp = node_at(list, index);
+
     // Update the pointers to remove the node
-    if (temp->next != NULL) {
-        temp->next->prev = temp->prev;
-    }
-    if (temp->prev != NULL) {
-        temp->prev->next = temp->next;
-    }
+    unlink_node(list, temp);
 
     // Free the memory of the deleted node
-    free(temp);
+    slab_free(&node_pool, temp);
 }
 
-// 5. Find Element: O(n)
+// 7. Find Element: O(n)
 // Finding an element in a doubly linked list requires traversing the list.
 // Time complexity: O(n), where n is the number of nodes in the list.
-Node* find(Node *head, int data) {
-    Node *temp = head;
+Node* find(const List *list, int data) {
+    Node *temp = list->head;
     while (temp != NULL) {
+        STAT_VISIT(1);
         if (temp->data == data) {
             return temp;  // Return the node if found
         }
@@ -225,69 +457,849 @@ Node* find(Node *head, int data) {
     return NULL;  // Return NULL if the element is not found
 }
 
-// 6. Update Element at Index: O(n)
+// 8. Update Element at Index: O(n)
 // Updating an element at a specific index requires traversing to that index.
 // Time complexity: O(n), where n is the number of nodes in the list.
-void update_at(Node *head, int index, int new_data) {
-    Node *temp = head;
-
-    // Traverse to the node at the index
-    for (int i = 0; i < index && temp != NULL; i++) {
-        temp = temp->next;
-    }
-
+void update_at(List *list, int index, int new_data) {
     // If index is out of bounds
-    if (temp == NULL) {
+    if (index < 0 || index >= list->length) {
         printf("Error: Index out of bounds.\n");
         return;
     }
 
-    // Update the node's data
-    temp->data = new_data;
+    // Traverse to the node at the index and update its data
+    node_at(list, index)->data = new_data;
 }
 
-// 7. Print List Forward: O(n)
+// 9. Print List Forward: O(n)
 // This function prints the contents of the list in forward direction.
+// The text goes through the shared stdout writer (see common/dump.h), so printing a long
+// list costs one write(2) per MiB instead of one printf per node.
 // Time complexity: O(n), where n is the number of nodes in the list.
-void print_list_forward(Node *head) {
-    Node *temp = head;
+void print_list_forward(const List *list) {
+    DumpWriter *out = dump_stdout();
+    Node *temp = list->head;
     while (temp != NULL) {
-        printf("%d -> ", temp->data);  // Print the data
+        dump_int(out, temp->data);  // Print the data
+        dump_text(out, " -> ");
         temp = temp->next;
     }
-    printf("NULL\n");
+    dump_text(out, "NULL\n");
+    dump_flush(out);
 }
 
-// 8. Print List Backward: O(n)
+// 10. Print List Backward: O(n)
 // This function prints the contents of the list in backward direction.
+// It starts from the stored tail, so there is no walk to the end first.
 // Time complexity: O(n), where n is the number of nodes in the list.
-void print_list_backward(Node *head) {
-    if (head == NULL) return;
-
-    // Traverse to the end of the list
-    Node *temp = head;
-    while (temp->next != NULL) {
-        temp = temp->next;
-    }
+void print_list_backward(const List *list) {
+    if (list->tail == NULL) return;
 
     // Print in reverse
+    DumpWriter *out = dump_stdout();
+    Node *temp = list->tail;
     while (temp != NULL) {
-        printf("%d -> ", temp->data);
+        dump_int(out, temp->data);
+        dump_text(out, " -> ");
         temp = temp->prev;
     }
-    printf("NULL\n");
+    dump_text(out, "NULL\n");
+    dump_flush(out);
 }
 
-// 9. Free List: O(n)
-// This function frees all the memory allocated for the linked list.
+// 11. Free List: O(n)
+// This function returns every node of the list to the pool's free list and empties the handle.
+// To release the memory itself, call slab_destroy(&node_pool) once all lists are done.
 // Time complexity: O(n), where n is the number of nodes in the list.
-void free_list(Node **head) {
+void free_list(List *list) {
     Node *temp;
-    while (*head != NULL) {
-        temp = *head;
-        *head = (*head)->next;
-        free(temp);
+    while (list->head != NULL) {
+        temp = list->head;
+        list->head = list->head->next;
+        slab_free(&node_pool, temp);
+    }
+    init_list(list);
+}
+
+// --- Indexed Mode (Skip List) ---
+
+// Takes a lane slot from the lane pool.
+static SkipLane* create_lane(Node *node, SkipLane *down, int span) {
+    SkipLane *lane = (SkipLane*)slab_alloc(&lane_pool);
+    lane->right = NULL;
+    lane->down = down;
+    lane->node = node;
+    lane->span = span;
+    return lane;
+}
+
+// Picks how many express lanes a new node gets: 0 with probability 3/4, 1 with 3/16, ...
+// Each pair of random bits that is 00 promotes the node one more level.
+static int random_level(IndexedList *il) {
+    uint64_t x = il->seed;  // xorshift64
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    il->seed = x;
+    int level = 0;
+    while ((x & 3) == 0 && level < SKIP_MAX_LEVEL) {
+        level++;
+        x >>= 2;
+    }
+    return level;
+}
+
+// Adds empty head lanes until there are `level` levels. A new head lane spans the whole list.
+static void grow_levels(IndexedList *il, int level) {
+    while (il->levels < level) {
+        SkipLane *down = il->levels > 0 ? il->head[il->levels - 1] : NULL;
+        il->head[il->levels] = create_lane(NULL, down, il->list.length + 1);
+        il->levels++;
+    }
+}
+
+// Returns every lane to the lane pool; the list itself is untouched.
+static void free_lanes(IndexedList *il) {
+    for (int l = 0; l < il->levels; l++) {
+        SkipLane *lane = il->head[l];
+        while (lane != NULL) {
+            SkipLane *right = lane->right;
+            slab_free(&lane_pool, lane);
+            lane = right;
+        }
+    }
+    il->levels = 0;
+}
+
+// Walks the lanes from the top level down. On every level it stops at the last lane
+// standing before `index`, and stores that lane in update[l] and its list position in
+// rank[l] (-1 for a head lane). Requires il->levels > 0.
+static void skip_descend(const IndexedList *il, int index, SkipLane **update, int *rank) {
+    SkipLane *lane = il->head[il->levels - 1];
+    int pos = -1;
+    for (int l = il->levels - 1; l >= 0; l--) {
+        while (lane->right != NULL && pos + lane->span < index) {
+            STAT_VISIT(1);
+            pos += lane->span;
+            lane = lane->right;
+        }
+        update[l] = lane;
+        rank[l] = pos;
+        lane = lane->down;
+    }
+}
+
+// Returns the node at `index` (NULL when index == length), walking the list from the
+// level 0 lane at position pos < index. Lanes are about 4 nodes apart, so this is short.
+static Node* skip_walk(const IndexedList *il, const SkipLane *lane, int pos, int index) {
+    Node *node = lane->node != NULL ? lane->node->next : il->list.head;
+    STAT_VISIT(index - pos);
+    for (pos++; pos < index; pos++) {
+        node = node->next;
+    }
+    return node;
+}
+
+// 12. Init Indexed List: O(1)
+// This function sets up an empty indexed list with no express lanes yet.
+// Time complexity: O(1).
+void indexed_init(IndexedList *il) {
+    init_list(&il->list);
+    il->levels = 0;
+    il->seed = 0x9E3779B97F4A7C15ull;  // Any non-zero seed works
+}
+
+// 13. Attach: O(n)
+// Moves an existing plain list into the index (the caller's handle is left empty) and builds
+// the lanes in one left-to-right pass, remembering the last lane of every level.
+// Time complexity: O(n).
+void indexed_attach(IndexedList *il, List *list) {
+    indexed_free(il);
+    il->list = *list;
+    init_list(list);
+
+    SkipLane *last[SKIP_MAX_LEVEL];
+    int last_pos[SKIP_MAX_LEVEL];
+    int pos = 0;
+    for (Node *node = il->list.head; node != NULL; node = node->next, pos++) {
+        int level = random_level(il);
+        for (int l = il->levels; l < level; l++) {
+            grow_levels(il, l + 1);
+            last[l] = il->head[l];
+            last_pos[l] = -1;
+        }
+        SkipLane *down = NULL;
+        for (int l = 0; l < level; l++) {
+            SkipLane *lane = create_lane(node, down, 0);
+            last[l]->right = lane;
+            last[l]->span = pos - last_pos[l];
+            last[l] = lane;
+            last_pos[l] = pos;
+            down = lane;
+        }
+    }
+    // The last lane of every level spans to one past the tail
+    for (int l = 0; l < il->levels; l++) {
+        last[l]->span = il->list.length - last_pos[l];
+    }
+}
+
+// 14. Detach: O(n)
+// Frees the lanes and hands the plain list back to the caller, leaving the index empty.
+// Time complexity: O(n / 3), the number of lanes.
+void indexed_detach(IndexedList *il, List *list) {
+    free_lanes(il);
+    *list = il->list;
+    init_list(&il->list);
+}
+
+// 15. Node at Index: O(log n) expected
+// Adds spans from the top level down, stopping early if a lane lands exactly on the index.
+// The caller must check 0 <= index < length first.
+// Time complexity: O(log n) expected, against O(n) for node_at.
+Node* indexed_node_at(const IndexedList *il, int index) {
+    if (il->levels == 0) {
+        return node_at(&il->list, index);
+    }
+    const SkipLane *lane = il->head[il->levels - 1];
+    int pos = -1;
+    for (;;) {
+        while (lane->right != NULL && pos + lane->span <= index) {
+            STAT_VISIT(1);
+            pos += lane->span;
+            lane = lane->right;
+        }
+        if (pos == index) {
+            return lane->node;
+        }
+        if (lane->down == NULL) {
+            return skip_walk(il, lane, pos, index);
+        }
+        lane = lane->down;
+    }
+}
+
+// 16. Append Operation: O(log n) expected
+// Time complexity: O(log n) expected, since the last lane of every level has to be updated.
+void indexed_append(IndexedList *il, int data) {
+    indexed_insert_at(il, il->list.length, data);
+}
+
+// 17. Insert at Index: O(log n) expected
+// Finds the lane before the index on every level, links the node into the list, and gives
+// it a random number of lanes. A lane that now jumps over the new node grows its span by 1;
+// a lane that the new node's lane cuts in two shares its span with it.
+// Time complexity: O(log n) expected.
+void indexed_insert_at(IndexedList *il, int index, int data) {
+    // Check the bounds against the stored length
+    if (index < 0 || index > il->list.length) {
+        printf("Error: Index out of bounds.\n");
+        return;
+    }
+
+    int level = random_level(il);
+    grow_levels(il, level);
+
+    Node *node = create_node(data);
+    if (il->levels == 0) {
+        link_before(&il->list, index < il->list.length ? node_at(&il->list, index) : NULL, node);
+        return;
+    }
+
+    SkipLane *update[SKIP_MAX_LEVEL];
+    int rank[SKIP_MAX_LEVEL];
+    skip_descend(il, index, update, rank);
+    link_before(&il->list, skip_walk(il, update[0], rank[0], index), node);
+
+    SkipLane *down = NULL;
+    for (int l = 0; l < il->levels; l++) {
+        if (l < level) {
+            // Split update[l]'s jump at the new node; the far end moved one step right
+            SkipLane *lane = create_lane(node, down, rank[l] + update[l]->span + 1 - index);
+            lane->right = update[l]->right;
+            update[l]->right = lane;
+            update[l]->span = index - rank[l];
+            down = lane;
+        } else {
+            update[l]->span++;  // The jump now passes over one more node
+        }
+    }
+}
+
+// 18. Delete at Index: O(log n) expected
+// Unlinks the node's lanes (their spans merge into the lane before them), shortens every
+// other jump that passed over it, then removes the node from the list. Empty top levels
+// are dropped.
+// Time complexity: O(log n) expected.
+void indexed_delete_at(IndexedList *il, int index) {
+    // If the list is empty
+    if (il->list.head == NULL) {
+        printf("Error: List is empty.\n");
+        return;
+    }
+
+    // If index is out of bounds
+    if (index < 0 || index >= il->list.length) {
+        printf("Error: Index out of bounds.\n");
+        return;
+    }
+
+    Node *node;
+    if (il->levels == 0) {
+        node = node_at(&il->list, index);
+    } else {
+        SkipLane *update[SKIP_MAX_LEVEL];
+        int rank[SKIP_MAX_LEVEL];
+        skip_descend(il, index, update, rank);
+        node = skip_walk(il, update[0], rank[0], index);
+
+        for (int l = 0; l < il->levels; l++) {
+            SkipLane *lane = update[l]->right;
+            if (lane != NULL && lane->node == node) {
+                update[l]->span += lane->span - 1;
+                update[l]->right = lane->right;
+                slab_free(&lane_pool, lane);
+            } else {
+                update[l]->span--;
+            }
+        }
+        while (il->levels > 0 && il->head[il->levels - 1]->right == NULL) {
+            il->levels--;
+            slab_free(&lane_pool, il->head[il->levels]);
+        }
+    }
+
+    unlink_node(&il->list, node);
+    slab_free(&node_pool, node);
+}
+
+// 19. Update Element at Index: O(log n) expected
+// Positions do not change, so the lanes stay as they are. In a sorted list the new value
+// must keep the order for the value searches below to stay correct.
+// Time complexity: O(log n) expected.
+void indexed_update_at(IndexedList *il, int index, int new_data) {
+    // If index is out of bounds
+    if (index < 0 || index >= il->list.length) {
+        printf("Error: Index out of bounds.\n");
+        return;
+    }
+    indexed_node_at(il, index)->data = new_data;
+}
+
+// 20. Lower Bound by Value: O(log n) expected
+// For a list sorted in ascending order: returns the first node whose data is >= data
+// (NULL if there is none) and stores its index in *index (length if none), when index
+// is not NULL. Lanes are followed while they land on a smaller value.
+// Time complexity: O(log n) expected.
+Node* indexed_lower_bound(const IndexedList *il, int data, int *index) {
+    Node *node = il->list.head;
+    int pos = 0;
+    if (il->levels > 0) {
+        const SkipLane *lane = il->head[il->levels - 1];
+        int lane_pos = -1;
+        for (;;) {
+            while (lane->right != NULL && lane->right->node->data < data) {
+                STAT_VISIT(1);
+                lane_pos += lane->span;
+                lane = lane->right;
+            }
+            if (lane->down == NULL) {
+                break;
+            }
+            lane = lane->down;
+        }
+        node = lane->node != NULL ? lane->node->next : il->list.head;
+        pos = lane_pos + 1;
+    }
+    while (node != NULL && node->data < data) {
+        STAT_VISIT(1);
+        node = node->next;
+        pos++;
+    }
+    if (index != NULL) {
+        *index = pos;
+    }
+    return node;
+}
+
+// 21. Find in Sorted List: O(log n) expected
+// Returns a node holding data, or NULL. Only valid while the list is sorted.
+// Time complexity: O(log n) expected, against O(n) for find.
+Node* indexed_find_sorted(const IndexedList *il, int data) {
+    Node *node = indexed_lower_bound(il, data, NULL);
+    return node != NULL && node->data == data ? node : NULL;
+}
+
+// 22. Insert into Sorted List: O(log n) expected
+// Inserts data before the first element that is >= data, keeping the list sorted.
+// Time complexity: O(log n) expected (two descents).
+void indexed_insert_sorted(IndexedList *il, int data) {
+    int index;
+    indexed_lower_bound(il, data, &index);
+    indexed_insert_at(il, index, data);
+}
+
+// 23. Free Indexed List: O(n)
+// Returns the lanes and the list nodes to their pools and leaves an empty indexed list.
+// Time complexity: O(n).
+void indexed_free(IndexedList *il) {
+    free_lanes(il);
+    free_list(&il->list);
+}
+
+// --- Snapshot Operations ---
+// A list snapshot (see common/snapshot.h) stores one ListRecord per node, in list order.
+// The mapped file can be read in place, or loaded back into nodes with one pass.
+
+// 24. Save List: O(n)
+// This function writes the list to path, head to tail.
+// Returns 0, or -1 (with an error message) if the file cannot be written.
+// Time complexity: O(n), where n is the number of nodes in the list.
+int save_list(const List *list, const char *path) {
+    SnapshotWriter writer;
+    if (snapshot_create(&writer, path, SNAPSHOT_LIST, sizeof(ListRecord)) != 0) {
+        return -1;
+    }
+    uint32_t index = 0;
+    for (Node *temp = list->head; temp != NULL; temp = temp->next, index++) {
+        ListRecord record;
+        record.data = temp->data;
+        record.prev = temp->prev != NULL ? index - 1 : SNAPSHOT_NIL;
+        record.next = temp->next != NULL ? index + 1 : SNAPSHOT_NIL;
+        snapshot_put(&writer, &record);
+    }
+    return snapshot_finish(&writer, index > 0 ? 0 : SNAPSHOT_NIL, index > 0 ? index - 1 : SNAPSHOT_NIL);
+}
+
+// 25. Open List Snapshot: O(1), or O(n) with verify
+// This function maps a list snapshot read-only (see snapshot_open).
+// Returns 0, or -1 (with an error message) if the file is missing or not a list snapshot.
+// Time complexity: O(1) without verify; nothing is allocated or rebuilt.
+int open_list_snapshot(SnapshotView *view, const char *path, int verify) {
+    return snapshot_open(view, path, SNAPSHOT_LIST, sizeof(ListRecord), verify);
+}
+
+// 26. Snapshot Element at Index: O(1)
+// This function returns the record of element index, which is record index in the file.
+// Returns NULL (with an error message) if the index is out of bounds.
+// Time complexity: O(1), against O(n) for node_at on the live list.
+const ListRecord* list_snapshot_at(const SnapshotView *view, int index) {
+    if (index < 0 || (uint64_t)index >= view->header->count) {
+        printf("Error: Index out of bounds.\n");
+        return NULL;
+    }
+    return &((const ListRecord*)view->records)[index];
+}
+
+// 27. Snapshot Find: O(n)
+// This function follows the next links through the mapped records, like find does.
+// Returns the index of the first element equal to data, or -1 if there is none. Every
+// index is checked against the record count and the walk takes at most count steps, so a
+// damaged file opened without verify gives an error message instead of a bad read or an
+// endless loop.
+// Time complexity: O(n).
+int list_snapshot_find(const SnapshotView *view, int data) {
+    const ListRecord *records = (const ListRecord*)view->records;
+    uint64_t count = view->header->count;
+    int position = 0;
+    for (uint64_t index = view->header->root; index != SNAPSHOT_NIL; index = records[index].next) {
+        if (index >= count || (uint64_t)position >= count) {
+            printf("Error: Snapshot is corrupted (bad record index).\n");
+            return -1;
+        }
+        if (records[index].data == data) {
+            return position;
+        }
+        position++;
+    }
+    return -1;
+}
+
+// 28. Load List: O(n)
+// This function rebuilds an ordinary list from a mapped snapshot. All nodes come from one
+// slab_alloc_array block and the record indexes become pointers into it, so there is one
+// sequential pass and no append per element.
+// The links are checked first, with or without verify: from the first record, next must
+// reach every record exactly once and end at the last one, with prev pointing back at
+// each step. A damaged file, or one with more than INT32_MAX records, gives an error
+// message and leaves the list empty.
+// Time complexity: O(n).
+void load_list(List *list, const SnapshotView *view) {
+    init_list(list);
+    if (view->header->count > (uint64_t)INT32_MAX) {
+        printf("Error: Snapshot has too many elements for a list.\n");
+        return;
+    }
+    size_t count = (size_t)view->header->count;
+    if (count == 0) {
+        return;
+    }
+    const ListRecord *records = (const ListRecord*)view->records;
+    uint64_t prev = SNAPSHOT_NIL;
+    uint64_t index = view->header->root;
+    size_t steps = 0;
+    while (index != SNAPSHOT_NIL && index < count && steps < count && records[index].prev == prev) {
+        prev = index;
+        index = records[index].next;
+        steps++;
+    }
+    if (index != SNAPSHOT_NIL || steps != count || prev != view->header->extra) {
+        printf("Error: Snapshot is corrupted (bad record index).\n");
+        return;
+    }
+    Node *nodes = (Node*)slab_alloc_array(&node_pool, count);
+    for (size_t i = 0; i < count; i++) {
+        nodes[i].data = records[i].data;
+        nodes[i].prev = records[i].prev != SNAPSHOT_NIL ? &nodes[records[i].prev] : NULL;
+        nodes[i].next = records[i].next != SNAPSHOT_NIL ? &nodes[records[i].next] : NULL;
+    }
+    list->head = &nodes[view->header->root];
+    list->tail = &nodes[view->header->extra];
+    list->length = (int)count;
+}
+
+// --- Bulk Operations ---
+// Batched inserts and the streaming loader. A batch is built as a separate chain and
+// spliced into the list once, so the handle and the neighbours are touched once per batch.
+
+// Creates nodes for values[0..count) linked to each other in order, and returns the
+// first one (count must be > 0). *last receives the final node.
+static Node* create_chain(const int *values, int count, Node **last) {
+    Node *first = create_node(values[0]);
+    Node *prev = first;
+    for (int i = 1; i < count; i++) {
+        Node *node = (Node*)slab_alloc(&node_pool);  // create_node without the NULL stores
+        node->data = values[i];
+        node->prev = prev;
+        prev->next = node;
+        prev = node;
+    }
+    prev->next = NULL;
+    *last = prev;
+    return first;
+}
+
+// Links the chain first..last right before `next`, or after the tail when next is NULL.
+static void splice_before(List *list, Node *next, Node *first, Node *last, int count) {
+    first->prev = next != NULL ? next->prev : list->tail;
+    last->next = next;
+    if (first->prev != NULL) {
+        first->prev->next = first;
+    } else {
+        list->head = first;  // Inserting before the first node
+    }
+    if (next != NULL) {
+        next->prev = last;
+    } else {
+        list->tail = last;  // Inserting after the last node
+    }
+    list->length += count;
+}
+
+// 29. Append Many: O(k)
+// This function appends count elements in order, linking them as one chain.
+// Time complexity: O(k), where k is count.
+void append_many(List *list, const int *values, int count) {
+    if (count < 0) {
+        printf("Error: Invalid count.\n");
+        return;
+    }
+    if (count == 0) {
+        return;
+    }
+    Node *last;
+    Node *first = create_chain(values, count, &last);
+    splice_before(list, NULL, first, last, count);
+}
+
+// 30. Insert Many: O(n + k)
+// This function inserts count elements before index, in their order. The walk to the
+// index happens once, where count calls to insert_at would walk count times.
+// Index == length appends at the end.
+// Time complexity: O(min(index, n - index) + k).
+void insert_many(List *list, int index, const int *values, int count) {
+    if (index < 0 || index > list->length) {
+        printf("Error: Index out of bounds.\n");
+        return;
+    }
+    if (count < 0) {
+        printf("Error: Invalid count.\n");
+        return;
+    }
+    if (count == 0) {
+        return;
     }
+    Node *last;
+    Node *first = create_chain(values, count, &last);
+    splice_before(list, index == list->length ? NULL : node_at(list, index), first, last, count);
+}
+
+// 31. Ingest List: O(n)
+// This function appends every int of a text or binary file (see common/ingest.h) to the
+// list, INGEST_BATCH at a time through append_many. NULL or "-" reads stdin.
+// Returns the number of elements appended, or -1 (with an error message) on an unreadable
+// file or bad input; the elements read before the error stay in the list.
+// Time complexity: O(n), where n is the number of bytes in the file.
+int ingest_list(List *list, const char *path, int format) {
+    IntReader reader;
+    if (ingest_open(&reader, path, format) != 0) {
+        return -1;
+    }
+    int batch[INGEST_BATCH];
+    int before = list->length;
+    int count;
+    while ((count = ingest_read(&reader, batch, INGEST_BATCH)) > 0) {
+        append_many(list, batch, count);
+    }
+    ingest_close(&reader);
+    return count < 0 ? -1 : list->length - before;
+}
+
+// 32. Dump List: O(n)
+// This function writes every element, head to tail, to out in out's format: one int per
+// line (DUMP_TEXT) or raw 32-bit ints (DUMP_BINARY). Both read back with ingest_list.
+// Time complexity: O(n), where n is the number of nodes in the list.
+void dump_list(const List *list, DumpWriter *out) {
+    for (Node *temp = list->head; temp != NULL; temp = temp->next) {
+        dump_value(out, temp->data);
+    }
+}
+
+// --- Hashed Mode ---
+// The index stores, for each distinct value, how many nodes hold it and the first such
+// node. Nodes never move, so appends and updates touch one or two entries. The only walks
+// happen with duplicates: when the first node of a value goes, the next one is found by
+// walking forward from it, and a node inserted in the middle is compared with the stored
+// first node by walking outwards from it in both directions.
+
+// Records a node that was just linked into the list.
+static void list_index_add(HashedList *hl, Node *node) {
+    HashEntry *entry = hash_index_upsert(&hl->index, node->data);
+    entry->count++;
+    if (entry->count == 1) {
+        entry->ref = (intptr_t)node;
+        return;
+    }
+    // Is the stored first node before or after this one? Walk both ways until one side
+    // meets it (or the other side runs off the list, which settles it as well).
+    Node *first = (Node*)entry->ref;
+    Node *back = node->prev, *ahead = node->next;
+    while (1) {
+        if (back == first || ahead == NULL) {
+            return;  // Stored node comes first
+        }
+        if (ahead == first || back == NULL) {
+            entry->ref = (intptr_t)node;  // This node comes first
+            return;
+        }
+        STAT_VISIT(2);
+        back = back->prev;
+        ahead = ahead->next;
+    }
+}
+
+// Forgets a node that is still linked. If it was the first of its value, the others all
+// come after it.
+static void list_index_remove(HashedList *hl, Node *node) {
+    HashEntry *entry = hash_index_lookup(&hl->index, node->data);
+    if (--entry->count == 0) {
+        hash_index_erase(&hl->index, entry);
+    } else if (entry->ref == (intptr_t)node) {
+        Node *next = node->next;
+        while (next->data != node->data) {
+            STAT_VISIT(1);
+            next = next->next;
+        }
+        entry->ref = (intptr_t)next;
+    }
+}
+
+// 33. Hashed Init: O(1)
+// This function sets up an empty hashed list.
+// Time complexity: O(1).
+void hashed_list_init(HashedList *hl) {
+    init_list(&hl->list);
+    hash_index_init(&hl->index);
+}
+
+// 34. Attach: O(n)
+// Moves an existing plain list into the hashed list (the caller's handle is left empty) and
+// indexes every node in one pass from the head, so the first node seen is the first node.
+// Time complexity: O(n) expected.
+void hashed_list_attach(HashedList *hl, List *list) {
+    hashed_list_free(hl);
+    hl->list = *list;
+    init_list(list);
+    hash_index_reserve(&hl->index, (size_t)hl->list.length);
+    for (Node *node = hl->list.head; node != NULL; node = node->next) {
+        HashEntry *entry = hash_index_upsert(&hl->index, node->data);
+        if (entry->count++ == 0) {
+            entry->ref = (intptr_t)node;
+        }
+    }
+}
+
+// 35. Detach: O(1)
+// Frees the index and hands the plain list back to the caller.
+// Time complexity: O(1).
+void hashed_list_detach(HashedList *hl, List *list) {
+    *list = hl->list;
+    init_list(&hl->list);
+    hash_index_free(&hl->index);
+}
+
+// 36. Hashed Append: O(1) expected
+// Time complexity: O(1) expected; a node at the tail never comes first among duplicates.
+void hashed_append(HashedList *hl, int data) {
+    append(&hl->list, data);
+    list_index_add(hl, hl->list.tail);
+}
+
+// 37. Hashed Insert at Index: O(n)
+// Time complexity: O(min(index, n - index)) for the walk, as for insert_at.
+void hashed_insert_at(HashedList *hl, int index, int data) {
+    if (index < 0 || index > hl->list.length) {
+        printf("Error: Index out of bounds.\n");
+        return;
+    }
+    Node *next = index == hl->list.length ? NULL : node_at(&hl->list, index);
+    Node *new_node = create_node(data);
+    link_before(&hl->list, next, new_node);
+    list_index_add(hl, new_node);
+}
+
+// 38. Hashed Delete at Index: O(n)
+// Time complexity: O(min(index, n - index)) for the walk, as for delete_at.
+void hashed_delete_at(HashedList *hl, int index) {
+    if (hl->list.head == NULL) {
+        printf("Error: List is empty.\n");
+        return;
+    }
+    if (index < 0 || index >= hl->list.length) {
+        printf("Error: Index out of bounds.\n");
+        return;
+    }
+    Node *node = node_at(&hl->list, index);
+    list_index_remove(hl, node);
+    unlink_node(&hl->list, node);
+    slab_free(&node_pool, node);
+}
+
+// 39. Hashed Update at Index: O(n)
+// Time complexity: O(min(index, n - index)) for the walk, as for update_at.
+void hashed_update_at(HashedList *hl, int index, int new_data) {
+    if (index < 0 || index >= hl->list.length) {
+        printf("Error: Index out of bounds.\n");
+        return;
+    }
+    Node *node = node_at(&hl->list, index);
+    if (node->data == new_data) {
+        return;
+    }
+    list_index_remove(hl, node);
+    node->data = new_data;
+    list_index_add(hl, node);
+}
+
+// 40. Hashed Find: O(1) expected
+// Returns the first node holding data, or NULL, like find.
+// Time complexity: O(1) expected, against O(n) for find.
+Node* hashed_find(const HashedList *hl, int data) {
+    const HashEntry *entry = hash_index_lookup(&hl->index, data);
+    return entry == NULL ? NULL : (Node*)entry->ref;
+}
+
+// 41. Hashed Free: O(n)
+// Returns the nodes to the pool and releases the index.
+// Time complexity: O(n), where n is the number of nodes in the list.
+void hashed_list_free(HashedList *hl) {
+    free_list(&hl->list);
+    hash_index_free(&hl->index);
+}
+
+// 42. List Stats: O(1)
+// Takes a snapshot of the instrumentation counters (see common/stats.h) and adds the
+// length. The counters only move in builds with -DDS_STATS; otherwise they stay 0.
+// Time complexity: O(1), the handle stores the length.
+void list_stats(const List *list, DsStats *stats) {
+    ds_stats_snapshot(stats);
+    stats->length = list->length;
+}
+
+// Merges the sorted chains a and b (NULL-terminated, a first on ties) and returns the head;
+// *tail receives the last node. a_tail and b_tail are the last nodes of a and b. The prev
+// links are set as the nodes are linked, so the result is a proper doubly linked chain.
+static Node* merge_chains(Node *a, Node *a_tail, Node *b, Node *b_tail, Node **tail) {
+    if (a != NULL && b != NULL && a_tail->data <= b->data) {
+        a_tail->next = b;  // Already in order: one link, no walk
+        b->prev = a_tail;
+        *tail = b_tail;
+        return a;
+    }
+    Node head;  // Dummy node in front of the merged chain
+    Node *last = &head;
+    while (a != NULL && b != NULL) {
+        STAT_VISIT(1);
+        if (b->data < a->data) {
+            last->next = b;
+            b->prev = last;
+            last = b;
+            b = b->next;
+        } else {
+            last->next = a;
+            a->prev = last;
+            last = a;
+            a = a->next;
+        }
+    }
+    last->next = a != NULL ? a : b;
+    if (last->next != NULL) {
+        last->next->prev = last;
+    }
+    if (head.next != NULL) {
+        head.next->prev = NULL;  // Not the dummy
+    }
+    *tail = a != NULL ? a_tail : b != NULL ? b_tail : last;
+    return head.next;
+}
+
+// 43. Sort List: O(n log n)
+// Sorts the nodes by value, smallest first, by relinking them: no node is allocated, copied
+// or freed. Bottom-up merge sort with a binary counter: slot i holds a sorted chain of 2^i
+// nodes; each node taken off the list enters as a chain of 1 and carries upwards like a
+// binary increment. The merges mostly touch recently visited nodes, and equal values keep
+// their order (stable). Chains already in order are joined with one link, so a sorted list
+// takes O(n). Unlike merge_sort in tricks.py, nothing is sliced or copied.
+// Only for a plain list: detach an index (indexed_detach, hashed_list_detach) first.
+// Time complexity: O(n log n) comparisons, O(1) extra memory (32 slot pointers).
+void sort_list(List *list) {
+    Node *slot_head[SORT_LIST_SLOTS] = { NULL };
+    Node *slot_tail[SORT_LIST_SLOTS];
+    Node *node = list->head;
+    while (node != NULL) {
+        Node *next = node->next;
+        Node *run = node;
+        Node *run_tail = node;
+        node->next = NULL;
+        int i = 0;
+        for (; slot_head[i] != NULL; i++) {
+            run = merge_chains(slot_head[i], slot_tail[i], run, run_tail, &run_tail);  // Carry
+            slot_head[i] = NULL;
+        }
+        slot_head[i] = run;
+        slot_tail[i] = run_tail;
+        node = next;
+    }
+    // Higher slots hold earlier nodes, so each one goes in front of the merge of the lower ones
+    Node *head = NULL;
+    Node *tail = NULL;
+    for (int i = 0; i < SORT_LIST_SLOTS; i++) {
+        if (slot_head[i] != NULL) {
+            head = merge_chains(slot_head[i], slot_tail[i], head, tail, &tail);
+        }
+    }
+    list->head = head;
+    list->tail = tail;
 }
 
 // --- Exercise ---
@@ -295,23 +1307,24 @@ void free_list(Node **head) {
 // For simplicity, we assume the list has at least one element.
 void exercise_solution() {
     // Example list for the exercise
-    Node *head = NULL;
+    List list;
+    init_list(&list);
 
     // Add some elements to the list
-    append(&head, 5);
-    append(&head, 10);
-    append(&head, 3);
-    append(&head, 99);
-    append(&head, 65);
-    append(&head, 2);
-    append(&head, 43);
-    append(&head, 76);
+    append(&list, 5);
+    append(&list, 10);
+    append(&list, 3);
+    append(&list, 99);
+    append(&list, 65);
+    append(&list, 2);
+    append(&list, 43);
+    append(&list, 76);
 
     // Initialize min with the first element
-    int min = head->data;
+    int min = list.head->data;
 
     // Traverse the list to find the minimum
-    Node *temp = head;
+    Node *temp = list.head;
     while (temp != NULL) {
         if (temp->data < min) {
             min = temp->data;  // Update min if a smaller element is found
@@ -323,16 +1336,33 @@ void exercise_solution() {
     printf("The minimum element in the linked list is: %d\n", min);
 
     // Free the list memory after use
-    free_list(&head);
+    free_list(&list);
 }
 
 // --- Big O Summary ---
 // 1. Create Node: O(1) - Creating a node takes constant time.
-// 2. Append Operation: O(n) - Traversing to the end of the list takes linear time.
-// 3. Insert at Index: O(n) - Traversing to the specific index takes linear time.
-// 4. Delete at Index: O(n) - Traversing to the specific index takes linear time.
+// 2. Append Operation: O(1) - The tail pointer gives direct access to the last node.
+// 3. Insert at Index: O(n) - Walking from the nearer end takes at most n / 2 steps (O(1) at either end).
+// 4. Delete at Index: O(n) - Walking from the nearer end takes at most n / 2 steps (O(1) at either end).
 // 5. Find Element: O(n) - Searching for an element takes linear time.
-// 6. Update Element: O(n) - Traversing to the index takes linear time.
+// 6. Update Element: O(n) - Walking from the nearer end takes at most n / 2 steps.
 // 7. Print List Forward: O(n) - Printing the list in forward direction takes linear time.
-// 8. Print List Backward: O(n) - Printing the list in reverse direction takes linear time.
+// 8. Print List Backward: O(n) - Starts directly at the tail, no walk to the end first.
 // 9. Free List: O(n) - Freeing each node takes linear time.
+// 10. Destroy Pool: O(b) - Releasing the arena costs one free per slab block, not per node.
+// 11. Length / Bounds Check: O(1) - The handle stores the number of nodes.
+// 12. Indexed Node at / Insert / Delete / Update: O(log n) expected - Spans on the express lanes give positions.
+// 13. Indexed Lower Bound / Find / Insert Sorted: O(log n) expected - For a list kept in sorted order.
+// 14. Attach / Detach Index: O(n) - One pass builds the lanes; detaching frees them.
+// 15. Save / Load List: O(n) - One sequential pass each way, no append per element on load.
+// 16. Open Snapshot / Element at Index: O(1) - The file is mapped and read in place.
+// 17. Append Many / Insert Many: O(k) plus one walk to the index - A batch is spliced in as one chain.
+// 18. Ingest List: O(n) - One pass over the file, appended in batches.
+// 19. Print / Dump List: O(n) - Formatted into one buffer, one write(2) per MiB.
+// 20. Hashed Find: O(1) expected - One hash index lookup instead of a walk.
+// 21. Hashed Append: O(1) expected - One index entry changes.
+// 22. Hashed Insert / Delete / Update at Index: O(n) - The walk to the index; the index update is O(1)
+//     expected (a walk only for duplicate values).
+// 23. List Stats: O(1) - A copy of the counters; with -DDS_STATS walks count nodes and express lanes.
+// 24. Sort List: O(n log n) - Stable bottom-up merge sort that relinks nodes, O(1) extra memory.
+// Memory: about 1/3 lane (32 bytes) per node on top of the 24 byte node.
@@ -0,0 +1,193 @@
+// This header generates doubly linked lists of any element type, the type-generic version
+// of the List in DDL/DDL_first.c. See common/generic.h for the arguments.
+//
+// Example: a list of key/value pairs found by key
+//   typedef struct Pair { int64_t key; int64_t value; } Pair;
+//   #define PAIR_KEY(p) ((p).key)
+//   DEFINE_LIST(PairList, Pair, int64_t, PAIR_KEY, GEN_LESS)
+//   PairList list;
+//   PairList_init(&list);
+//   PairList_append(&list, (Pair){7, 700});
+//   PairListNode *node = PairList_find(&list, 7);
+//
+// Generated for DEFINE_LIST(Name, T, K, KEY_OF, LESS):
+//   NameNode                             { T data; NameNode *next; NameNode *prev; }
+//   Name                                 { NameNode *head; NameNode *tail; int length; }
+//   void      Name_init(Name *list)
+//   NameNode* Name_node_at(const Name *list, int index)     caller checks the bounds
+//   void      Name_append(Name *list, T value)
+//   void      Name_append_many(Name *list, const T *values, int count)
+//   void      Name_insert_at(Name *list, int index, T value)
+//   void      Name_delete_at(Name *list, int index)
+//   NameNode* Name_find(const Name *list, K key)            first match, or NULL
+//   void      Name_free(Name *list)
+//   Name_pool                            the SlabPool the nodes come from
+// The element is stored inside its node, so a node is one slab slot: no second allocation
+// and no second pointer to follow. Every instantiation has its own slab pool, released
+// with slab_destroy(&Name_pool) once all lists of that type are freed.
+
+#ifndef LIST_GEN_H
+#define LIST_GEN_H
+
+// --- Includes Section ---
+#include <stdio.h>
+#include <stdlib.h>
+#include "../common/slab.h"  // Shared fixed-size node allocator
+#include "../common/generic.h"  // GEN_SELF, GEN_LESS, GEN_EQUAL
+
+// --- Generator ---
+#define DEFINE_LIST(Name, T, K, KEY_OF, LESS)                                                   \
+typedef struct Name##Node {                                                                     \
+    T data;                        /* Element stored in the node */                             \
+    struct Name##Node *next;       /* Pointer to the next node */                               \
+    struct Name##Node *prev;       /* Pointer to the previous node */                           \
+} Name##Node;                                                                                   \
+                                                                                                \
+typedef struct Name {                                                                           \
+    Name##Node *head;              /* First node of the list (NULL when empty) */               \
+    Name##Node *tail;              /* Last node of the list (NULL when empty) */                \
+    int length;                    /* Number of nodes in the list */                            \
+} Name;                                                                                         \
+                                                                                                \
+static SlabPool Name##_pool = SLAB_POOL_INIT(sizeof(Name##Node));                               \
+                                                                                                \
+/* 1. Init: O(1) */                                                                             \
+static inline void Name##_init(Name *list) {                                                    \
+    list->head = NULL;                                                                          \
+    list->tail = NULL;                                                                          \
+    list->length = 0;                                                                           \
+}                                                                                               \
+                                                                                                \
+/* 2. Node at Index: O(min(index, n - index)), walks from the nearer end */                     \
+static inline Name##Node* Name##_node_at(const Name *list, int index) {                         \
+    Name##Node *temp;                                                                           \
+    if (index < list->length / 2) {                                                             \
+        temp = list->head;                                                                      \
+        for (int i = 0; i < index; i++) {                                                       \
+            temp = temp->next;                                                                  \
+        }                                                                                       \
+    } else {                                                                                    \
+        temp = list->tail;                                                                      \
+        for (int i = list->length - 1; i > index; i--) {                                        \
+            temp = temp->prev;                                                                  \
+        }                                                                                       \
+    }                                                                                           \
+    return temp;                                                                                \
+}                                                                                               \
+                                                                                                \
+/* Links node right before next, or after the tail when next is NULL. */                        \
+static inline void Name##_link_before(Name *list, Name##Node *next, Name##Node *node) {         \
+    node->next = next;                                                                          \
+    node->prev = next != NULL ? next->prev : list->tail;                                        \
+    if (node->prev != NULL) {                                                                   \
+        node->prev->next = node;                                                                \
+    } else {                                                                                    \
+        list->head = node;                                                                      \
+    }                                                                                           \
+    if (next != NULL) {                                                                         \
+        next->prev = node;                                                                      \
+    } else {                                                                                    \
+        list->tail = node;                                                                      \
+    }                                                                                           \
+    list->length++;                                                                             \
+}                                                                                               \
+                                                                                                \
+/* 3. Append: O(1) */                                                                           \
+static inline void Name##_append(Name *list, T value) {                                         \
+    Name##Node *node = (Name##Node*)slab_alloc(&Name##_pool);                                   \
+    node->data = value;                                                                         \
+    Name##_link_before(list, NULL, node);                                                       \
+}                                                                                               \
+                                                                                                \
+/* 4. Append Many: O(k), the nodes are linked as one chain and spliced once */                  \
+static inline void Name##_append_many(Name *list, const T *values, int count) {                 \
+    if (count < 0) {                                                                            \
+        printf("Error: Invalid count.\n");                                                      \
+        return;                                                                                 \
+    }                                                                                           \
+    if (count == 0) {                                                                           \
+        return;                                                                                 \
+    }                                                                                           \
+    Name##Node *prev = list->tail;                                                              \
+    for (int i = 0; i < count; i++) {                                                           \
+        Name##Node *node = (Name##Node*)slab_alloc(&Name##_pool);                               \
+        node->data = values[i];                                                                 \
+        node->prev = prev;                                                                      \
+        if (prev != NULL) {                                                                     \
+            prev->next = node;                                                                  \
+        } else {                                                                                \
+            list->head = node;                                                                  \
+        }                                                                                       \
+        prev = node;                                                                            \
+    }                                                                                           \
+    prev->next = NULL;                                                                          \
+    list->tail = prev;                                                                          \
+    list->length += count;                                                                      \
+}                                                                                               \
+                                                                                                \
+/* 5. Insert at Index: O(min(index, n - index)); index == length appends */                     \
+static inline void Name##_insert_at(Name *list, int index, T value) {                           \
+    if (index < 0 || index > list->length) {                                                    \
+        printf("Error: Index out of bounds.\n");                                                \
+        return;                                                                                 \
+    }                                                                                           \
+    Name##Node *next = index == list->length ? NULL : Name##_node_at(list, index);              \
+    Name##Node *node = (Name##Node*)slab_alloc(&Name##_pool);                                   \
+    node->data = value;                                                                         \
+    Name##_link_before(list, next, node);                                                       \
+}                                                                                               \
+                                                                                                \
+/* 6. Delete at Index: O(min(index, n - index)) */                                              \
+static inline void Name##_delete_at(Name *list, int index) {                                    \
+    if (list->head == NULL) {                                                                   \
+        printf("Error: List is empty.\n");                                                      \
+        return;                                                                                 \
+    }                                                                                           \
+    if (index < 0 || index >= list->length) {                                                   \
+        printf("Error: Index out of bounds.\n");                                                \
+        return;                                                                                 \
+    }                                                                                           \
+    Name##Node *node = Name##_node_at(list, index);                                             \
+    if (node->next != NULL) {                                                                   \
+        node->next->prev = node->prev;                                                          \
+    } else {                                                                                    \
+        list->tail = node->prev;                                                                \
+    }                                                                                           \
+    if (node->prev != NULL) {                                                                   \
+        node->prev->next = node->next;                                                          \
+    } else {                                                                                    \
+        list->head = node->next;                                                                \
+    }                                                                                           \
+    list->length--;                                                                             \
+    slab_free(&Name##_pool, node);                                                              \
+}                                                                                               \
+                                                                                                \
+/* 7. Find: O(n), linear search with the inlined key comparison */                              \
+static inline Name##Node* Name##_find(const Name *list, K key) {                                \
+    for (Name##Node *temp = list->head; temp != NULL; temp = temp->next) {                      \
+        if (GEN_EQUAL(LESS, KEY_OF(temp->data), key)) {                                         \
+            return temp;                                                                        \
+        }                                                                                       \
+    }                                                                                           \
+    return NULL;                                                                                \
+}                                                                                               \
+                                                                                                \
+/* 8. Free: O(n), the nodes go back to the pool's free list */                                  \
+static inline void Name##_free(Name *list) {                                                    \
+    while (list->head != NULL) {                                                                \
+        Name##Node *temp = list->head;                                                          \
+        list->head = temp->next;                                                                \
+        slab_free(&Name##_pool, temp);                                                          \
+    }                                                                                           \
+    Name##_init(list);                                                                          \
+}
+
+// --- Big O Summary ---
+// 1. Init: O(1) - The handle starts empty; nodes come from the type's slab pool.
+// 2. Append: O(1) - The handle remembers the tail.
+// 3. Append Many: O(k) - One chain, spliced after the tail once.
+// 4. Node at / Insert at / Delete at: O(min(index, n - index)) - Walks from the nearer end.
+// 5. Find: O(n) - A linear search; the key comparison is inlined, not called.
+// 6. Free: O(n) - Every node goes back to the pool.
+
+#endif // LIST_GEN_H
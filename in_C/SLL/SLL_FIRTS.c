@@ -5,6 +5,12 @@
 // --- Includes Section ---
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include "../common/slab.h"  // Shared fixed-size node allocator
+#include "../common/stats.h"  // Opt-in hot-path counters (compiled out by default)
+#include "../common/ingest.h"  // Streaming int loader for text and binary files
+#include "../common/dump.h"  // Buffered output writer
+#include "../common/hash_index.h"  // Open-addressing hash table for O(1) find
 
 // Singly linked list is a data structure where each element (node) points to the next node in the list.
 // The last node points to NULL, indicating the end of the list.
@@ -15,52 +21,115 @@ typedef struct Node {
     struct Node *next;     // Pointer to the next node in the list
 } Node;
 
+// The list handle keeps the tail and the length next to the head, so appending
+// does not need a traversal and index bounds can be checked in O(1).
+typedef struct List {
+    Node *head;            // First node of the list (NULL when empty)
+    Node *tail;            // Last node of the list (NULL when empty)
+    int length;            // Number of nodes in the list
+} List;
+
+// Hashed mode: a hash index next to the list maps each distinct value to its count and the
+// first node holding it, so find's O(n) walk becomes an O(1) lookup. The hashed list owns a
+// plain List: read it with the plain functions, but change it only through the hashed_
+// functions while the index is attached.
+typedef struct HashedList {
+    List list;             // The ordinary singly linked list
+    HashIndex index;       // value -> {count, first node}
+} HashedList;
+
+#define SORT_LIST_SLOTS 32  // Sorted chains of 2^0 .. 2^31 nodes cover any int length
+
+// --- Node Pool ---
+// All nodes are carved from this slab pool instead of one malloc per node.
+// Deleted nodes go back on the pool's free list, and main releases the whole arena at once.
+static SlabPool node_pool = SLAB_POOL_INIT(sizeof(Node));
+
 // --- Function Declarations ---
 Node* create_node(int data);
-void append(Node **head, int data);
-void insert_at(Node **head, int index, int data);
-void delete_at(Node **head, int index);
-Node* find(Node *head, int data);
-void update_at(Node *head, int index, int new_data);
-void print_list(Node *head);
+void init_list(List *list);
+void append(List *list, int data);
+void insert_at(List *list, int index, int data);
+void delete_at(List *list, int index);
+Node* find(const List *list, int data);
+void update_at(List *list, int index, int new_data);
+void print_list(const List *list);
 void exercise_solution();
-void free_list(Node **head);
+void free_list(List *list);
+void append_many(List *list, const int *values, int count);
+void insert_many(List *list, int index, const int *values, int count);
+int ingest_list(List *list, const char *path, int format);
+void dump_list(const List *list, DumpWriter *out);
+void hashed_list_init(HashedList *hl);
+void hashed_list_attach(HashedList *hl, List *list);
+void hashed_list_detach(HashedList *hl, List *list);
+void hashed_append(HashedList *hl, int data);
+void hashed_insert_at(HashedList *hl, int index, int data);
+void hashed_delete_at(HashedList *hl, int index);
+void hashed_update_at(HashedList *hl, int index, int new_data);
+Node* hashed_find(const HashedList *hl, int data);
+void hashed_list_free(HashedList *hl);
+void list_stats(const List *list, DsStats *stats);
+void sort_list(List *list);
 
 // --- Main Function ---
 // The main function will demonstrate the singly linked list operations.
-int main() {
+// Benchmarks include this file with DS_NO_MAIN defined to reuse the list operations.
+#ifndef DS_NO_MAIN
+int main(int argc, char *argv[]) {
+    // Bulk Load: O(n)
+    // Given a file ("-" for stdin), the program loads it instead of running the demo:
+    //   ./SLL_FIRTS numbers.txt          decimal ints separated by whitespace or commas
+    //   ./SLL_FIRTS numbers.bin --binary raw 32-bit ints
+    if (argc > 1) {
+        List loaded;
+        init_list(&loaded);
+        int format = argc > 2 && strcmp(argv[2], "--binary") == 0 ? INGEST_BINARY : INGEST_TEXT;
+        int status = ingest_list(&loaded, argv[1], format) < 0 ? 1 : 0;
+        if (status == 0 && loaded.length > 0) {
+            printf("Loaded %d elements from %s (first %d, last %d).\n", loaded.length, argv[1],
+                   loaded.head->data, loaded.tail->data);
+        } else if (status == 0) {
+            printf("Loaded 0 elements from %s.\n", argv[1]);
+        }
+        free_list(&loaded);
+        slab_destroy(&node_pool);
+        return status;
+    }
+
     // Linked List Initialization: O(1)
     // We'll start with an empty list.
-    Node *head = NULL;  // Initialize an empty list
+    List list;
+    init_list(&list);  // Initialize an empty list
 
-    // 1. Append Operation: O(n)
+    // 1. Append Operation: O(1)
     // We'll append elements to the list.
-    append(&head, 10);  // Append 10 to the list
-    append(&head, 20);  // Append 20
-    append(&head, 30);  // Append 30
-    append(&head, 40);  // Append 40
-    append(&head, 50);  // Append 50
+    append(&list, 10);  // Append 10 to the list
+    append(&list, 20);  // Append 20
+    append(&list, 30);  // Append 30
+    append(&list, 40);  // Append 40
+    append(&list, 50);  // Append 50
 
     // Print the initial list
     printf("Initial Linked List:\n");
-    print_list(head);
+    print_list(&list);
 
     // 2. Insert Operation: O(n)
     // We'll insert a new element at index 2.
     printf("\nInserting 25 at index 2:\n");
-    insert_at(&head, 2, 25);  // Insert 25 at index 2
-    print_list(head);  // Print after insertion
+    insert_at(&list, 2, 25);  // Insert 25 at index 2
+    print_list(&list);  // Print after insertion
 
     // 3. Delete Operation: O(n)
     // We'll delete the element at index 4.
     printf("\nDeleting element at index 4:\n");
-    delete_at(&head, 4);  // Delete element at index 4
-    print_list(head);  // Print after deletion
+    delete_at(&list, 4);  // Delete element at index 4
+    print_list(&list);  // Print after deletion
 
     // 4. Find Operation: O(n)
     // Find if element 40 exists in the list.
     printf("\nFinding element 40 in the list:\n");
-    Node *found_node = find(head, 40);  // Find element 40
+    Node *found_node = find(&list, 40);  // Find element 40
     if (found_node != NULL) {
         printf("Element 40 found in the list.\n");
     } else {
@@ -70,8 +139,51 @@ int main() {
     // 5. Update Operation: O(n)
     // Update the element at index 3 to 99.
     printf("\nUpdating element at index 3 to 99:\n");
-    update_at(head, 3, 99);  // Update index 3 to 99
-    print_list(head);  // Print after update
+    update_at(&list, 3, 99);  // Update index 3 to 99
+    print_list(&list);  // Print after update
+
+    // 6. Batched Insert: O(k) at the ends
+    // A batch is linked into a chain first and spliced in with one walk to the index.
+    printf("\nAppending 60, 70 and inserting 1, 2, 3 at index 1:\n");
+    int more[2] = {60, 70};
+    int middle[3] = {1, 2, 3};
+    append_many(&list, more, 2);
+    insert_many(&list, 1, middle, 3);
+    print_list(&list);
+
+    // 7. Hashed Mode: find in O(1) expected
+    // A hash index remembers the first node of every value; the hashed_ functions keep it
+    // in sync as nodes come and go.
+    printf("\nHashed mode: insert 70 at index 0, delete index 3, update index 1 to 50:\n");
+    HashedList hl;
+    hashed_list_init(&hl);
+    hashed_list_attach(&hl, &list);  // O(n), the list moves into the hashed list
+    hashed_insert_at(&hl, 0, 70);
+    hashed_delete_at(&hl, 3);
+    hashed_update_at(&hl, 1, 50);
+    print_list(&hl.list);
+    printf("First 70 is %s, first 50 is %s, 2 %s\n", hashed_find(&hl, 70) == hl.list.head ? "the head" : "elsewhere",
+           hashed_find(&hl, 50) == hl.list.head->next ? "at index 1" : "elsewhere",
+           hashed_find(&hl, 2) != NULL ? "found." : "not found.");
+    hashed_list_detach(&hl, &list);  // Back to a plain list, the index is freed
+
+    // 8. Sort: O(n log n)
+    // The nodes are relinked in ascending order; none is allocated or copied.
+    printf("\nSorting the list:\n");
+    sort_list(&list);
+    print_list(&list);
+
+#ifdef DS_STATS
+    // 9. Instrumentation: built with -DDS_STATS (and -DDS_STATS_PERF for hardware counters)
+    // The counters tell how many nodes a find or an update walked over.
+    printf("\nCounters for a missed find and an update at index 5:\n");
+    DsStats stats;
+    ds_stats_reset();
+    find(&list, 1000);
+    update_at(&list, 5, 80);
+    list_stats(&list, &stats);
+    ds_stats_print(&stats);
+#endif
 
     // --- Demonstrating Exercise ---
     // Calling the solution function to an exercise.
@@ -79,123 +191,147 @@ int main() {
     exercise_solution();
 
     // Free the memory used by the list
-    free_list(&head);
+    free_list(&list);
+
+    // Give every slab block back to malloc in one pass
+    slab_destroy(&node_pool);
 
     return 0;
 }
+#endif // DS_NO_MAIN
 
 // --- Linked List Operations ---
 
 // 1. Create Node: O(1)
 // This function creates a new node with the given data.
+// The node comes from the slab pool, which exits on allocation failure.
 // Time complexity: O(1) as creating a node takes constant time.
 Node* create_node(int data) {
-    Node *new_node = (Node*)malloc(sizeof(Node));  // Allocate memory for a new node
-    if (!new_node) {
-        printf("Memory allocation error!\n");
-        exit(1);  // Exit if memory allocation fails
-    }
+    Node *new_node = (Node*)slab_alloc(&node_pool);  // Take a slot from the node pool
     new_node->data = data;  // Assign data
     new_node->next = NULL;  // Initialize the next pointer to NULL
     return new_node;  // Return the new node
 }
 
-// 2. Append Operation: O(n)
-// Appending an element to the end of the linked list requires traversing the list to find the last node.
-// Time complexity: O(n), where n is the number of nodes in the list.
-void append(Node **head, int data) {
-    Node *new_node = create_node(data);  // Create a new node
+// 2. Init List: O(1)
+// This function sets up an empty list handle.
+// Time complexity: O(1).
+void init_list(List *list) {
+    list->head = NULL;
+    list->tail = NULL;
+    list->length = 0;
+}
 
-    // If the list is empty, make the new node the head
-    if (*head == NULL) {
-        *head = new_node;
-        return;
-    }
+// 3. Append Operation: O(1)
+// The handle remembers the last node, so appending just links after the tail.
+// Time complexity: O(1), no traversal is needed.
+void append(List *list, int data) {
+    Node *new_node = create_node(data);  // Create a new node
 
-    // Traverse the list to find the last node
-    Node *temp = *head;
-    while (temp->next != NULL) {
-        temp = temp->next;
+    // If the list is empty, the new node is both head and tail
+    if (list->tail == NULL) {
+        list->head = new_node;
+    } else {
+        list->tail->next = new_node;  // Link after the current last node
     }
 
-    // Append the new node at the end
-    temp->next = new_node;
+    list->tail = new_node;
+    list->length++;
 }
 
-// 3. Insert at Index: O(n)
+// 4. Insert at Index: O(n)
 // Inserting an element at a specific index requires traversing the list to that index.
+// Indexes 0 and length are handled in O(1) (push front / append).
 // Time complexity: O(n), where n is the number of nodes in the list.
-void insert_at(Node **head, int index, int data) {
+void insert_at(List *list, int index, int data) {
+    // Check the bounds against the stored length instead of walking the list
+    if (index < 0 || index > list->length) {
+        printf("Error: Index out of bounds.\n");
+        return;
+    }
+
+    // Inserting at the end is an append
+    if (index == list->length) {
+        append(list, data);
+        return;
+    }
+
     // Create a new node
     Node *new_node = create_node(data);
 
     // If inserting at the head (index 0), update the head pointer
     if (index == 0) {
-        new_node->next = *head;
-        *head = new_node;
+        new_node->next = list->head;
+        list->head = new_node;
+        list->length++;
         return;
     }
 
     // Traverse the list to find the node before the index
-    Node *temp = *head;
-    for (int i = 0; i < index - 1 && temp != NULL; i++) {
+    Node *temp = list->head;
+    STAT_VISIT(index);
+    for (int i = 0; i < index - 1; i++) {
         temp = temp->next;
     }
 
-    // If index is out of bounds
-    if (temp == NULL) {
-        printf("Error: Index out of bounds.\n");
-        free(new_node);  // Free the allocated memory for the new node
-        return;
-    }
-
     // Insert the new node at the index
     new_node->next = temp->next;
     temp->next = new_node;
+    list->length++;
 }
 
-// 4. Delete at Index: O(n)
+// 5. Delete at Index: O(n)
 // Deleting an element from a specific index requires traversing the list to that index.
 // Time complexity: O(n), where n is the number of nodes in the list.
-void delete_at(Node **head, int index) {
+void delete_at(List *list, int index) {
     // If the list is empty
-    if (*head == NULL) {
+    if (list->head == NULL) {
         printf("Error: List is empty.\n");
         return;
     }
 
-    Node *temp = *head;
+    // Check the bounds against the stored length
+    if (index < 0 || index >= list->length) {
+        printf("Error: Index out of bounds.\n");
+        return;
+    }
+
+    Node *temp = list->head;
 
     // If deleting the head (index 0)
     if (index == 0) {
-        *head = temp->next;  // Update head
-        free(temp);  // Free the old head node
+        list->head = temp->next;  // Update head
+        if (list->head == NULL) {
+            list->tail = NULL;  // The list is now empty
+        }
+        slab_free(&node_pool, temp);  // Free the old head node
+        list->length--;
         return;
     }
 
     // Traverse the list to find the node before the index
-    for (int i = 0; i < index - 1 && temp != NULL; i++) {
+    STAT_VISIT(index);
+    for (int i = 0; i < index - 1; i++) {
         temp = temp->next;
     }
 
-    // If index is out of bounds or next is NULL
-    if (temp == NULL || temp->next == NULL) {
-        printf("Error: Index out of bounds.\n");
-        return;
-    }
-
     // Remove the node at the index
     Node *node_to_delete = temp->next;
     temp->next = node_to_delete->next;
-    free(node_to_delete);  // Free the memory of the deleted node
+    if (node_to_delete == list->tail) {
+        list->tail = temp;  // The node before it becomes the new tail
+    }
+    slab_free(&node_pool, node_to_delete);  // Free the memory of the deleted node
+    list->length--;
 }
 
-// 5. Find Element: O(n)
+// 6. Find Element: O(n)
 // Finding an element in a singly linked list requires traversing the list.
 // Time complexity: O(n), where n is the number of nodes in the list.
-Node* find(Node *head, int data) {
-    Node *temp = head;
+Node* find(const List *list, int data) {
+    Node *temp = list->head;
     while (temp != NULL) {
+        STAT_VISIT(1);
         if (temp->data == data) {
             return temp;  // Return the node if found
         }
@@ -204,77 +340,445 @@ Node* find(Node *head, int data) {
     return NULL;  // Return NULL if the element is not found
 }
 
-// 6. Update Element at Index: O(n)
+// 7. Update Element at Index: O(n)
 // Updating an element at a specific index requires traversing the list to that index.
+// The last element is updated in O(1) through the tail.
 // Time complexity: O(n), where n is the number of nodes in the list.
-void update_at(Node *head, int index, int new_data) {
-    Node *temp = head;
-
-    // Traverse the list to find the node at the index
-    for (int i = 0; i < index && temp != NULL; i++) {
-        temp = temp->next;
-    }
-
+void update_at(List *list, int index, int new_data) {
     // If index is out of bounds
-    if (temp == NULL) {
+    if (index < 0 || index >= list->length) {
         printf("Error: Index out of bounds.\n");
         return;
     }
 
+    if (index == list->length - 1) {
+        list->tail->data = new_data;
+        return;
+    }
+
+    // Traverse the list to find the node at the index
+    Node *temp = list->head;
+    STAT_VISIT(index + 1);
+    for (int i = 0; i < index; i++) {
+        temp = temp->next;
+    }
+
     // Update the node's data
     temp->data = new_data;
 }
 
-// 7. Print List: O(n)
+// 8. Print List: O(n)
 // This function prints the contents of the linked list.
+// The text goes through the shared stdout writer (see common/dump.h), so printing a long
+// list costs one write(2) per MiB instead of one printf per node.
 // Time complexity: O(n), where n is the number of nodes in the list.
-void print_list(Node *head) {
-    Node *temp = head;
-    printf("[");
+void print_list(const List *list) {
+    DumpWriter *out = dump_stdout();
+    Node *temp = list->head;
+    dump_text(out, "[");
     while (temp != NULL) {
-        printf("%d", temp->data);
+        dump_int(out, temp->data);
         if (temp->next != NULL) {
-            printf(" -> ");
+            dump_text(out, " -> ");
         }
         temp = temp->next;
     }
-    printf("]\n");
+    dump_text(out, "]\n");
+    dump_flush(out);
 }
 
-// 8. Free List: O(n)
-// This function frees the memory allocated for the linked list.
+// 9. Free List: O(n)
+// This function returns every node of the list to the pool's free list and empties the handle.
+// To release the memory itself, call slab_destroy(&node_pool) once all lists are done.
 // Time complexity: O(n), where n is the number of nodes in the list.
-void free_list(Node **head) {
+void free_list(List *list) {
     Node *temp;
-    while (*head != NULL) {
-        temp = *head;
-        *head = (*head)->next;
-        free(temp);
+    while (list->head != NULL) {
+        temp = list->head;
+        list->head = list->head->next;
+        slab_free(&node_pool, temp);
+    }
+    init_list(list);
+}
+
+// --- Bulk Operations ---
+// Batched inserts and the streaming loader. A batch is built as a separate chain and
+// spliced into the list once, so the handle and the neighbours are touched once per batch.
+
+// Creates nodes for values[0..count) linked to each other in order, and returns the
+// first one (count must be > 0). *last receives the final node.
+static Node* create_chain(const int *values, int count, Node **last) {
+    Node *first = create_node(values[0]);
+    Node *prev = first;
+    for (int i = 1; i < count; i++) {
+        Node *node = (Node*)slab_alloc(&node_pool);  // create_node without the NULL store
+        node->data = values[i];
+        prev->next = node;
+        prev = node;
+    }
+    prev->next = NULL;
+    *last = prev;
+    return first;
+}
+
+// 10. Append Many: O(k)
+// This function appends count elements in order, linking them as one chain after the tail.
+// Time complexity: O(k), where k is count.
+void append_many(List *list, const int *values, int count) {
+    insert_many(list, list->length, values, count);
+}
+
+// 11. Insert Many: O(n + k)
+// This function inserts count elements before index, in their order. The walk to the node
+// before the index happens once, where count calls to insert_at would walk count times.
+// Index 0 and index == length need no walk.
+// Time complexity: O(index + k).
+void insert_many(List *list, int index, const int *values, int count) {
+    if (index < 0 || index > list->length) {
+        printf("Error: Index out of bounds.\n");
+        return;
+    }
+    if (count < 0) {
+        printf("Error: Invalid count.\n");
+        return;
+    }
+    if (count == 0) {
+        return;
+    }
+
+    // Find the node the chain goes after (NULL when inserting at the head)
+    Node *prev = NULL;
+    if (index == list->length) {
+        prev = list->tail;
+    } else if (index > 0) {
+        prev = list->head;
+        for (int i = 0; i < index - 1; i++) {
+            prev = prev->next;
+        }
+    }
+
+    Node *last;
+    Node *first = create_chain(values, count, &last);
+    if (prev == NULL) {
+        last->next = list->head;
+        list->head = first;
+    } else {
+        last->next = prev->next;
+        prev->next = first;
+    }
+    if (last->next == NULL) {
+        list->tail = last;  // The chain ends the list
+    }
+    list->length += count;
+}
+
+// 12. Ingest List: O(n)
+// This function appends every int of a text or binary file (see common/ingest.h) to the
+// list, INGEST_BATCH at a time through append_many. NULL or "-" reads stdin.
+// Returns the number of elements appended, or -1 (with an error message) on an unreadable
+// file or bad input; the elements read before the error stay in the list.
+// Time complexity: O(n), where n is the number of bytes in the file.
+int ingest_list(List *list, const char *path, int format) {
+    IntReader reader;
+    if (ingest_open(&reader, path, format) != 0) {
+        return -1;
+    }
+    int batch[INGEST_BATCH];
+    int before = list->length;
+    int count;
+    while ((count = ingest_read(&reader, batch, INGEST_BATCH)) > 0) {
+        append_many(list, batch, count);
+    }
+    ingest_close(&reader);
+    return count < 0 ? -1 : list->length - before;
+}
+
+// 13. Dump List: O(n)
+// This function writes every element, head to tail, to out in out's format: one int per
+// line (DUMP_TEXT) or raw 32-bit ints (DUMP_BINARY). Both read back with ingest_list.
+// Time complexity: O(n), where n is the number of nodes in the list.
+void dump_list(const List *list, DumpWriter *out) {
+    for (Node *temp = list->head; temp != NULL; temp = temp->next) {
+        dump_value(out, temp->data);
+    }
+}
+
+// --- Hashed Mode ---
+// The index stores, for each distinct value, how many nodes hold it and the first such
+// node. Nodes never move, so appends and updates touch one or two entries. Whether a new
+// node comes before the stored first node of its value is seen on the walk to the index,
+// which passes every node before it. When the first node of a value goes, the next one is
+// found by walking forward from it.
+
+// Walks to the node at `index` (which must exist) and sets *passed if `mark` is one of
+// the nodes before it.
+static Node* hashed_walk(const List *list, int index, const Node *mark, int *passed) {
+    Node *temp = list->head;
+    *passed = 0;
+    STAT_VISIT(index + 1);
+    for (int i = 0; i < index; i++) {
+        *passed |= temp == mark;
+        temp = temp->next;
+    }
+    return temp;
+}
+
+// Returns the stored first node of data, or NULL.
+static const Node* hashed_first(const HashedList *hl, int data) {
+    const HashEntry *entry = hash_index_lookup(&hl->index, data);
+    return entry == NULL ? NULL : (const Node*)entry->ref;
+}
+
+// Records a node that was just linked into the list; after_first tells whether the stored
+// first node of its value lies before it.
+static void list_index_add(HashedList *hl, Node *node, int after_first) {
+    HashEntry *entry = hash_index_upsert(&hl->index, node->data);
+    if (entry->count++ == 0 || !after_first) {
+        entry->ref = (intptr_t)node;
+    }
+}
+
+// Forgets a node that is still linked. If it was the first of its value, the others all
+// come after it.
+static void list_index_remove(HashedList *hl, Node *node) {
+    HashEntry *entry = hash_index_lookup(&hl->index, node->data);
+    if (--entry->count == 0) {
+        hash_index_erase(&hl->index, entry);
+    } else if (entry->ref == (intptr_t)node) {
+        Node *next = node->next;
+        while (next->data != node->data) {
+            STAT_VISIT(1);
+            next = next->next;
+        }
+        entry->ref = (intptr_t)next;
+    }
+}
+
+// 14. Hashed Init: O(1)
+// This function sets up an empty hashed list.
+// Time complexity: O(1).
+void hashed_list_init(HashedList *hl) {
+    init_list(&hl->list);
+    hash_index_init(&hl->index);
+}
+
+// 15. Attach: O(n)
+// Moves an existing plain list into the hashed list (the caller's handle is left empty) and
+// indexes every node in one pass from the head, so the first node seen is the first node.
+// Time complexity: O(n) expected.
+void hashed_list_attach(HashedList *hl, List *list) {
+    hashed_list_free(hl);
+    hl->list = *list;
+    init_list(list);
+    hash_index_reserve(&hl->index, (size_t)hl->list.length);
+    for (Node *node = hl->list.head; node != NULL; node = node->next) {
+        list_index_add(hl, node, 1);
     }
 }
 
+// 16. Detach: O(1)
+// Frees the index and hands the plain list back to the caller.
+// Time complexity: O(1).
+void hashed_list_detach(HashedList *hl, List *list) {
+    *list = hl->list;
+    init_list(&hl->list);
+    hash_index_free(&hl->index);
+}
+
+// 17. Hashed Append: O(1) expected
+// Time complexity: O(1) expected; every other node comes before the tail.
+void hashed_append(HashedList *hl, int data) {
+    append(&hl->list, data);
+    list_index_add(hl, hl->list.tail, 1);
+}
+
+// 18. Hashed Insert at Index: O(n)
+// Time complexity: O(n), one walk to the node before the index, as for insert_at.
+void hashed_insert_at(HashedList *hl, int index, int data) {
+    if (index < 0 || index > hl->list.length) {
+        printf("Error: Index out of bounds.\n");
+        return;
+    }
+    if (index == hl->list.length) {
+        hashed_append(hl, data);
+        return;
+    }
+    Node *new_node = create_node(data);
+    int passed = 0;
+    if (index == 0) {
+        new_node->next = hl->list.head;
+        hl->list.head = new_node;
+    } else {
+        const Node *first = hashed_first(hl, data);
+        Node *prev = hashed_walk(&hl->list, index - 1, first, &passed);
+        passed |= prev == first;  // prev comes before the new node as well
+        new_node->next = prev->next;
+        prev->next = new_node;
+    }
+    hl->list.length++;
+    list_index_add(hl, new_node, passed);
+}
+
+// 19. Hashed Delete at Index: O(n)
+// Time complexity: O(n), one walk to the node before the index, as for delete_at.
+void hashed_delete_at(HashedList *hl, int index) {
+    if (hl->list.head == NULL) {
+        printf("Error: List is empty.\n");
+        return;
+    }
+    if (index < 0 || index >= hl->list.length) {
+        printf("Error: Index out of bounds.\n");
+        return;
+    }
+    Node *prev = NULL;
+    Node *node = hl->list.head;
+    if (index > 0) {
+        int passed;
+        prev = hashed_walk(&hl->list, index - 1, NULL, &passed);
+        node = prev->next;
+    }
+    list_index_remove(hl, node);
+    if (prev == NULL) {
+        hl->list.head = node->next;
+    } else {
+        prev->next = node->next;
+    }
+    if (node == hl->list.tail) {
+        hl->list.tail = prev;  // NULL when the list is now empty
+    }
+    slab_free(&node_pool, node);
+    hl->list.length--;
+}
+
+// 20. Hashed Update at Index: O(n)
+// Time complexity: O(n), one walk to the index, as for update_at.
+void hashed_update_at(HashedList *hl, int index, int new_data) {
+    if (index < 0 || index >= hl->list.length) {
+        printf("Error: Index out of bounds.\n");
+        return;
+    }
+    int passed;
+    Node *node = hashed_walk(&hl->list, index, hashed_first(hl, new_data), &passed);
+    if (node->data == new_data) {
+        return;
+    }
+    list_index_remove(hl, node);
+    node->data = new_data;
+    list_index_add(hl, node, passed);
+}
+
+// 21. Hashed Find: O(1) expected
+// Returns the first node holding data, or NULL, like find.
+// Time complexity: O(1) expected, against O(n) for find.
+Node* hashed_find(const HashedList *hl, int data) {
+    return (Node*)hashed_first(hl, data);
+}
+
+// 22. Hashed Free: O(n)
+// Returns the nodes to the pool and releases the index.
+// Time complexity: O(n), where n is the number of nodes in the list.
+void hashed_list_free(HashedList *hl) {
+    free_list(&hl->list);
+    hash_index_free(&hl->index);
+}
+
+// 23. List Stats: O(1)
+// Takes a snapshot of the instrumentation counters (see common/stats.h) and adds the
+// length. The counters only move in builds with -DDS_STATS; otherwise they stay 0.
+// Time complexity: O(1), the handle stores the length.
+void list_stats(const List *list, DsStats *stats) {
+    ds_stats_snapshot(stats);
+    stats->length = list->length;
+}
+
+// Merges the sorted chains a and b (NULL-terminated, a first on ties) and returns the head;
+// *tail receives the last node. a_tail and b_tail are the last nodes of a and b.
+static Node* merge_chains(Node *a, Node *a_tail, Node *b, Node *b_tail, Node **tail) {
+    if (a != NULL && b != NULL && a_tail->data <= b->data) {
+        a_tail->next = b;  // Already in order: one link, no walk
+        *tail = b_tail;
+        return a;
+    }
+    Node head;  // Dummy node in front of the merged chain
+    Node *last = &head;
+    while (a != NULL && b != NULL) {
+        STAT_VISIT(1);
+        if (b->data < a->data) {
+            last->next = b;
+            last = b;
+            b = b->next;
+        } else {
+            last->next = a;
+            last = a;
+            a = a->next;
+        }
+    }
+    last->next = a != NULL ? a : b;
+    *tail = a != NULL ? a_tail : b != NULL ? b_tail : last;
+    return head.next;
+}
+
+// 24. Sort List: O(n log n)
+// Sorts the nodes by value, smallest first, by relinking them: no node is allocated, copied
+// or freed. Bottom-up merge sort with a binary counter: slot i holds a sorted chain of 2^i
+// nodes; each node taken off the list enters as a chain of 1 and carries upwards like a
+// binary increment. The merges mostly touch recently visited nodes, and equal values keep
+// their order (stable). Chains already in order are joined with one link, so a sorted list
+// takes O(n). Unlike merge_sort in tricks.py, nothing is sliced or copied.
+// Time complexity: O(n log n) comparisons, O(1) extra memory (32 slot pointers).
+void sort_list(List *list) {
+    Node *slot_head[SORT_LIST_SLOTS] = { NULL };
+    Node *slot_tail[SORT_LIST_SLOTS];
+    Node *node = list->head;
+    while (node != NULL) {
+        Node *next = node->next;
+        Node *run = node;
+        Node *run_tail = node;
+        node->next = NULL;
+        int i = 0;
+        for (; slot_head[i] != NULL; i++) {
+            run = merge_chains(slot_head[i], slot_tail[i], run, run_tail, &run_tail);  // Carry
+            slot_head[i] = NULL;
+        }
+        slot_head[i] = run;
+        slot_tail[i] = run_tail;
+        node = next;
+    }
+    // Higher slots hold earlier nodes, so each one goes in front of the merge of the lower ones
+    Node *head = NULL;
+    Node *tail = NULL;
+    for (int i = 0; i < SORT_LIST_SLOTS; i++) {
+        if (slot_head[i] != NULL) {
+            head = merge_chains(slot_head[i], slot_tail[i], head, tail, &tail);
+        }
+    }
+    list->head = head;
+    list->tail = tail;
+}
+
 // --- Exercise ---
 // Problem: Given a singly linked list, find the maximum element.
 // For simplicity, we assume the list has at least one element.
 void exercise_solution() {
     // Example list for the exercise
-    Node *head = NULL;
+    List list;
+    init_list(&list);
 
     // Add some elements to the list
-    append(&head, 5);
-    append(&head, 10);
-    append(&head, 3);
-    append(&head, 99);
-    append(&head, 65);
-    append(&head, 2);
-    append(&head, 43);
-    append(&head, 76);
+    append(&list, 5);
+    append(&list, 10);
+    append(&list, 3);
+    append(&list, 99);
+    append(&list, 65);
+    append(&list, 2);
+    append(&list, 43);
+    append(&list, 76);
 
     // Initialize max with the first element
-    int max = head->data;
+    int max = list.head->data;
 
     // Traverse the list to find the maximum
-    Node *temp = head;
+    Node *temp = list.head;
     while (temp != NULL) {
         if (temp->data > max) {
             max = temp->data;  // Update max if a larger element is found
@@ -286,14 +790,25 @@ void exercise_solution() {
     printf("The maximum element in the linked list is: %d\n", max);
 
     // Free the list memory after use
-    free_list(&head);
+    free_list(&list);
 }
 
 // --- Big O Summary ---
 // 1. Create Node: O(1) - Creating a node takes constant time.
-// 2. Append Operation: O(n) - Traversing to the end of the list takes linear time.
-// 3. Insert at Index: O(n) - Traversing to the specific index takes linear time.
+// 2. Append Operation: O(1) - The tail pointer gives direct access to the last node.
+// 3. Insert at Index: O(n) - Traversing to the specific index takes linear time (O(1) at index 0 or length).
 // 4. Delete at Index: O(n) - Traversing to the specific index takes linear time.
 // 5. Find Element: O(n) - Searching for an element takes linear time.
 // 6. Update Element: O(n) - Traversing to the index takes linear time.
 // 7. Free List: O(n) - Freeing each node takes linear time.
+// 8. Destroy Pool: O(b) - Releasing the arena costs one free per slab block, not per node.
+// 9. Length / Bounds Check: O(1) - The handle stores the number of nodes.
+// 10. Append Many / Insert Many: O(k) plus one walk to the index - A batch is spliced in as one chain.
+// 11. Ingest List: O(n) - One pass over the file, appended in batches.
+// 12. Print / Dump List: O(n) - Formatted into one buffer, one write(2) per MiB.
+// 13. Hashed Find: O(1) expected - One hash index lookup instead of a walk.
+// 14. Hashed Append: O(1) expected - One index entry changes.
+// 15. Hashed Insert / Delete / Update at Index: O(n) - The walk to the index; the index update is O(1)
+//     expected (plus a forward walk when the first node of a duplicated value goes).
+// 16. List Stats: O(1) - A copy of the counters; with -DDS_STATS each walk adds one count per node.
+// 17. Sort List: O(n log n) - Stable bottom-up merge sort that relinks nodes, O(1) extra memory.
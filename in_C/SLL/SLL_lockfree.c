@@ -0,0 +1,297 @@
+// This C program demonstrates a lock-free sorted singly linked list that many threads can
+// use at the same time, explaining each operation in detail along with its Big O complexity.
+// The list is a set of ints kept in ascending order (Harris / Michael algorithm):
+// - Every change is a single compare-and-swap (CAS) on one next pointer, so no thread ever
+//   waits for a lock, and a thread that stalls cannot block the others.
+// - A node is deleted in two steps. First its own next pointer gets a mark bit (logical
+//   delete), which stops anybody from linking after it. Then it is unlinked from its
+//   predecessor, by the deleting thread or by any traversal that passes it.
+// - An unlinked node may still be read by threads that were already walking over it, so it
+//   is not freed right away. Epoch-based reclamation (common/ebr.h) frees it only after
+//   every thread that could have seen it has finished its operation.
+//
+// Build:  gcc -O2 -pthread SLL_lockfree.c -o SLL_lockfree
+
+// --- Includes Section ---
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include "../common/ebr.h"  // Epoch-based reclamation of unlinked nodes
+
+// --- Struct Definitions ---
+typedef struct LfNode {
+    EbrNode ebr;                   // Reclamation header, must stay the first member
+    int key;                       // Key stored in the node (the list is sorted by key)
+    _Atomic(uintptr_t) next;       // Pointer to the next node; the low bit marks THIS node deleted
+} LfNode;
+
+// Nodes are at least 8-byte aligned, so bit 0 of a node pointer is free for the mark.
+#define LF_MARK ((uintptr_t)1)
+
+// Each thread registers with the list's EBR domain and passes its EbrThread record around.
+typedef EbrThread LfThread;
+
+typedef struct LfList {
+    LfNode head;                   // Sentinel before the first node; its key is never read
+    EbrDomain ebr;                 // Epochs and limbo lists of the registered threads
+} LfList;
+
+// --- Function Declarations ---
+void lf_init(LfList *list);
+LfThread* lf_register(LfList *list);
+int lf_insert(LfList *list, LfThread *self, int key);
+int lf_remove(LfList *list, LfThread *self, int key);
+int lf_contains(LfList *list, LfThread *self, int key);
+int lf_size(const LfList *list);
+void lf_print(const LfList *list);
+void lf_destroy(LfList *list);
+
+// --- Main Function ---
+// Benchmarks include this file with DS_NO_MAIN defined to reuse the list operations.
+#ifndef DS_NO_MAIN
+#define DEMO_THREADS 4
+
+typedef struct DemoArgs {
+    LfList *list;
+    int id;
+} DemoArgs;
+
+// Each thread inserts the keys id, id + 4, id + 8, ... below 40, then removes its multiples of 3.
+static void* demo_worker(void *arg) {
+    DemoArgs *args = (DemoArgs*)arg;
+    LfThread *self = lf_register(args->list);
+    for (int key = args->id; key < 40; key += DEMO_THREADS) {
+        lf_insert(args->list, self, key);
+    }
+    for (int key = args->id; key < 40; key += DEMO_THREADS) {
+        if (key % 3 == 0) {
+            lf_remove(args->list, self, key);
+        }
+    }
+    return NULL;
+}
+
+int main() {
+    LfList list;
+    lf_init(&list);
+
+    // 1. Concurrent Insert and Remove: O(n) per operation
+    // Four threads fill the list in interleaved order and remove the multiples of 3.
+    pthread_t threads[DEMO_THREADS];
+    DemoArgs args[DEMO_THREADS];
+    for (int i = 0; i < DEMO_THREADS; i++) {
+        args[i].list = &list;
+        args[i].id = i;
+        pthread_create(&threads[i], NULL, demo_worker, &args[i]);
+    }
+    for (int i = 0; i < DEMO_THREADS; i++) {
+        pthread_join(threads[i], NULL);
+    }
+    printf("List after %d threads inserted 0..39 and removed the multiples of 3:\n", DEMO_THREADS);
+    lf_print(&list);
+    printf("Size: %d\n", lf_size(&list));
+
+    // 2. Contains and Set Semantics: O(n)
+    LfThread *self = lf_register(&list);
+    printf("\nContains 10: %s, contains 12: %s\n", lf_contains(&list, self, 10) ? "yes" : "no",
+           lf_contains(&list, self, 12) ? "yes" : "no");
+    printf("Insert 10 again: %s\n", lf_insert(&list, self, 10) ? "inserted" : "already present");
+
+    // Free every node, including the ones still waiting in limbo
+    lf_destroy(&list);
+
+    return 0;
+}
+#endif // DS_NO_MAIN
+
+// --- Marked Pointer Helpers ---
+
+static inline LfNode* lf_ptr(uintptr_t link) {
+    return (LfNode*)(link & ~LF_MARK);
+}
+
+static inline int lf_marked(uintptr_t link) {
+    return (int)(link & LF_MARK);
+}
+
+// --- Lock-Free List Operations ---
+
+// 1. Init List: O(1)
+// This function sets up an empty list with no registered threads. Not thread-safe.
+// Time complexity: O(EBR_MAX_THREADS).
+void lf_init(LfList *list) {
+    list->head.key = 0;
+    atomic_init(&list->head.next, (uintptr_t)0);
+    ebr_init(&list->ebr);
+}
+
+// 2. Register Thread: O(1)
+// Every thread calls this once before using the list and passes the returned record to
+// each operation. The record lives until lf_destroy.
+// Time complexity: O(1).
+LfThread* lf_register(LfList *list) {
+    return ebr_register(&list->ebr);
+}
+
+// Finds the first node with key >= key, unlinking (and retiring) every marked node on the
+// way. *prev_out receives the link that pointed to the returned node when it was checked,
+// so a CAS on it succeeds only if nothing changed in between. Restarts from the head when
+// a CAS fails or the predecessor was deleted under it.
+// Time complexity: O(n).
+static LfNode* lf_search(LfList *list, LfThread *self, int key, _Atomic(uintptr_t) **prev_out) {
+retry:;
+    _Atomic(uintptr_t) *prev = &list->head.next;
+    LfNode *curr = lf_ptr(atomic_load(prev));
+    while (curr != NULL) {
+        uintptr_t next = atomic_load(&curr->next);
+        if (lf_marked(next)) {
+            // curr is logically deleted: help by unlinking it
+            uintptr_t expected = (uintptr_t)curr;
+            if (!atomic_compare_exchange_strong(prev, &expected, next & ~LF_MARK)) {
+                goto retry;
+            }
+            ebr_retire(&list->ebr, self, &curr->ebr);
+            curr = lf_ptr(next);
+            continue;
+        }
+        // curr must still be linked from prev, otherwise the view is stale
+        if (atomic_load(prev) != (uintptr_t)curr) {
+            goto retry;
+        }
+        if (curr->key >= key) {
+            break;
+        }
+        prev = &curr->next;
+        curr = lf_ptr(next);
+    }
+    *prev_out = prev;
+    return curr;
+}
+
+// 3. Insert: O(n)
+// Links a new node between the predecessor and the first larger node with one CAS.
+// Returns 1 if the key was inserted, 0 if it was already present.
+// Time complexity: O(n), retried only when another thread changed the same link.
+int lf_insert(LfList *list, LfThread *self, int key) {
+    LfNode *node = (LfNode*)malloc(sizeof(LfNode));
+    if (!node) {
+        printf("Memory allocation error!\n");
+        exit(1);
+    }
+    node->key = key;
+
+    ebr_enter(&list->ebr, self);
+    for (;;) {
+        _Atomic(uintptr_t) *prev;
+        LfNode *curr = lf_search(list, self, key, &prev);
+        if (curr != NULL && curr->key == key) {
+            ebr_exit(self);
+            free(node);  // Never published, so it can be freed directly
+            return 0;
+        }
+        atomic_store(&node->next, (uintptr_t)curr);
+        uintptr_t expected = (uintptr_t)curr;
+        if (atomic_compare_exchange_strong(prev, &expected, (uintptr_t)node)) {
+            ebr_exit(self);
+            return 1;
+        }
+    }
+}
+
+// 4. Remove: O(n)
+// Marks the node's next pointer (the linearization point), then tries to unlink it.
+// If the unlink CAS fails, another search unlinks it instead.
+// Returns 1 if this call removed the key, 0 if it was not present.
+// Time complexity: O(n).
+int lf_remove(LfList *list, LfThread *self, int key) {
+    ebr_enter(&list->ebr, self);
+    for (;;) {
+        _Atomic(uintptr_t) *prev;
+        LfNode *curr = lf_search(list, self, key, &prev);
+        if (curr == NULL || curr->key != key) {
+            ebr_exit(self);
+            return 0;
+        }
+        uintptr_t next = atomic_load(&curr->next);
+        if (lf_marked(next)) {
+            continue;  // Another thread is removing it; search again to help
+        }
+        if (!atomic_compare_exchange_strong(&curr->next, &next, next | LF_MARK)) {
+            continue;  // The successor changed or someone marked it first
+        }
+        uintptr_t expected = (uintptr_t)curr;
+        if (atomic_compare_exchange_strong(prev, &expected, next)) {
+            ebr_retire(&list->ebr, self, &curr->ebr);
+        } else {
+            lf_search(list, self, key, &prev);  // Let the search unlink it
+        }
+        ebr_exit(self);
+        return 1;
+    }
+}
+
+// 5. Contains: O(n)
+// Read-only walk that never writes and never restarts: it ignores marks on the way and
+// only checks that the node it stops at is not marked.
+// Time complexity: O(n), wait-free.
+int lf_contains(LfList *list, LfThread *self, int key) {
+    ebr_enter(&list->ebr, self);
+    LfNode *curr = lf_ptr(atomic_load(&list->head.next));
+    while (curr != NULL && curr->key < key) {
+        curr = lf_ptr(atomic_load(&curr->next));
+    }
+    int found = curr != NULL && curr->key == key && !lf_marked(atomic_load(&curr->next));
+    ebr_exit(self);
+    return found;
+}
+
+// 6. Size: O(n)
+// Counts the unmarked nodes. Only exact while no other thread is changing the list.
+// Time complexity: O(n).
+int lf_size(const LfList *list) {
+    int count = 0;
+    for (LfNode *curr = lf_ptr(atomic_load(&list->head.next)); curr != NULL;
+         curr = lf_ptr(atomic_load(&curr->next))) {
+        count += !lf_marked(atomic_load(&curr->next));
+    }
+    return count;
+}
+
+// 7. Print List: O(n)
+// Prints the unmarked keys. Only meaningful while no other thread is changing the list.
+// Time complexity: O(n).
+void lf_print(const LfList *list) {
+    for (LfNode *curr = lf_ptr(atomic_load(&list->head.next)); curr != NULL;
+         curr = lf_ptr(atomic_load(&curr->next))) {
+        if (!lf_marked(atomic_load(&curr->next))) {
+            printf("%d -> ", curr->key);
+        }
+    }
+    printf("NULL\n");
+}
+
+// 8. Destroy List: O(n)
+// Frees every node still in the list and every node waiting in a limbo list.
+// All threads must have stopped using the list.
+// Time complexity: O(n + retired nodes).
+void lf_destroy(LfList *list) {
+    LfNode *curr = lf_ptr(atomic_load(&list->head.next));
+    while (curr != NULL) {
+        LfNode *next = lf_ptr(atomic_load(&curr->next));
+        free(curr);
+        curr = next;
+    }
+    atomic_store(&list->head.next, (uintptr_t)0);
+    ebr_destroy(&list->ebr);
+}
+
+// --- Big O Summary ---
+// 1. Init / Register: O(1) - Registration is one atomic increment.
+// 2. Insert: O(n) - One search plus one CAS; retried only on contention on the same link.
+// 3. Remove: O(n) - One search, a CAS to mark, a CAS to unlink.
+// 4. Contains: O(n) - Wait-free, never writes shared memory except the thread's own epoch.
+// 5. Reclamation: O(retired) every EBR_COLLECT_EVERY retires; a node is freed once the
+//    global epoch is two past its tag, so a thread stuck inside an operation delays frees.
+// 6. Size / Print / Destroy: O(n) - Quiescent only (no concurrent writers).
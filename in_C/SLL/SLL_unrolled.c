@@ -0,0 +1,318 @@
+// This C program demonstrates an unrolled singly linked list, explaining each operation
+// in detail along with its Big O complexity.
+// In SLL_FIRTS.c every node holds one int and an 8 byte pointer, so half of the memory is
+// pointers and every element costs a cache miss. Here every node is one 64 byte block that
+// holds up to 13 ints, so a scan reads mostly contiguous data and the pointer overhead is
+// shared by the whole block.
+
+// --- Includes Section ---
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../common/slab.h"  // Shared fixed-size node allocator
+
+// --- Struct Definitions ---
+// Number of ints per node, chosen so a node is exactly 64 bytes: 8 (next) + 4 (count) + 13 * 4.
+#define UNROLLED_CAPACITY 13
+
+typedef struct UnrolledNode {
+    struct UnrolledNode *next;       // Pointer to the next block
+    int count;                       // Number of ints used in this block (1..UNROLLED_CAPACITY)
+    int data[UNROLLED_CAPACITY];     // Elements, in list order
+} UnrolledNode;
+
+// List handle with the same role as List in SLL_FIRTS.c.
+typedef struct UnrolledList {
+    UnrolledNode *head;    // First block (NULL when empty)
+    UnrolledNode *tail;    // Last block (NULL when empty)
+    int length;            // Number of elements, not blocks
+} UnrolledList;
+
+// --- Node Pool ---
+// Blocks are carved from this slab pool; main releases the whole arena at once. The pool
+// is 64-byte aligned, so every block fills exactly one cache line instead of straddling two.
+static SlabPool unrolled_pool = SLAB_POOL_INIT_ALIGNED(sizeof(UnrolledNode), 64);
+
+// --- Function Declarations ---
+UnrolledNode* unrolled_create_node(void);
+void unrolled_init(UnrolledList *list);
+void unrolled_append(UnrolledList *list, int data);
+void unrolled_insert_at(UnrolledList *list, int index, int data);
+void unrolled_delete_at(UnrolledList *list, int index);
+int* unrolled_find(const UnrolledList *list, int data);
+void unrolled_update_at(UnrolledList *list, int index, int new_data);
+void unrolled_print(const UnrolledList *list);
+void unrolled_free(UnrolledList *list);
+
+// --- Main Function ---
+// Benchmarks include this file with DS_NO_MAIN defined to reuse the list operations.
+#ifndef DS_NO_MAIN
+int main() {
+    // Unrolled List Initialization: O(1)
+    UnrolledList list;
+    unrolled_init(&list);
+
+    // 1. Append Operation: O(1)
+    // Append 1..30; the blocks fill up completely, so this takes 3 blocks instead of 30 nodes.
+    for (int i = 1; i <= 30; i++) {
+        unrolled_append(&list, i * 10);
+    }
+    printf("Initial Unrolled List:\n");
+    unrolled_print(&list);
+
+    // 2. Insert Operation: O(n / B)
+    // Inserting into a full block splits it in two.
+    printf("\nInserting 25 at index 2:\n");
+    unrolled_insert_at(&list, 2, 25);
+    unrolled_print(&list);
+
+    // 3. Delete Operation: O(n / B)
+    printf("\nDeleting element at index 4:\n");
+    unrolled_delete_at(&list, 4);
+    unrolled_print(&list);
+
+    // 4. Find Operation: O(n)
+    printf("\nFinding element 40 in the list:\n");
+    if (unrolled_find(&list, 40) != NULL) {
+        printf("Element 40 found in the list.\n");
+    } else {
+        printf("Element 40 not found.\n");
+    }
+
+    // 5. Update Operation: O(n / B)
+    printf("\nUpdating element at index 3 to 99:\n");
+    unrolled_update_at(&list, 3, 99);
+    unrolled_print(&list);
+
+    // Free the memory used by the list
+    unrolled_free(&list);
+    slab_destroy(&unrolled_pool);
+
+    return 0;
+}
+#endif // DS_NO_MAIN
+
+// --- Unrolled List Operations ---
+
+// 1. Create Node: O(1)
+// This function creates an empty block.
+// Time complexity: O(1).
+UnrolledNode* unrolled_create_node(void) {
+    UnrolledNode *node = (UnrolledNode*)slab_alloc(&unrolled_pool);
+    node->next = NULL;
+    node->count = 0;
+    return node;
+}
+
+// 2. Init List: O(1)
+// This function sets up an empty list handle.
+// Time complexity: O(1).
+void unrolled_init(UnrolledList *list) {
+    list->head = NULL;
+    list->tail = NULL;
+    list->length = 0;
+}
+
+// Finds the block holding element `index` (0 <= index < length) and turns index into
+// the position inside that block. Optionally returns the block before it.
+// Time complexity: O(n / B), one step per block.
+static UnrolledNode* unrolled_locate(const UnrolledList *list, int *index, UnrolledNode **prev) {
+    UnrolledNode *before = NULL;
+    UnrolledNode *node = list->head;
+    while (*index >= node->count) {
+        *index -= node->count;
+        before = node;
+        node = node->next;
+    }
+    if (prev != NULL) {
+        *prev = before;
+    }
+    return node;
+}
+
+// 3. Append Operation: O(1)
+// The element goes into the tail block, or into a new block when the tail is full.
+// Time complexity: O(1).
+void unrolled_append(UnrolledList *list, int data) {
+    if (list->tail == NULL || list->tail->count == UNROLLED_CAPACITY) {
+        UnrolledNode *node = unrolled_create_node();
+        if (list->tail == NULL) {
+            list->head = node;
+        } else {
+            list->tail->next = node;
+        }
+        list->tail = node;
+    }
+    list->tail->data[list->tail->count++] = data;
+    list->length++;
+}
+
+// 4. Insert at Index: O(n / B)
+// Walks block by block to the target block. If it has room, the elements after the insert
+// point move one slot right inside the block. If it is full, the upper half moves into a
+// new block first, so both halves have room again.
+// Time complexity: O(n / B) to find the block, plus O(B) to shift inside it.
+void unrolled_insert_at(UnrolledList *list, int index, int data) {
+    // Check the bounds against the stored length
+    if (index < 0 || index > list->length) {
+        printf("Error: Index out of bounds.\n");
+        return;
+    }
+
+    // Inserting at the end is an append
+    if (index == list->length) {
+        unrolled_append(list, data);
+        return;
+    }
+
+    int pos = index;
+    UnrolledNode *node = unrolled_locate(list, &pos, NULL);
+
+    // Split a full block: the upper half moves to a new block right after it
+    if (node->count == UNROLLED_CAPACITY) {
+        UnrolledNode *right = unrolled_create_node();
+        int keep = UNROLLED_CAPACITY / 2;
+        right->count = UNROLLED_CAPACITY - keep;
+        memcpy(right->data, &node->data[keep], (size_t)right->count * sizeof(int));
+        node->count = keep;
+        right->next = node->next;
+        node->next = right;
+        if (list->tail == node) {
+            list->tail = right;
+        }
+        if (pos > keep) {
+            pos -= keep;  // The insert point is in the new block
+            node = right;
+        }
+    }
+
+    // Shift the rest of the block and insert
+    memmove(&node->data[pos + 1], &node->data[pos], (size_t)(node->count - pos) * sizeof(int));
+    node->data[pos] = data;
+    node->count++;
+    list->length++;
+}
+
+// 5. Delete at Index: O(n / B)
+// Removes the element from its block. An empty block is unlinked, and a block that falls
+// below half full is merged with the next one when both fit in one block, so blocks stay
+// at least half full on average.
+// Time complexity: O(n / B) to find the block, plus O(B) to shift inside it.
+void unrolled_delete_at(UnrolledList *list, int index) {
+    // If the list is empty
+    if (list->head == NULL) {
+        printf("Error: List is empty.\n");
+        return;
+    }
+
+    // Check the bounds against the stored length
+    if (index < 0 || index >= list->length) {
+        printf("Error: Index out of bounds.\n");
+        return;
+    }
+
+    int pos = index;
+    UnrolledNode *prev;
+    UnrolledNode *node = unrolled_locate(list, &pos, &prev);
+
+    // Remove the element inside the block
+    memmove(&node->data[pos], &node->data[pos + 1], (size_t)(node->count - pos - 1) * sizeof(int));
+    node->count--;
+    list->length--;
+
+    if (node->count == 0) {
+        // Unlink the empty block
+        if (prev == NULL) {
+            list->head = node->next;
+        } else {
+            prev->next = node->next;
+        }
+        if (list->tail == node) {
+            list->tail = prev;
+        }
+        slab_free(&unrolled_pool, node);
+        return;
+    }
+
+    // Merge with the next block when this one is less than half full and both fit
+    UnrolledNode *next = node->next;
+    if (node->count < UNROLLED_CAPACITY / 2 && next != NULL && node->count + next->count <= UNROLLED_CAPACITY) {
+        memcpy(&node->data[node->count], next->data, (size_t)next->count * sizeof(int));
+        node->count += next->count;
+        node->next = next->next;
+        if (list->tail == next) {
+            list->tail = node;
+        }
+        slab_free(&unrolled_pool, next);
+    }
+}
+
+// 6. Find Element: O(n)
+// Scans every block; inside a block the ints are contiguous, so the inner loop runs over
+// one cache line. Returns a pointer to the first matching element, or NULL.
+// The pointer stays valid until the next insert or delete.
+// Time complexity: O(n), but with about n / B cache misses instead of n.
+int* unrolled_find(const UnrolledList *list, int data) {
+    for (UnrolledNode *node = list->head; node != NULL; node = node->next) {
+        for (int i = 0; i < node->count; i++) {
+            if (node->data[i] == data) {
+                return &node->data[i];
+            }
+        }
+    }
+    return NULL;
+}
+
+// 7. Update Element at Index: O(n / B)
+// Time complexity: O(n / B), one step per block.
+void unrolled_update_at(UnrolledList *list, int index, int new_data) {
+    if (index < 0 || index >= list->length) {
+        printf("Error: Index out of bounds.\n");
+        return;
+    }
+    int pos = index;
+    UnrolledNode *node = unrolled_locate(list, &pos, NULL);
+    node->data[pos] = new_data;
+}
+
+// 8. Print List: O(n)
+// Prints the elements, with | between blocks so the layout is visible.
+// Time complexity: O(n).
+void unrolled_print(const UnrolledList *list) {
+    printf("[");
+    for (UnrolledNode *node = list->head; node != NULL; node = node->next) {
+        for (int i = 0; i < node->count; i++) {
+            printf("%d", node->data[i]);
+            if (i < node->count - 1) {
+                printf(" ");
+            }
+        }
+        if (node->next != NULL) {
+            printf(" | ");
+        }
+    }
+    printf("]\n");
+}
+
+// 9. Free List: O(n / B)
+// Returns every block to the pool's free list and empties the handle.
+// Time complexity: O(n / B).
+void unrolled_free(UnrolledList *list) {
+    UnrolledNode *node = list->head;
+    while (node != NULL) {
+        UnrolledNode *next = node->next;
+        slab_free(&unrolled_pool, node);
+        node = next;
+    }
+    unrolled_init(list);
+}
+
+// --- Big O Summary --- (B = UNROLLED_CAPACITY elements per block)
+// 1. Create Node: O(1) - One slab slot per block.
+// 2. Append Operation: O(1) - Fills the tail block, or starts a new one.
+// 3. Insert at Index: O(n / B + B) - Walk the blocks, then shift inside one block (maybe after a split).
+// 4. Delete at Index: O(n / B + B) - Walk the blocks, then shift inside one block (maybe merge).
+// 5. Find Element: O(n) - But only about n / B cache misses.
+// 6. Update Element: O(n / B) - Walk the blocks, then index directly.
+// 7. Free List: O(n / B) - One free per block.
+// Memory: about 4.9 bytes per element for full blocks, versus 16 bytes in SLL_FIRTS.c.
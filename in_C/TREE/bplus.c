@@ -0,0 +1,481 @@
+// This C program demonstrates a B+ tree, an ordered index that keeps many keys per node.
+// Compared with the binary TreeNode in simple.c (one key and two child pointers per node,
+// one cache miss per level), a B+ tree node stores its keys contiguously, so one or two
+// cache lines answer a whole level, and the tree is only log_32(n) levels deep.
+// All keys live in the leaves, and the leaves are linked left to right for range scans.
+
+// --- Includes Section ---
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../common/slab.h"  // Shared fixed-size node allocator
+
+// --- Struct Definitions ---
+// Maximum number of keys in one node. With 4 byte keys and a 4 byte header, the key
+// part of a node is exactly 128 bytes (two cache lines).
+#define BPT_MAX_KEYS 31
+// Every node except the root keeps at least this many keys.
+#define BPT_MIN_KEYS (BPT_MAX_KEYS / 2)
+
+// Common header of leaves and internal nodes.
+typedef struct BPlusNode {
+    short is_leaf;             // 1 for a leaf, 0 for an internal node
+    short count;               // Number of keys currently stored
+    int keys[BPT_MAX_KEYS];    // Sorted keys, stored contiguously
+} BPlusNode;
+
+// Internal node: keys[i] separates children[i] (keys < keys[i]) from children[i + 1] (keys >= keys[i]).
+typedef struct BPlusInner {
+    BPlusNode base;
+    BPlusNode *children[BPT_MAX_KEYS + 1];  // count + 1 children
+} BPlusInner;
+
+// Leaf node: holds the actual keys and a link to the next leaf.
+typedef struct BPlusLeaf {
+    BPlusNode base;
+    struct BPlusLeaf *next;    // Next leaf in key order (NULL for the last leaf)
+} BPlusLeaf;
+
+// The tree handle owns its node pools, so freeing the tree releases whole slabs.
+typedef struct BPlusTree {
+    BPlusNode *root;           // Root node (NULL when the tree was never used)
+    BPlusLeaf *first;          // Leftmost leaf, gives find_min in O(1)
+    long size;                 // Number of keys in the tree
+    SlabPool leaf_pool;        // Pool for BPlusLeaf nodes
+    SlabPool inner_pool;       // Pool for BPlusInner nodes
+} BPlusTree;
+
+// Callback used by range scans.
+typedef void (*BPlusVisit)(int key, void *ctx);
+
+// --- Function Declarations ---
+void bpt_init(BPlusTree *tree);
+int bpt_insert(BPlusTree *tree, int key);
+int bpt_find(const BPlusTree *tree, int key);
+int bpt_delete(BPlusTree *tree, int key);
+int bpt_find_min(const BPlusTree *tree, int *out);
+long bpt_range(const BPlusTree *tree, int lo, int hi, BPlusVisit visit, void *ctx);
+int bpt_height(const BPlusTree *tree);
+void bpt_free(BPlusTree *tree);
+
+// --- Main Function ---
+// Benchmarks include this file with DS_NO_MAIN defined to reuse the tree operations.
+#ifndef DS_NO_MAIN
+static void print_key(int key, void *ctx) {
+    (void)ctx;
+    printf("%d -> ", key);
+}
+
+int main() {
+    // B+ Tree Initialization: O(1)
+    BPlusTree tree;
+    bpt_init(&tree);
+
+    // 1. Insert Operation: O(log n)
+    // Insert 1..100 in a scrambled order; 37 is coprime with 100 so every key appears once.
+    for (int i = 0; i < 100; i++) {
+        bpt_insert(&tree, (i * 37) % 100 + 1);
+    }
+    printf("Inserted 100 keys, height %d, size %ld\n", bpt_height(&tree), tree.size);
+
+    // 2. Find Operation: O(log n)
+    printf("\nFinding element 40 in the tree:\n");
+    if (bpt_find(&tree, 40)) {
+        printf("Element 40 found in the tree.\n");
+    } else {
+        printf("Element 40 not found in the tree.\n");
+    }
+
+    // 3. Range Scan: O(log n + k)
+    printf("\nKeys in [20, 30]:\n");
+    bpt_range(&tree, 20, 30, print_key, NULL);
+    printf("NULL\n");
+
+    // 4. Delete Operation: O(log n)
+    printf("\nDeleting 1..90:\n");
+    for (int key = 1; key <= 90; key++) {
+        bpt_delete(&tree, key);
+    }
+    bpt_range(&tree, 0, 1000, print_key, NULL);
+    printf("NULL\n");
+
+    // 5. Find Minimum: O(1)
+    int min;
+    if (bpt_find_min(&tree, &min)) {
+        printf("\nMinimum key: %d, height %d, size %ld\n", min, bpt_height(&tree), tree.size);
+    }
+
+    // Free the tree memory
+    bpt_free(&tree);
+
+    return 0;
+}
+#endif // DS_NO_MAIN
+
+// --- B+ Tree Helpers ---
+
+// Number of keys in the node that are smaller than key (first slot >= key).
+// The loop has no early exit, so the compiler can vectorize it over the contiguous keys.
+static int bpt_lower_bound(const BPlusNode *node, int key) {
+    int pos = 0;
+    for (int i = 0; i < node->count; i++) {
+        pos += node->keys[i] < key;
+    }
+    return pos;
+}
+
+// Number of keys in the node that are smaller than or equal to key (child to descend into).
+static int bpt_upper_bound(const BPlusNode *node, int key) {
+    int pos = 0;
+    for (int i = 0; i < node->count; i++) {
+        pos += node->keys[i] <= key;
+    }
+    return pos;
+}
+
+static BPlusLeaf* bpt_new_leaf(BPlusTree *tree) {
+    BPlusLeaf *leaf = (BPlusLeaf*)slab_alloc(&tree->leaf_pool);
+    leaf->base.is_leaf = 1;
+    leaf->base.count = 0;
+    leaf->next = NULL;
+    return leaf;
+}
+
+static BPlusInner* bpt_new_inner(BPlusTree *tree) {
+    BPlusInner *inner = (BPlusInner*)slab_alloc(&tree->inner_pool);
+    inner->base.is_leaf = 0;
+    inner->base.count = 0;
+    return inner;
+}
+
+// Walks down to the leaf that would contain key.
+static const BPlusLeaf* bpt_find_leaf(const BPlusTree *tree, int key) {
+    const BPlusNode *node = tree->root;
+    if (node == NULL) {
+        return NULL;
+    }
+    while (!node->is_leaf) {
+        node = ((const BPlusInner*)node)->children[bpt_upper_bound(node, key)];
+    }
+    return (const BPlusLeaf*)node;
+}
+
+// Inserts key below node. Returns 1 when node was split; the new right sibling and the
+// separator to add to the parent are returned through up_node and up_key.
+static int bpt_insert_rec(BPlusTree *tree, BPlusNode *node, int key, int *inserted,
+                          int *up_key, BPlusNode **up_node) {
+    if (node->is_leaf) {
+        int pos = bpt_lower_bound(node, key);
+        if (pos < node->count && node->keys[pos] == key) {
+            return 0;  // Duplicate keys are ignored, like the binary tree does
+        }
+        *inserted = 1;
+
+        if (node->count < BPT_MAX_KEYS) {
+            memmove(&node->keys[pos + 1], &node->keys[pos], (size_t)(node->count - pos) * sizeof(int));
+            node->keys[pos] = key;
+            node->count++;
+            return 0;
+        }
+
+        // Leaf is full: split the BPT_MAX_KEYS + 1 keys into two halves
+        int all[BPT_MAX_KEYS + 1];
+        memcpy(all, node->keys, (size_t)pos * sizeof(int));
+        all[pos] = key;
+        memcpy(&all[pos + 1], &node->keys[pos], (size_t)(BPT_MAX_KEYS - pos) * sizeof(int));
+
+        BPlusLeaf *leaf = (BPlusLeaf*)node;
+        BPlusLeaf *right = bpt_new_leaf(tree);
+        int left_count = (BPT_MAX_KEYS + 1) / 2;
+        memcpy(node->keys, all, (size_t)left_count * sizeof(int));
+        node->count = (short)left_count;
+        memcpy(right->base.keys, &all[left_count], (size_t)(BPT_MAX_KEYS + 1 - left_count) * sizeof(int));
+        right->base.count = (short)(BPT_MAX_KEYS + 1 - left_count);
+        right->next = leaf->next;
+        leaf->next = right;
+
+        *up_key = right->base.keys[0];  // First key of the right leaf is copied up
+        *up_node = &right->base;
+        return 1;
+    }
+
+    BPlusInner *inner = (BPlusInner*)node;
+    int idx = bpt_upper_bound(node, key);
+    int child_key;
+    BPlusNode *child_node;
+    if (!bpt_insert_rec(tree, inner->children[idx], key, inserted, &child_key, &child_node)) {
+        return 0;
+    }
+
+    // The child was split: add its separator and new sibling at position idx
+    if (node->count < BPT_MAX_KEYS) {
+        memmove(&node->keys[idx + 1], &node->keys[idx], (size_t)(node->count - idx) * sizeof(int));
+        memmove(&inner->children[idx + 2], &inner->children[idx + 1],
+                (size_t)(node->count - idx) * sizeof(BPlusNode*));
+        node->keys[idx] = child_key;
+        inner->children[idx + 1] = child_node;
+        node->count++;
+        return 0;
+    }
+
+    // Internal node is full: split it and move the middle key up
+    int all_keys[BPT_MAX_KEYS + 1];
+    BPlusNode *all_children[BPT_MAX_KEYS + 2];
+    memcpy(all_keys, node->keys, (size_t)idx * sizeof(int));
+    all_keys[idx] = child_key;
+    memcpy(&all_keys[idx + 1], &node->keys[idx], (size_t)(BPT_MAX_KEYS - idx) * sizeof(int));
+    memcpy(all_children, inner->children, (size_t)(idx + 1) * sizeof(BPlusNode*));
+    all_children[idx + 1] = child_node;
+    memcpy(&all_children[idx + 2], &inner->children[idx + 1], (size_t)(BPT_MAX_KEYS - idx) * sizeof(BPlusNode*));
+
+    BPlusInner *right = bpt_new_inner(tree);
+    int mid = (BPT_MAX_KEYS + 1) / 2;
+    memcpy(node->keys, all_keys, (size_t)mid * sizeof(int));
+    memcpy(inner->children, all_children, (size_t)(mid + 1) * sizeof(BPlusNode*));
+    node->count = (short)mid;
+    memcpy(right->base.keys, &all_keys[mid + 1], (size_t)(BPT_MAX_KEYS - mid) * sizeof(int));
+    memcpy(right->children, &all_children[mid + 1], (size_t)(BPT_MAX_KEYS - mid + 1) * sizeof(BPlusNode*));
+    right->base.count = (short)(BPT_MAX_KEYS - mid);
+
+    *up_key = all_keys[mid];  // The middle key moves up, it is not kept in either half
+    *up_node = &right->base;
+    return 1;
+}
+
+// Merges children[idx + 1] into children[idx] and removes the separator keys[idx].
+static void bpt_merge(BPlusTree *tree, BPlusInner *parent, int idx) {
+    BPlusNode *left = parent->children[idx];
+    BPlusNode *right = parent->children[idx + 1];
+
+    if (left->is_leaf) {
+        memcpy(&left->keys[left->count], right->keys, (size_t)right->count * sizeof(int));
+        left->count += right->count;
+        ((BPlusLeaf*)left)->next = ((BPlusLeaf*)right)->next;
+        slab_free(&tree->leaf_pool, right);
+    } else {
+        BPlusInner *l = (BPlusInner*)left;
+        BPlusInner *r = (BPlusInner*)right;
+        left->keys[left->count] = parent->base.keys[idx];  // The separator comes down
+        memcpy(&left->keys[left->count + 1], right->keys, (size_t)right->count * sizeof(int));
+        memcpy(&l->children[left->count + 1], r->children, (size_t)(right->count + 1) * sizeof(BPlusNode*));
+        left->count += right->count + 1;
+        slab_free(&tree->inner_pool, right);
+    }
+
+    int count = parent->base.count;
+    memmove(&parent->base.keys[idx], &parent->base.keys[idx + 1], (size_t)(count - idx - 1) * sizeof(int));
+    memmove(&parent->children[idx + 1], &parent->children[idx + 2], (size_t)(count - idx - 1) * sizeof(BPlusNode*));
+    parent->base.count--;
+}
+
+// Refills children[idx] after it dropped below BPT_MIN_KEYS, by borrowing one key
+// from a sibling that can spare it, or by merging with a sibling.
+static void bpt_fix_child(BPlusTree *tree, BPlusInner *parent, int idx) {
+    BPlusNode *child = parent->children[idx];
+    BPlusNode *left = idx > 0 ? parent->children[idx - 1] : NULL;
+    BPlusNode *right = idx < parent->base.count ? parent->children[idx + 1] : NULL;
+
+    if (left != NULL && left->count > BPT_MIN_KEYS) {
+        // Borrow the last key of the left sibling
+        memmove(&child->keys[1], child->keys, (size_t)child->count * sizeof(int));
+        if (child->is_leaf) {
+            child->keys[0] = left->keys[left->count - 1];
+            parent->base.keys[idx - 1] = child->keys[0];
+        } else {
+            BPlusInner *c = (BPlusInner*)child;
+            memmove(&c->children[1], c->children, (size_t)(child->count + 1) * sizeof(BPlusNode*));
+            child->keys[0] = parent->base.keys[idx - 1];
+            c->children[0] = ((BPlusInner*)left)->children[left->count];
+            parent->base.keys[idx - 1] = left->keys[left->count - 1];
+        }
+        child->count++;
+        left->count--;
+    } else if (right != NULL && right->count > BPT_MIN_KEYS) {
+        // Borrow the first key of the right sibling
+        if (child->is_leaf) {
+            child->keys[child->count] = right->keys[0];
+            memmove(right->keys, &right->keys[1], (size_t)(right->count - 1) * sizeof(int));
+            parent->base.keys[idx] = right->keys[0];
+        } else {
+            BPlusInner *c = (BPlusInner*)child;
+            BPlusInner *r = (BPlusInner*)right;
+            child->keys[child->count] = parent->base.keys[idx];
+            c->children[child->count + 1] = r->children[0];
+            parent->base.keys[idx] = right->keys[0];
+            memmove(right->keys, &right->keys[1], (size_t)(right->count - 1) * sizeof(int));
+            memmove(r->children, &r->children[1], (size_t)right->count * sizeof(BPlusNode*));
+        }
+        child->count++;
+        right->count--;
+    } else if (left != NULL) {
+        bpt_merge(tree, parent, idx - 1);
+    } else {
+        bpt_merge(tree, parent, idx);
+    }
+}
+
+// Deletes key below node. Returns 1 if the key was found.
+static int bpt_delete_rec(BPlusTree *tree, BPlusNode *node, int key) {
+    if (node->is_leaf) {
+        int pos = bpt_lower_bound(node, key);
+        if (pos >= node->count || node->keys[pos] != key) {
+            return 0;
+        }
+        memmove(&node->keys[pos], &node->keys[pos + 1], (size_t)(node->count - pos - 1) * sizeof(int));
+        node->count--;
+        return 1;
+    }
+
+    BPlusInner *inner = (BPlusInner*)node;
+    int idx = bpt_upper_bound(node, key);
+    if (!bpt_delete_rec(tree, inner->children[idx], key)) {
+        return 0;
+    }
+    if (inner->children[idx]->count < BPT_MIN_KEYS) {
+        bpt_fix_child(tree, inner, idx);
+    }
+    return 1;
+}
+
+// --- B+ Tree Operations ---
+
+// 1. Init Tree: O(1)
+// This function sets up an empty tree. No memory is allocated until the first insert.
+// Time complexity: O(1).
+void bpt_init(BPlusTree *tree) {
+    tree->root = NULL;
+    tree->first = NULL;
+    tree->size = 0;
+    slab_init(&tree->leaf_pool, sizeof(BPlusLeaf));
+    slab_init(&tree->inner_pool, sizeof(BPlusInner));
+}
+
+// 2. Insert Operation: O(log n)
+// This function inserts a key, splitting full nodes on the way back up.
+// Returns 1 if the key was added, 0 if it was already present.
+// Time complexity: O(log n); each level costs one node split at most.
+int bpt_insert(BPlusTree *tree, int key) {
+    if (tree->root == NULL) {
+        tree->first = bpt_new_leaf(tree);
+        tree->root = &tree->first->base;
+    }
+
+    int inserted = 0;
+    int up_key;
+    BPlusNode *up_node;
+    if (bpt_insert_rec(tree, tree->root, key, &inserted, &up_key, &up_node)) {
+        // The root was split: grow the tree by one level
+        BPlusInner *root = bpt_new_inner(tree);
+        root->base.keys[0] = up_key;
+        root->base.count = 1;
+        root->children[0] = tree->root;
+        root->children[1] = up_node;
+        tree->root = &root->base;
+    }
+    tree->size += inserted;
+    return inserted;
+}
+
+// 3. Find Operation: O(log n)
+// This function returns 1 if the key is in the tree, 0 otherwise.
+// Time complexity: O(log n), about two cache lines of keys per level.
+int bpt_find(const BPlusTree *tree, int key) {
+    const BPlusLeaf *leaf = bpt_find_leaf(tree, key);
+    if (leaf == NULL) {
+        return 0;
+    }
+    int pos = bpt_lower_bound(&leaf->base, key);
+    return pos < leaf->base.count && leaf->base.keys[pos] == key;
+}
+
+// 4. Delete Operation: O(log n)
+// This function removes a key, borrowing from or merging with siblings when a node gets
+// less than half full. Returns 1 if the key was removed, 0 if it was not found.
+// Time complexity: O(log n).
+int bpt_delete(BPlusTree *tree, int key) {
+    if (tree->root == NULL || !bpt_delete_rec(tree, tree->root, key)) {
+        return 0;
+    }
+
+    // An internal root left with a single child is replaced by that child
+    if (!tree->root->is_leaf && tree->root->count == 0) {
+        BPlusNode *old_root = tree->root;
+        tree->root = ((BPlusInner*)old_root)->children[0];
+        slab_free(&tree->inner_pool, old_root);
+    }
+    tree->size--;
+    return 1;
+}
+
+// 5. Find Minimum: O(1)
+// The smallest key is the first key of the leftmost leaf.
+// Returns 0 if the tree is empty.
+// Time complexity: O(1).
+int bpt_find_min(const BPlusTree *tree, int *out) {
+    if (tree->size == 0) {
+        return 0;
+    }
+    *out = tree->first->base.keys[0];
+    return 1;
+}
+
+// 6. Range Scan: O(log n + k)
+// This function calls visit for every key in [lo, hi] in ascending order and returns how
+// many keys it visited. It descends once, then follows the leaf links.
+// Time complexity: O(log n + k), where k is the number of keys in the range.
+long bpt_range(const BPlusTree *tree, int lo, int hi, BPlusVisit visit, void *ctx) {
+    const BPlusLeaf *leaf = bpt_find_leaf(tree, lo);
+    long visited = 0;
+    if (leaf == NULL) {
+        return 0;
+    }
+    int pos = bpt_lower_bound(&leaf->base, lo);
+    while (leaf != NULL) {
+        for (; pos < leaf->base.count; pos++) {
+            if (leaf->base.keys[pos] > hi) {
+                return visited;
+            }
+            if (visit != NULL) {
+                visit(leaf->base.keys[pos], ctx);
+            }
+            visited++;
+        }
+        leaf = leaf->next;
+        pos = 0;
+    }
+    return visited;
+}
+
+// 7. Height: O(log n)
+// Number of levels from the root to the leaves (0 for a tree that was never used).
+// Time complexity: O(log n).
+int bpt_height(const BPlusTree *tree) {
+    int height = 0;
+    const BPlusNode *node = tree->root;
+    while (node != NULL) {
+        height++;
+        node = node->is_leaf ? NULL : ((const BPlusInner*)node)->children[0];
+    }
+    return height;
+}
+
+// 8. Free Tree: O(b)
+// Every node lives in the tree's own pools, so the whole tree is released slab by slab.
+// Time complexity: O(b), where b is the number of slab blocks.
+void bpt_free(BPlusTree *tree) {
+    slab_destroy(&tree->leaf_pool);
+    slab_destroy(&tree->inner_pool);
+    tree->root = NULL;
+    tree->first = NULL;
+    tree->size = 0;
+}
+
+// --- Big O Summary ---
+// 1. Init Tree: O(1) - Only fills in the handle.
+// 2. Insert Operation: O(log n) - One root-to-leaf path, at most one split per level.
+// 3. Find Operation: O(log n) - log_32(n) levels, each one contiguous key array.
+// 4. Delete Operation: O(log n) - One root-to-leaf path, at most one borrow or merge per level.
+// 5. Find Minimum: O(1) - The leftmost leaf is kept in the handle.
+// 6. Range Scan: O(log n + k) - One descent, then a walk along the linked leaves.
+// 7. Height: O(log n) - Follows the leftmost path.
+// 8. Free Tree: O(b) - Releasing the arena costs one free per slab block, not per node.
@@ -0,0 +1,419 @@
+// This C program demonstrates a binary search tree that many threads can use at the same
+// time, explaining each operation in detail along with its Big O complexity.
+// It keeps the shape of TreeNode from simple.c (data, left, right) and adds:
+// - Lock-free readers: find never locks and never writes shared memory. It walks the
+//   child pointers with atomic loads, exactly like the loop in simple.c's find.
+// - Per-node writer locks: insert, delete and unlink lock only the one or two nodes whose
+//   links they change, so writers in different parts of the tree do not wait for each other.
+// - Logical deletion: delete first sets a `deleted` flag. A node with at most one child is
+//   then unlinked (its child takes its place); a node with two children stays as a routing
+//   node and is unlinked later, when it is down to one child. Nodes never move, there are
+//   no rotations, so a reader is never sent into the wrong subtree.
+// - Unlinked nodes are freed with epoch-based reclamation (common/ebr.h), once no reader
+//   can still be standing on them.
+//
+// Build:  gcc -O2 -pthread concurrent.c -o concurrent
+
+// --- Includes Section ---
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <sched.h>
+#include "../common/ebr.h"  // Epoch-based reclamation of unlinked nodes
+
+// --- Struct Definitions ---
+typedef struct CTreeNode {
+    EbrNode ebr;                       // Reclamation header, must stay the first member
+    int data;                          // Key stored in the node, never changes
+    atomic_int lock;                   // Writer spinlock (0 = free); readers never take it
+    atomic_int deleted;                // 1 when the key was deleted (the node may still route)
+    atomic_int removed;                // 1 once the node is unlinked from the tree
+    _Atomic(struct CTreeNode*) left;   // Pointer to the left child
+    _Atomic(struct CTreeNode*) right;  // Pointer to the right child
+} CTreeNode;
+
+// The root hangs off a sentinel's left link, so the root is changed like any other link.
+typedef struct CTree {
+    CTreeNode sentinel;                // Its data is never compared; the tree is its left child
+    EbrDomain ebr;                     // Epochs and limbo lists of the registered threads
+} CTree;
+
+// --- Function Declarations ---
+void ct_init(CTree *tree);
+EbrThread* ct_register(CTree *tree);
+int ct_insert(CTree *tree, EbrThread *self, int data);
+int ct_delete(CTree *tree, EbrThread *self, int data);
+int ct_find(CTree *tree, EbrThread *self, int data);
+int ct_size(const CTree *tree);
+void ct_inorder(const CTree *tree);
+void ct_destroy(CTree *tree);
+
+// --- Main Function ---
+// Benchmarks include this file with DS_NO_MAIN defined to reuse the tree operations.
+#ifndef DS_NO_MAIN
+#define DEMO_THREADS 4
+
+typedef struct DemoArgs {
+    CTree *tree;
+    int id;
+} DemoArgs;
+
+// Each thread inserts the keys k with k % 4 == id below 40 (in a scrambled order),
+// then deletes its multiples of 3.
+static void* demo_worker(void *arg) {
+    DemoArgs *args = (DemoArgs*)arg;
+    EbrThread *self = ct_register(args->tree);
+    for (int i = 0; i < 10; i++) {
+        ct_insert(args->tree, self, (i * 7 % 10) * DEMO_THREADS + args->id);
+    }
+    for (int key = args->id; key < 40; key += DEMO_THREADS) {
+        if (key % 3 == 0) {
+            ct_delete(args->tree, self, key);
+        }
+    }
+    return NULL;
+}
+
+int main() {
+    CTree tree;
+    ct_init(&tree);
+
+    // 1. Concurrent Insert and Delete: O(log n) on average per operation
+    pthread_t threads[DEMO_THREADS];
+    DemoArgs args[DEMO_THREADS];
+    for (int i = 0; i < DEMO_THREADS; i++) {
+        args[i].tree = &tree;
+        args[i].id = i;
+        pthread_create(&threads[i], NULL, demo_worker, &args[i]);
+    }
+    for (int i = 0; i < DEMO_THREADS; i++) {
+        pthread_join(threads[i], NULL);
+    }
+    printf("In-order after %d threads inserted 0..39 and deleted the multiples of 3:\n", DEMO_THREADS);
+    ct_inorder(&tree);
+    printf("Size: %d\n", ct_size(&tree));
+
+    // 2. Find and Set Semantics: O(log n) on average
+    EbrThread *self = ct_register(&tree);
+    printf("\nFind 10: %s, find 12: %s\n", ct_find(&tree, self, 10) ? "yes" : "no",
+           ct_find(&tree, self, 12) ? "yes" : "no");
+    printf("Insert 12: %s\n", ct_insert(&tree, self, 12) ? "inserted" : "already present");
+    printf("Insert 10 again: %s\n", ct_insert(&tree, self, 10) ? "inserted" : "already present");
+
+    // Free every node, including the ones still waiting in limbo
+    ct_destroy(&tree);
+
+    return 0;
+}
+#endif // DS_NO_MAIN
+
+// --- Helpers ---
+
+// Link to the child on side `dir` (0 = left, 1 = right).
+static inline _Atomic(CTreeNode*)* ct_link(CTreeNode *node, int dir) {
+    return dir ? &node->right : &node->left;
+}
+
+// Test-and-test-and-set spinlock that yields the CPU when it spins for long, so it also
+// behaves when there are more threads than cores.
+static inline void ct_lock(CTreeNode *node) {
+    int spins = 0;
+    for (;;) {
+        if (atomic_load_explicit(&node->lock, memory_order_relaxed) == 0 &&
+            atomic_exchange_explicit(&node->lock, 1, memory_order_acquire) == 0) {
+            return;
+        }
+        if (++spins == 64) {
+            spins = 0;
+            sched_yield();
+        }
+    }
+}
+
+static inline void ct_unlock(CTreeNode *node) {
+    atomic_store_explicit(&node->lock, 0, memory_order_release);
+}
+
+static CTreeNode* ct_create_node(int data) {
+    CTreeNode *node = (CTreeNode*)malloc(sizeof(CTreeNode));
+    if (!node) {
+        printf("Memory allocation error!\n");
+        exit(1);
+    }
+    node->data = data;
+    atomic_init(&node->lock, 0);
+    atomic_init(&node->deleted, 0);
+    atomic_init(&node->removed, 0);
+    atomic_init(&node->left, (CTreeNode*)NULL);
+    atomic_init(&node->right, (CTreeNode*)NULL);
+    return node;
+}
+
+// Walks down like simple.c's find. Returns the node holding data, or NULL; *parent and
+// *dir receive the node the walk came from and the side it took.
+// A walk that ends on an empty link of an unlinked node restarts from the root: the key
+// may have been inserted on the other side of the replacement since that node was read.
+// An empty link of a node that is still in the tree proves the key was absent at that moment,
+// because nodes never move and every key in the node's range lives below it.
+// Time complexity: O(h), restarted only when a concurrent unlink got in the way.
+static CTreeNode* ct_locate(CTree *tree, int data, CTreeNode **parent, int *dir) {
+retry:;
+    CTreeNode *prev = &tree->sentinel;
+    int side = 0;
+    CTreeNode *node = atomic_load(&prev->left);
+    while (node != NULL && node->data != data) {
+        prev = node;
+        side = data > node->data;
+        node = atomic_load(ct_link(node, side));
+    }
+    if (node == NULL && atomic_load(&prev->removed)) {
+        goto retry;
+    }
+    *parent = prev;
+    *dir = side;
+    return node;
+}
+
+// Number of children, read under the node's lock by the callers that need it exact.
+static inline int ct_children(CTreeNode *node) {
+    return (atomic_load(&node->left) != NULL) + (atomic_load(&node->right) != NULL);
+}
+
+// Unlinks the deleted node holding data if it has at most one child, by locking its parent
+// and then the node (always top-down, so two writers can never wait on each other in a
+// cycle). When the parent is itself a deleted routing node left with one child, it is
+// unlinked next.
+// Time complexity: O(h) per unlinked node.
+static void ct_unlink(CTree *tree, EbrThread *self, int data) {
+    for (;;) {
+        CTreeNode *parent;
+        int dir;
+        CTreeNode *node = ct_locate(tree, data, &parent, &dir);
+        if (node == NULL) {
+            return;
+        }
+        ct_lock(parent);
+        ct_lock(node);
+        if (atomic_load(&parent->removed) || atomic_load(ct_link(parent, dir)) != node) {
+            // The parent changed under us; look the node up again
+            ct_unlock(node);
+            ct_unlock(parent);
+            continue;
+        }
+        if (!atomic_load(&node->deleted) || atomic_load(&node->removed) || ct_children(node) == 2) {
+            // Re-inserted, already unlinked, or still needed for routing
+            ct_unlock(node);
+            ct_unlock(parent);
+            return;
+        }
+        CTreeNode *child = atomic_load(&node->left);
+        if (child == NULL) {
+            child = atomic_load(&node->right);
+        }
+        atomic_store(&node->removed, 1);  // Before the unlink, so readers can detect it
+        atomic_store(ct_link(parent, dir), child);
+        ct_unlock(node);
+        ct_unlock(parent);
+        ebr_retire(&tree->ebr, self, &node->ebr);
+
+        // The parent may now be a routing node with a single child
+        if (parent == &tree->sentinel || !atomic_load(&parent->deleted) || ct_children(parent) == 2) {
+            return;
+        }
+        data = parent->data;
+    }
+}
+
+// --- Concurrent Tree Operations ---
+
+// 1. Init Tree: O(1)
+// This function sets up an empty tree with no registered threads. Not thread-safe.
+// Time complexity: O(EBR_MAX_THREADS).
+void ct_init(CTree *tree) {
+    tree->sentinel.data = 0;
+    atomic_init(&tree->sentinel.lock, 0);
+    atomic_init(&tree->sentinel.deleted, 0);
+    atomic_init(&tree->sentinel.removed, 0);
+    atomic_init(&tree->sentinel.left, (CTreeNode*)NULL);
+    atomic_init(&tree->sentinel.right, (CTreeNode*)NULL);
+    ebr_init(&tree->ebr);
+}
+
+// 2. Register Thread: O(1)
+// Every thread calls this once before using the tree and passes the returned record to
+// each operation.
+// Time complexity: O(1).
+EbrThread* ct_register(CTree *tree) {
+    return ebr_register(&tree->ebr);
+}
+
+// 3. Insert Operation: O(log n) on average, O(n) in the worst case (unbalanced)
+// Walks down without locks. If the key's node is still there but deleted, it is revived
+// under its lock. Otherwise the parent of the empty link is locked and checked (still in
+// the tree, link still empty) before the new node is published. Any failed check restarts.
+// Returns 1 if the key was inserted, 0 if it was already present.
+// Time complexity: O(log n) on average, O(n) for unbalanced trees.
+int ct_insert(CTree *tree, EbrThread *self, int data) {
+    CTreeNode *fresh = NULL;
+    ebr_enter(&tree->ebr, self);
+    for (;;) {
+        CTreeNode *parent;
+        int dir;
+        CTreeNode *node = ct_locate(tree, data, &parent, &dir);
+        if (node != NULL) {
+            ct_lock(node);
+            if (atomic_load(&node->removed)) {
+                ct_unlock(node);
+                continue;  // Unlinked meanwhile; a new node is needed
+            }
+            int inserted = atomic_exchange(&node->deleted, 0);
+            ct_unlock(node);
+            ebr_exit(self);
+            free(fresh);  // Never published
+            return inserted;
+        }
+
+        if (fresh == NULL) {
+            fresh = ct_create_node(data);
+        }
+        ct_lock(parent);
+        if (atomic_load(&parent->removed) || atomic_load(ct_link(parent, dir)) != NULL) {
+            ct_unlock(parent);
+            continue;
+        }
+        atomic_store(ct_link(parent, dir), fresh);  // Publishes the fully built node
+        ct_unlock(parent);
+        ebr_exit(self);
+        return 1;
+    }
+}
+
+// 4. Delete Operation: O(log n) on average, O(n) in the worst case (unbalanced)
+// Sets the deleted flag under the node's lock (this is the moment the key disappears),
+// then unlinks the node if it has at most one child.
+// Returns 1 if this call deleted the key, 0 if it was not present.
+// Time complexity: O(log n) on average, O(n) for unbalanced trees.
+int ct_delete(CTree *tree, EbrThread *self, int data) {
+    ebr_enter(&tree->ebr, self);
+    for (;;) {
+        CTreeNode *parent;
+        int dir;
+        CTreeNode *node = ct_locate(tree, data, &parent, &dir);
+        if (node == NULL) {
+            ebr_exit(self);
+            return 0;
+        }
+        ct_lock(node);
+        if (atomic_load(&node->removed)) {
+            ct_unlock(node);
+            continue;
+        }
+        int deleted = !atomic_exchange(&node->deleted, 1);
+        int children = ct_children(node);
+        ct_unlock(node);
+        if (deleted && children < 2) {
+            ct_unlink(tree, self, data);
+        }
+        ebr_exit(self);
+        return deleted;
+    }
+}
+
+// 5. Find Operation: O(log n) on average, O(n) in the worst case (unbalanced)
+// Lock-free: atomic loads only, so any number of readers run in parallel with the writers.
+// Returns 1 if the key is present.
+// Time complexity: O(log n) on average, O(n) for unbalanced trees.
+int ct_find(CTree *tree, EbrThread *self, int data) {
+    ebr_enter(&tree->ebr, self);
+    CTreeNode *parent;
+    int dir;
+    CTreeNode *node = ct_locate(tree, data, &parent, &dir);
+    int found = node != NULL && !atomic_load(&node->deleted);
+    ebr_exit(self);
+    return found;
+}
+
+// Calls fn on every node reachable from the root, in order, with an explicit heap stack
+// (the tree is unbalanced, so its depth is not bounded by log n).
+static void ct_walk(const CTree *tree, void (*fn)(CTreeNode *node, void *ctx), void *ctx) {
+    int capacity = 64, size = 0;
+    CTreeNode **stack = (CTreeNode**)malloc((size_t)capacity * sizeof(CTreeNode*));
+    if (!stack) {
+        printf("Memory allocation error!\n");
+        exit(1);
+    }
+    CTreeNode *node = atomic_load(&tree->sentinel.left);
+    while (node != NULL || size > 0) {
+        while (node != NULL) {
+            if (size == capacity) {
+                capacity *= 2;
+                CTreeNode **grown = (CTreeNode**)realloc(stack, (size_t)capacity * sizeof(CTreeNode*));
+                if (!grown) {
+                    printf("Memory allocation error!\n");
+                    exit(1);
+                }
+                stack = grown;
+            }
+            stack[size++] = node;
+            node = atomic_load(&node->left);
+        }
+        node = stack[--size];
+        CTreeNode *right = atomic_load(&node->right);  // Read before fn, which may free the node
+        fn(node, ctx);
+        node = right;
+    }
+    free(stack);
+}
+
+static void ct_count_node(CTreeNode *node, void *ctx) {
+    *(int*)ctx += !atomic_load(&node->deleted);
+}
+
+static void ct_print_node(CTreeNode *node, void *ctx) {
+    (void)ctx;
+    if (!atomic_load(&node->deleted)) {
+        printf("%d ", node->data);
+    }
+}
+
+static void ct_free_node(CTreeNode *node, void *ctx) {
+    (void)ctx;
+    free(node);
+}
+
+// 6. Size: O(n)
+// Counts the keys that are present. Only exact while no other thread is changing the tree.
+// Time complexity: O(n).
+int ct_size(const CTree *tree) {
+    int count = 0;
+    ct_walk(tree, ct_count_node, &count);
+    return count;
+}
+
+// 7. In-order Print: O(n)
+// Prints the present keys in ascending order. Quiescent only, like ct_size.
+// Time complexity: O(n).
+void ct_inorder(const CTree *tree) {
+    ct_walk(tree, ct_print_node, NULL);
+    printf("\n");
+}
+
+// 8. Destroy Tree: O(n)
+// Frees every node in the tree and every node waiting in a limbo list.
+// All threads must have stopped using the tree.
+// Time complexity: O(n + retired nodes).
+void ct_destroy(CTree *tree) {
+    ct_walk(tree, ct_free_node, NULL);
+    atomic_store(&tree->sentinel.left, (CTreeNode*)NULL);
+    ebr_destroy(&tree->ebr);
+}
+
+// --- Big O Summary ---
+// 1. Init / Register: O(1) - Registration is one atomic increment.
+// 2. Insert: O(log n) average, O(n) worst - One lock-free walk, then one node locked.
+// 3. Delete: O(log n) average, O(n) worst - Flag under one lock, unlink under two.
+// 4. Find: O(log n) average, O(n) worst - Lock-free, restarts only after a concurrent unlink.
+// 5. Size / In-order / Destroy: O(n) - Quiescent only (no concurrent writers).
+// The tree is not rebalanced (rotations would move nodes under lock-free readers), so
+// like simple.c's insert it relies on keys arriving in random order.
@@ -5,6 +5,11 @@
 // --- Includes Section ---
 #include <stdio.h>
 #include <stdlib.h>
+#include <limits.h>
+#include "../common/slab.h"  // Shared fixed-size node allocator
+#include "../common/stats.h"  // Opt-in hot-path counters (compiled out by default)
+#include "../common/snapshot.h"  // mmap-able on-disk snapshots
+#include "../common/dump.h"  // Buffered output writer
 
 // --- Struct Definitions ---
 // Binary Tree: Each node contains data, a pointer to the left child, and a pointer
@@ -12,10 +17,80 @@
 
 typedef struct TreeNode {
     int data;                  // Data stored in the node
+    int height;                // Height of the subtree rooted here (leaf = 1), kept up to date by the AVL operations
+    int size;                  // Number of nodes in the subtree rooted here (leaf = 1), kept up to date by every update
     struct TreeNode *left;     // Pointer to the left child
     struct TreeNode *right;    // Pointer to the right child
 } TreeNode;
 
+// Callback used to stream nodes out of a traversal, instead of printing them.
+typedef void (*TreeVisit)(TreeNode *node, void *ctx);
+
+// Growable stack of nodes on the heap. The iterative traversals use it instead of the call
+// stack, so a degenerate tree of any depth cannot overflow the stack.
+typedef struct StackEntry {
+    TreeNode *node;            // Node waiting to be processed
+    int tag;                   // Per-algorithm state (depth, or whether children were pushed)
+} StackEntry;
+
+typedef struct NodeStack {
+    StackEntry *items;         // Heap array of entries
+    int size;                  // Number of entries in use
+    int capacity;              // Number of entries allocated
+} NodeStack;
+
+// In-order cursor: yields the nodes one at a time, in ascending key order.
+typedef struct TreeCursor {
+    NodeStack stack;           // Ancestors whose data has not been returned yet
+} TreeCursor;
+
+// Frozen tree: a read-only snapshot that keeps only the keys, in one int array, as a
+// complete binary tree of `levels` levels. A node is found from its BFS index (root = 1,
+// children 2i and 2i + 1) instead of child pointers. The array has 2^levels - 1 slots; the
+// slots past the real keys repeat the largest key, so the order stays sorted.
+#define FROZEN_MAX_LEVELS 32
+
+typedef enum FrozenLayout {
+    FROZEN_EYTZINGER,          // Slots in BFS order: slot = index - 1
+    FROZEN_VEB                 // Slots in van Emde Boas order (see freeze_tree)
+} FrozenLayout;
+
+typedef struct FrozenTree {
+    int *keys;                 // 2^levels - 1 keys in layout order, 64 byte aligned
+    int count;                 // Number of real keys
+    int levels;                // Height of the complete tree
+    FrozenLayout layout;
+    // vEB navigation, per depth d >= 1: a node at depth d is the root of a bottom tree of
+    // veb_bottom[d] nodes, which hangs below a top tree of veb_top[d] nodes rooted at depth veb_depth[d].
+    int veb_top[FROZEN_MAX_LEVELS];
+    int veb_bottom[FROZEN_MAX_LEVELS];
+    int veb_depth[FROZEN_MAX_LEVELS];
+} FrozenTree;
+
+// In-order cursor over a frozen tree. It keeps the slot of every node on the current
+// root-to-node path, which is all the vEB layout needs to move up and down.
+typedef struct FrozenCursor {
+    const FrozenTree *tree;
+    unsigned index;            // BFS index of the next node, 0 at the end
+    int depth;                 // Depth of that node (root = 0)
+    int slots[FROZEN_MAX_LEVELS];  // Slot of the node at each depth of the path
+} FrozenCursor;
+
+// One node in a tree snapshot file. The nodes are stored in preorder, so a left child is
+// always the record right after its parent; children are record indexes, not pointers.
+typedef struct TreeRecord {
+    int32_t data;
+    int32_t height;
+    int32_t size;
+    uint32_t left;             // Record index of the left child, or SNAPSHOT_NIL
+    uint32_t right;            // Record index of the right child, or SNAPSHOT_NIL
+} TreeRecord;
+
+// --- Node Pool ---
+// All nodes are carved from this slab pool instead of one malloc per node.
+// Deleted nodes go back on the pool's free list, and main releases the whole arena at once.
+static SlabPool node_pool = SLAB_POOL_INIT(sizeof(TreeNode));
+
 // --- Function Declarations ---
 TreeNode* create_node(int data);
 TreeNode* insert(TreeNode *root, int data);
@@ -25,10 +100,44 @@ TreeNode* find_min(TreeNode *root);
 void inorder_traversal(TreeNode *root);
 void preorder_traversal(TreeNode *root);
 void postorder_traversal(TreeNode *root);
+void dump_tree(TreeNode *root, DumpWriter *out);
 void exercise_solution();
 void free_tree(TreeNode *root);
+int node_height(TreeNode *node);
+int tree_height(TreeNode *root);
+TreeNode* rotate_left(TreeNode *root);
+TreeNode* rotate_right(TreeNode *root);
+TreeNode* rebalance(TreeNode *root);
+TreeNode* avl_insert(TreeNode *root, int data);
+TreeNode* avl_delete(TreeNode *root, int data);
+void inorder_visit(TreeNode *root, TreeVisit visit, void *ctx);
+void preorder_visit(TreeNode *root, TreeVisit visit, void *ctx);
+void postorder_visit(TreeNode *root, TreeVisit visit, void *ctx);
+void cursor_init(TreeCursor *cursor, TreeNode *root);
+TreeNode* cursor_next(TreeCursor *cursor);
+void cursor_free(TreeCursor *cursor);
+TreeNode* build_from_sorted(const int *keys, int n);
+int node_size(TreeNode *node);
+int tree_rank(TreeNode *root, int data);
+TreeNode* tree_select(TreeNode *root, int k);
+int range_count(TreeNode *root, int lo, int hi);
+void cursor_init_at(TreeCursor *cursor, TreeNode *root, int lo);
+int range_visit(TreeNode *root, int lo, int hi, TreeVisit visit, void *ctx);
+void freeze_tree(FrozenTree *frozen, TreeNode *root, FrozenLayout layout);
+void frozen_cursor_init_at(FrozenCursor *cursor, const FrozenTree *frozen, int lo);
+const int* frozen_cursor_next(FrozenCursor *cursor);
+const int* frozen_find(const FrozenTree *frozen, int data);
+const int* frozen_find_min(const FrozenTree *frozen);
+void frozen_free(FrozenTree *frozen);
+int save_tree(TreeNode *root, const char *path);
+int open_tree_snapshot(SnapshotView *view, const char *path, int verify);
+const TreeRecord* tree_snapshot_find(const SnapshotView *view, int data);
+TreeNode* load_tree(const SnapshotView *view);
+void tree_stats(TreeNode *root, DsStats *stats);
 
 // --- Main Function ---
+// Benchmarks include this file with DS_NO_MAIN defined to reuse the tree operations.
+#ifndef DS_NO_MAIN
 int main() {
     // Binary Tree Initialization: O(1)
     TreeNode *root = NULL;  // Start with an empty tree
@@ -72,6 +181,119 @@ int main() {
     root = delete(root, 70);
     inorder_traversal(root);  // Inorder traversal after deletion
 
+    // 5. Balanced (AVL) Insert and Delete: O(log n) guaranteed
+    // Sorted keys turn the plain tree into a linked list, the AVL tree stays balanced.
+    printf("\nInserting 10, 20, ..., 70 in sorted order:\n");
+    TreeNode *plain = NULL;
+    TreeNode *balanced = NULL;
+    for (int key = 10; key <= 70; key += 10) {
+        plain = insert(plain, key);
+        balanced = avl_insert(balanced, key);
+    }
+    printf("Plain tree height: %d, AVL tree height: %d\n", tree_height(plain), tree_height(balanced));
+    printf("AVL Preorder Traversal:\n");
+    preorder_traversal(balanced);
+
+    printf("\nDeleting 10 and 20 from the AVL tree:\n");
+    balanced = avl_delete(balanced, 10);
+    balanced = avl_delete(balanced, 20);
+    preorder_traversal(balanced);
+    printf("\nAVL tree height: %d\n", tree_height(balanced));
+#ifdef DS_STATS
+    // Instrumentation: built with -DDS_STATS (and -DDS_STATS_PERF for hardware counters)
+    // find(70) walks the whole chain of the plain tree but one short path of the AVL tree;
+    // inserting 80 and 90 then shows the rotations that keep the AVL tree that short.
+    printf("\nCounters for find(70) in the plain tree, then find(70) and inserting 80, 90 in the AVL tree:\n");
+    DsStats stats;
+    ds_stats_reset();
+    find(plain, 70);
+    tree_stats(plain, &stats);
+    ds_stats_print(&stats);
+    ds_stats_reset();
+    find(balanced, 70);
+    balanced = avl_insert(balanced, 80);
+    balanced = avl_insert(balanced, 90);
+    tree_stats(balanced, &stats);
+    ds_stats_print(&stats);
+#endif
+    free_tree(plain);
+    free_tree(balanced);
+
+    // 6. Cursor Iteration: O(n) for the whole tree, O(1) amortized per step
+    // The cursor streams the nodes in order without recursion or printing.
+    printf("\nSumming the tree with a cursor:\n");
+    TreeCursor cursor;
+    cursor_init(&cursor, root);
+    long sum = 0;
+    for (TreeNode *node = cursor_next(&cursor); node != NULL; node = cursor_next(&cursor)) {
+        sum += node->data;
+    }
+    cursor_free(&cursor);
+    printf("Sum of all keys: %ld\n", sum);
+
+    // 7. Bulk Build from a Sorted Array: O(n)
+    // The middle key becomes the root, so the tree is perfectly balanced with no rotations.
+    printf("\nBuilding a tree from the sorted keys 1..15:\n");
+    int sorted_keys[15];
+    for (int i = 0; i < 15; i++) {
+        sorted_keys[i] = i + 1;
+    }
+    TreeNode *built = build_from_sorted(sorted_keys, 15);
+    preorder_traversal(built);
+    printf("\nHeight: %d (log2(16) = 4)\n", tree_height(built));
+
+    // 8. Order Statistics and Range Queries: O(log n) or O(log n + k)
+    // Every node knows the size of its subtree, so counting and picking by position
+    // never has to walk the whole tree.
+    printf("\nRank of 8 (keys smaller than 8): %d\n", tree_rank(built, 8));
+    printf("5th smallest key (k = 4): %d\n", tree_select(built, 4)->data);
+    printf("Keys in [4, 9]: %d\n", range_count(built, 4, 9));
+    printf("Keys from 12 upwards, read with a cursor:\n");
+    cursor_init_at(&cursor, built, 12);
+    for (TreeNode *node = cursor_next(&cursor); node != NULL; node = cursor_next(&cursor)) {
+        printf("%d -> ", node->data);
+    }
+    cursor_free(&cursor);
+    printf("\n");
+
+    // 9. Frozen Layouts: freeze O(n), find O(log n), range scan O(log n + k)
+    // The snapshot keeps the keys only, 4 bytes each instead of a 32 byte node.
+    FrozenTree frozen;
+    freeze_tree(&frozen, built, FROZEN_VEB);
+    printf("\nFrozen vEB layout (%d levels):\n", frozen.levels);
+    for (int i = 0; i < (1 << frozen.levels) - 1; i++) {
+        printf("%d ", frozen.keys[i]);
+    }
+    printf("\nfind(11): %s, find_min: %d\n", frozen_find(&frozen, 11) ? "found" : "not found",
+           *frozen_find_min(&frozen));
+    printf("Keys in [5, 9]: ");
+    FrozenCursor frozen_cursor;
+    frozen_cursor_init_at(&frozen_cursor, &frozen, 5);
+    for (const int *key = frozen_cursor_next(&frozen_cursor); key != NULL && *key <= 9;
+         key = frozen_cursor_next(&frozen_cursor)) {
+        printf("%d ", *key);
+    }
+    printf("\n");
+    frozen_free(&frozen);
+
+    // 10. Snapshots: save O(n), open O(1), find on the file O(log n)
+    // The tree is saved to a file, mapped back and searched in place, then loaded.
+    printf("\nSaving the tree to tree.snap:\n");
+    SnapshotView view;
+    if (save_tree(built, "tree.snap") == 0 && open_tree_snapshot(&view, "tree.snap", 1) == 0) {
+        printf("%llu nodes on disk, find(6) in the file: %s\n",
+               (unsigned long long)view.header->count,
+               tree_snapshot_find(&view, 6) != NULL ? "found" : "not found");
+        TreeNode *loaded = load_tree(&view);
+        printf("Loaded tree preorder:\n");
+        preorder_traversal(loaded);
+        printf("\n");
+        free_tree(loaded);
+        snapshot_close(&view);
+        remove("tree.snap");
+    }
+    free_tree(built);
+
     // --- Exercise Demonstration ---
     printf("\n--- Exercise Solution ---\n");
     exercise_solution();
@@ -79,21 +301,67 @@ int main() {
     // Free the tree memory
     free_tree(root);
 
+    // Give every slab block back to malloc in one pass
+    slab_destroy(&node_pool);
+
     return 0;
 }
+#endif // DS_NO_MAIN
+
+// --- Stack Helpers ---
+
+// Pushes a node, doubling the heap array when it is full.
+static void stack_push(NodeStack *stack, TreeNode *node, int tag) {
+    if (stack->size == stack->capacity) {
+        int capacity = stack->capacity == 0 ? 64 : stack->capacity * 2;
+        StackEntry *items = (StackEntry*)realloc(stack->items, (size_t)capacity * sizeof(StackEntry));
+        if (!items) {
+            printf("Memory allocation error!\n");
+            exit(1);  // Exit if memory allocation fails
+        }
+        stack->items = items;
+        stack->capacity = capacity;
+    }
+    stack->items[stack->size].node = node;
+    stack->items[stack->size].tag = tag;
+    stack->size++;
+}
+
+// Pops the top entry. The caller checks that the stack is not empty.
+static StackEntry stack_pop(NodeStack *stack) {
+    return stack->items[--stack->size];
+}
+
+static void stack_free(NodeStack *stack) {
+    free(stack->items);
+    stack->items = NULL;
+    stack->size = 0;
+    stack->capacity = 0;
+}
+
+// Visit callback used by the printing traversals; ctx is the DumpWriter.
+static void print_node(TreeNode *node, void *ctx) {
+    DumpWriter *out = (DumpWriter*)ctx;
+    dump_int(out, node->data);
+    dump_text(out, " -> ");
+}
+
+// Visit callback used by dump_tree; ctx is the DumpWriter.
+static void dump_node(TreeNode *node, void *ctx) {
+    dump_value((DumpWriter*)ctx, node->data);
+}
 
 // --- Binary Tree Operations ---
 
 // 1. Create Node: O(1)
 // This function creates a new node with the given data.
+// The node comes from the slab pool, which exits on allocation failure.
 // Time complexity: O(1), since creating a node takes constant time.
 TreeNode* create_node(int data) {
-    TreeNode *new_node = (TreeNode*)malloc(sizeof(TreeNode));  // Allocate memory for the new node
-    if (!new_node) {
-        printf("Memory allocation error!\n");
-        exit(1);  // Exit if memory allocation fails
-    }
+    TreeNode *new_node = (TreeNode*)slab_alloc(&node_pool);  // Take a slot from the node pool
     new_node->data = data;    // Assign data
+    new_node->height = 1;     // A single node is a subtree of height 1
+    new_node->size = 1;       // ... and of size 1
     new_node->left = NULL;    // Initialize the left child to NULL
     new_node->right = NULL;   // Initialize the right child to NULL
     return new_node;          // Return the new node
@@ -101,73 +369,92 @@ TreeNode* create_node(int data) {
 
 // 2. Insert Operation: O(log n) on average, O(n) in the worst case (unbalanced)
 // This function inserts a new element into the binary search tree.
+// It walks down with a loop, keeping the address of the link to follow, so there is
+// no recursion even when the tree has degenerated into a long chain.
+// Every node on the path gains one descendant, so the walk bumps its size on the way down.
+// A duplicate is only discovered at the end of the path; then the bumps above it are undone
+// along the same path, so a new key costs one walk.
 // Time complexity: O(log n) on average for balanced trees, O(n) for unbalanced trees.
 TreeNode* insert(TreeNode *root, int data) {
-    // If the tree is empty, create a new node
-    if (root == NULL) {
-        return create_node(data);
-    }
+    TreeNode **link = &root;  // The pointer that will hold the new node
 
-    // Otherwise, insert the data into the correct position in the subtree
-    if (data < root->data) {
-        root->left = insert(root->left, data);  // Insert into the left subtree
-    } else if (data > root->data) {
-        root->right = insert(root->right, data);  // Insert into the right subtree
+    // Walk down to the empty link where the data belongs
+    while (*link != NULL) {
+        STAT_VISIT(1);
+        if ((*link)->data == data) {
+            // Duplicate keys are ignored: give back the sizes bumped above this node
+            for (TreeNode *node = root; node != *link; node = data < node->data ? node->left : node->right) {
+                STAT_VISIT(1);
+                node->size--;
+            }
+            return root;
+        }
+        (*link)->size++;  // The new node ends up below this one
+        link = data < (*link)->data ? &(*link)->left : &(*link)->right;
     }
 
-    return root;  // Return the root of the subtree
+    *link = create_node(data);
+    return root;  // Return the (possibly new) root of the tree
 }
 
 // 3. Find Operation: O(log n) on average, O(n) in the worst case (unbalanced)
-// This function finds an element in the binary search tree.
+// This function finds an element in the binary search tree with a loop.
 // Time complexity: O(log n) on average for balanced trees, O(n) for unbalanced trees.
 TreeNode* find(TreeNode *root, int data) {
-    // If the tree is empty or the data is found
-    if (root == NULL || root->data == data) {
-        return root;
-    }
-
-    // Search in the left or right subtree
-    if (data < root->data) {
-        return find(root->left, data);  // Search in the left subtree
-    } else {
-        return find(root->right, data);  // Search in the right subtree
+    // Stop when the tree runs out or the data is found
+    while (root != NULL && root->data != data) {
+        STAT_VISIT(1);
+        root = data < root->data ? root->left : root->right;
     }
+    STAT_VISIT(root != NULL);  // The node holding data
+    return root;
 }
 
 // 4. Delete Operation: O(log n) on average, O(n) in the worst case (unbalanced)
-// This function deletes an element from the binary search tree.
+// This function deletes an element from the binary search tree with loops only.
+// Like insert, it lowers the sizes on the way down in one walk; if the key is missing,
+// the same path is walked again to restore them.
 // Time complexity: O(log n) on average for balanced trees, O(n) for unbalanced trees.
 TreeNode* delete(TreeNode *root, int data) {
-    // If the tree is empty, return NULL
-    if (root == NULL) {
+    TreeNode **link = &root;  // The pointer that points at the current node
+
+    // Search for the node to delete; every node above it loses one descendant
+    while (*link != NULL && (*link)->data != data) {
+        STAT_VISIT(1);
+        (*link)->size--;
+        link = data < (*link)->data ? &(*link)->left : &(*link)->right;
+    }
+    if (*link == NULL) {
+        // Not found, nothing to delete: restore the sizes lowered on the way down
+        for (TreeNode *node = root; node != NULL; node = data < node->data ? node->left : node->right) {
+            STAT_VISIT(1);
+            node->size++;
+        }
         return root;
     }
 
-    // Search for the node to delete
-    if (data < root->data) {
-        root->left = delete(root->left, data);  // Search in the left subtree
-    } else if (data > root->data) {
-        root->right = delete(root->right, data);  // Search in the right subtree
-    } else {
-        // If the node is found
-        if (root->left == NULL) {
-            TreeNode *temp = root->right;
-            free(root);  // Free the current node
-            return temp;  // Return the right child
-        } else if (root->right == NULL) {
-            TreeNode *temp = root->left;
-            free(root);  // Free the current node
-            return temp;  // Return the left child
-        }
+    TreeNode *node = *link;
+    node->size--;
 
+    if (node->left != NULL && node->right != NULL) {
         // If the node has two children, find the in-order successor (smallest in the right subtree)
-        TreeNode *temp = find_min(root->right);
-        root->data = temp->data;  // Replace the current node's data with the in-order successor's data
-        root->right = delete(root->right, temp->data);  // Delete the in-order successor
+        TreeNode **succ_link = &node->right;
+        while ((*succ_link)->left != NULL) {
+            STAT_VISIT(1);
+            (*succ_link)->size--;  // The successor is removed from below this node
+            succ_link = &(*succ_link)->left;
+        }
+        TreeNode *succ = *succ_link;
+        node->data = succ->data;  // Replace the current node's data with the in-order successor's data
+        *succ_link = succ->right;  // The successor has no left child, unlink it
+        slab_free(&node_pool, succ);
+    } else {
+        // If the node has at most one child, the child takes its place
+        *link = node->left != NULL ? node->left : node->right;
+        slab_free(&node_pool, node);  // Free the current node
     }
 
-    return root;  // Return the root of the subtree
+    return root;  // Return the root of the tree
 }
 
 // 5. Find Minimum: O(log n) on average, O(n) in the worst case (unbalanced)
@@ -175,53 +462,878 @@ TreeNode* delete(TreeNode *root, int data) {
 // Time complexity: O(log n) on average for balanced trees, O(n) for unbalanced trees.
 TreeNode* find_min(TreeNode *root) {
     while (root->left != NULL) {
+        STAT_VISIT(1);
         root = root->left;
     }
     return root;
 }
 
 // 6. Inorder Traversal: O(n)
-// This function performs an in-order traversal of the tree.
+// This function prints an in-order traversal of the tree (see inorder_visit).
+// The text goes through the shared stdout writer (see common/dump.h), so printing a large
+// tree costs one write(2) per MiB instead of one printf per node.
 // Time complexity: O(n), where n is the number of nodes in the tree.
 void inorder_traversal(TreeNode *root) {
-    if (root != NULL) {
-        inorder_traversal(root->left);    // Visit the left subtree
-        printf("%d -> ", root->data);     // Visit the root
-        inorder_traversal(root->right);   // Visit the right subtree
-    }
+    DumpWriter *out = dump_stdout();
+    inorder_visit(root, print_node, out);
+    dump_flush(out);
 }
 
 // 7. Preorder Traversal: O(n)
-// This function performs a pre-order traversal of the tree.
+// This function prints a pre-order traversal of the tree (see preorder_visit).
 // Time complexity: O(n), where n is the number of nodes in the tree.
 void preorder_traversal(TreeNode *root) {
-    if (root != NULL) {
-        printf("%d -> ", root->data);     // Visit the root
-        preorder_traversal(root->left);   // Visit the left subtree
-        preorder_traversal(root->right);  // Visit the right subtree
-    }
+    DumpWriter *out = dump_stdout();
+    preorder_visit(root, print_node, out);
+    dump_flush(out);
 }
 
 // 8. Postorder Traversal: O(n)
-// This function performs a post-order traversal of the tree.
+// This function prints a post-order traversal of the tree (see postorder_visit).
 // Time complexity: O(n), where n is the number of nodes in the tree.
 void postorder_traversal(TreeNode *root) {
-    if (root != NULL) {
-        postorder_traversal(root->left);  // Visit the left subtree
-        postorder_traversal(root->right); // Visit the right subtree
-        printf("%d -> ", root->data);     // Visit the root
-    }
+    DumpWriter *out = dump_stdout();
+    postorder_visit(root, print_node, out);
+    dump_flush(out);
 }
 
 // 9. Free Tree: O(n)
-// This function frees all the memory allocated for the binary tree.
+// This function returns every node of the tree to the pool's free list.
+// It needs neither recursion nor a stack: while the root has a left child, a right
+// rotation moves that child up; once it has none, the root is freed and its right
+// child becomes the new root. Every rotation puts one more node on the right spine.
+// To release the memory itself, call slab_destroy(&node_pool) once all trees are done.
 // Time complexity: O(n), where n is the number of nodes in the tree.
 void free_tree(TreeNode *root) {
+    while (root != NULL) {
+        if (root->left != NULL) {
+            TreeNode *left = root->left;
+            root->left = left->right;  // Rotate right around root
+            left->right = root;
+            root = left;
+        } else {
+            TreeNode *right = root->right;
+            slab_free(&node_pool, root);  // Free the root
+            root = right;
+        }
+    }
+}
+
+// --- Balanced Tree (AVL) Operations ---
+// An AVL tree is a binary search tree where the heights of the two subtrees of every node
+// differ by at most one. After each insert or delete, the nodes on the path back to the
+// root are rebalanced with rotations, so the height stays below 1.44 * log2(n).
+// find, find_min, the traversals and free_tree work unchanged on AVL trees.
+
+// 10. Node Height: O(1)
+// This function returns the stored height of a subtree (0 for an empty subtree).
+// Time complexity: O(1).
+int node_height(TreeNode *node) {
+    return node == NULL ? 0 : node->height;
+}
+
+// 11. Tree Height: O(n)
+// This function measures the real height of any tree, balanced or not.
+// It walks the tree with a heap stack of (node, depth) pairs, so deep trees are fine.
+// Time complexity: O(n), where n is the number of nodes in the tree.
+int tree_height(TreeNode *root) {
+    NodeStack stack = {NULL, 0, 0};
+    int height = 0;
+    if (root != NULL) {
+        stack_push(&stack, root, 1);
+    }
+    while (stack.size > 0) {
+        StackEntry entry = stack_pop(&stack);
+        if (entry.tag > height) {
+            height = entry.tag;
+        }
+        if (entry.node->left != NULL) {
+            stack_push(&stack, entry.node->left, entry.tag + 1);
+        }
+        if (entry.node->right != NULL) {
+            stack_push(&stack, entry.node->right, entry.tag + 1);
+        }
+    }
+    stack_free(&stack);
+    return height;
+}
+
+// Recomputes a node's height and size from its children.
+static void update_node(TreeNode *node) {
+    int left = node_height(node->left);
+    int right = node_height(node->right);
+    node->height = 1 + (left > right ? left : right);
+    node->size = 1 + node_size(node->left) + node_size(node->right);
+}
+
+// 12. Rotate Left: O(1)
+// The right child becomes the root of the subtree, the old root becomes its left child.
+// Time complexity: O(1), only three pointers change.
+TreeNode* rotate_left(TreeNode *root) {
+    STAT_ROTATE();
+    TreeNode *new_root = root->right;
+    root->right = new_root->left;
+    new_root->left = root;
+    update_node(root);
+    update_node(new_root);
+    return new_root;
+}
+
+// 13. Rotate Right: O(1)
+// The left child becomes the root of the subtree, the old root becomes its right child.
+// Time complexity: O(1), only three pointers change.
+TreeNode* rotate_right(TreeNode *root) {
+    STAT_ROTATE();
+    TreeNode *new_root = root->left;
+    root->left = new_root->right;
+    new_root->right = root;
+    update_node(root);
+    update_node(new_root);
+    return new_root;
+}
+
+// 14. Rebalance: O(1)
+// Restores the AVL property at one node with a single or double rotation.
+// Time complexity: O(1).
+TreeNode* rebalance(TreeNode *root) {
+    update_node(root);
+    int balance = node_height(root->left) - node_height(root->right);
+
+    // Left side is too tall
+    if (balance > 1) {
+        if (node_height(root->left->left) < node_height(root->left->right)) {
+            root->left = rotate_left(root->left);  // Left-right case
+        }
+        return rotate_right(root);
+    }
+
+    // Right side is too tall
+    if (balance < -1) {
+        if (node_height(root->right->right) < node_height(root->right->left)) {
+            root->right = rotate_right(root->right);  // Right-left case
+        }
+        return rotate_left(root);
+    }
+
+    return root;  // Already balanced
+}
+
+// 15. AVL Insert: O(log n)
+// Same as insert, but every node on the way back up is rebalanced.
+// Time complexity: O(log n) in the worst case, even for sorted input.
+TreeNode* avl_insert(TreeNode *root, int data) {
+    // If the tree is empty, create a new node
+    if (root == NULL) {
+        return create_node(data);
+    }
+    STAT_VISIT(1);
+
+    if (data < root->data) {
+        root->left = avl_insert(root->left, data);  // Insert into the left subtree
+    } else if (data > root->data) {
+        root->right = avl_insert(root->right, data);  // Insert into the right subtree
+    } else {
+        return root;  // Duplicate keys are ignored, like insert does
+    }
+
+    return rebalance(root);
+}
+
+// 16. AVL Delete: O(log n)
+// Same as delete, but every node on the way back up is rebalanced.
+// Time complexity: O(log n) in the worst case.
+TreeNode* avl_delete(TreeNode *root, int data) {
+    // If the tree is empty, return NULL
+    if (root == NULL) {
+        return root;
+    }
+    STAT_VISIT(1);
+
+    // Search for the node to delete
+    if (data < root->data) {
+        root->left = avl_delete(root->left, data);  // Search in the left subtree
+    } else if (data > root->data) {
+        root->right = avl_delete(root->right, data);  // Search in the right subtree
+    } else {
+        // If the node has at most one child, replace it with that child
+        if (root->left == NULL || root->right == NULL) {
+            TreeNode *temp = root->left != NULL ? root->left : root->right;
+            slab_free(&node_pool, root);  // Free the current node
+            return temp;  // The child is already balanced
+        }
+
+        // If the node has two children, copy the in-order successor and delete it instead
+        TreeNode *temp = find_min(root->right);
+        root->data = temp->data;
+        root->right = avl_delete(root->right, temp->data);
+    }
+
+    return rebalance(root);
+}
+
+// --- Iterative Traversal and Cursor Operations ---
+// These functions stream nodes to a callback (or hand them out one by one) without
+// recursion and without printing. The callback must not insert or delete nodes.
+
+// 17. Inorder Visit: O(n)
+// Morris traversal: before going into a left subtree, the rightmost node of that subtree
+// gets a temporary thread back to the current node. Following the thread later replaces
+// the return that recursion would do. Every thread is removed again, so the tree is
+// unchanged at the end.
+// Time complexity: O(n), and O(1) extra memory.
+void inorder_visit(TreeNode *root, TreeVisit visit, void *ctx) {
+    TreeNode *current = root;
+    while (current != NULL) {
+        if (current->left == NULL) {
+            visit(current, ctx);  // No left subtree: visit and go right
+            current = current->right;
+            continue;
+        }
+
+        // Find the in-order predecessor (rightmost node of the left subtree)
+        TreeNode *pred = current->left;
+        while (pred->right != NULL && pred->right != current) {
+            pred = pred->right;
+        }
+
+        if (pred->right == NULL) {
+            pred->right = current;  // First time here: add the thread and go left
+            current = current->left;
+        } else {
+            pred->right = NULL;  // Back through the thread: remove it, visit, go right
+            visit(current, ctx);
+            current = current->right;
+        }
+    }
+}
+
+// 18. Preorder Visit: O(n)
+// Morris traversal again, but each node is visited when its thread is created.
+// Time complexity: O(n), and O(1) extra memory.
+void preorder_visit(TreeNode *root, TreeVisit visit, void *ctx) {
+    TreeNode *current = root;
+    while (current != NULL) {
+        if (current->left == NULL) {
+            visit(current, ctx);
+            current = current->right;
+            continue;
+        }
+
+        TreeNode *pred = current->left;
+        while (pred->right != NULL && pred->right != current) {
+            pred = pred->right;
+        }
+
+        if (pred->right == NULL) {
+            visit(current, ctx);  // Visit the root before its left subtree
+            pred->right = current;
+            current = current->left;
+        } else {
+            pred->right = NULL;
+            current = current->right;
+        }
+    }
+}
+
+// 19. Postorder Visit: O(n)
+// Uses a heap stack: a node is pushed once to schedule its children (tag 0) and
+// once more to be visited after both children are done (tag 1).
+// Time complexity: O(n), and O(h) extra memory on the heap.
+void postorder_visit(TreeNode *root, TreeVisit visit, void *ctx) {
+    NodeStack stack = {NULL, 0, 0};
+    if (root != NULL) {
+        stack_push(&stack, root, 0);
+    }
+    while (stack.size > 0) {
+        StackEntry entry = stack_pop(&stack);
+        if (entry.tag == 1) {
+            visit(entry.node, ctx);  // Both subtrees are done
+            continue;
+        }
+        stack_push(&stack, entry.node, 1);  // Visit the node after its children
+        if (entry.node->right != NULL) {
+            stack_push(&stack, entry.node->right, 0);
+        }
+        if (entry.node->left != NULL) {
+            stack_push(&stack, entry.node->left, 0);  // Pushed last, so done first
+        }
+    }
+    stack_free(&stack);
+}
+
+// Pushes node and its whole chain of left children.
+static void cursor_push_left(TreeCursor *cursor, TreeNode *node) {
+    while (node != NULL) {
+        STAT_VISIT(1);
+        stack_push(&cursor->stack, node, 0);
+        node = node->left;
+    }
+}
+
+// 20. Cursor Init: O(h)
+// This function positions a cursor before the smallest node of the tree.
+// Time complexity: O(h), where h is the height of the tree.
+void cursor_init(TreeCursor *cursor, TreeNode *root) {
+    cursor->stack.items = NULL;
+    cursor->stack.size = 0;
+    cursor->stack.capacity = 0;
+    cursor_push_left(cursor, root);
+}
+
+// 21. Cursor Next: O(1) amortized
+// This function returns the next node in ascending order, or NULL at the end.
+// Unlike Morris traversal it never modifies the tree, so the caller may stop at any time.
+// Time complexity: O(1) amortized, O(h) for a single step.
+TreeNode* cursor_next(TreeCursor *cursor) {
+    if (cursor->stack.size == 0) {
+        return NULL;
+    }
+    TreeNode *node = stack_pop(&cursor->stack).node;
+    cursor_push_left(cursor, node->right);  // The successor is the leftmost node on the right
+    return node;
+}
+
+// 22. Cursor Free: O(1)
+// This function releases the cursor's stack. The tree itself is not touched.
+// Time complexity: O(1).
+void cursor_free(TreeCursor *cursor) {
+    stack_free(&cursor->stack);
+}
+
+// --- Bulk Build ---
+
+// A subtree still to be built: keys[lo..hi) go below *link.
+typedef struct BuildRange {
+    int lo;
+    int hi;
+    TreeNode **link;
+} BuildRange;
+
+// 23. Build from Sorted Array: O(n)
+// This function builds a perfectly balanced tree from strictly increasing keys. The middle
+// key of every range becomes the subtree root, so the height is floor(log2(n)) + 1, and each
+// node stores that height and its subtree size, so the AVL operations and the order
+// statistics work on the result right away.
+// All n nodes come from one contiguous slab block (slab_alloc_array) and are laid out in
+// preorder: a search walks forward through memory and each left child sits right after
+// its parent. delete and free_tree give single nodes back to the pool as usual.
+// The ranges wait on a small fixed stack (at most height + 1 entries), no recursion.
+// Returns NULL (with an error message) if the keys are not strictly increasing.
+// Time complexity: O(n), against O(n log n) for n inserts in random order and O(n^2) sorted.
+TreeNode* build_from_sorted(const int *keys, int n) {
+    for (int i = 1; i < n; i++) {
+        if (keys[i - 1] >= keys[i]) {
+            printf("Error: Keys must be strictly increasing.\n");
+            return NULL;
+        }
+    }
+    if (n <= 0) {
+        return NULL;
+    }
+
+    TreeNode *nodes = (TreeNode*)slab_alloc_array(&node_pool, (size_t)n);
+    TreeNode *root = NULL;
+    BuildRange stack[64];  // An int-sized tree is at most 32 levels deep
+    int size = 0;
+    int next = 0;  // Next free node in the block, in preorder
+    stack[size++] = (BuildRange){0, n, &root};
+    while (size > 0) {
+        BuildRange range = stack[--size];
+        if (range.lo >= range.hi) {
+            *range.link = NULL;  // Empty subtree
+            continue;
+        }
+        int mid = range.lo + (range.hi - range.lo) / 2;
+        TreeNode *node = &nodes[next++];
+        node->data = keys[mid];
+        node->height = 0;
+        node->size = range.hi - range.lo;
+        for (int count = range.hi - range.lo; count > 0; count >>= 1) {
+            node->height++;  // A balanced subtree of m nodes has height bit_length(m)
+        }
+        *range.link = node;
+        stack[size++] = (BuildRange){mid + 1, range.hi, &node->right};
+        stack[size++] = (BuildRange){range.lo, mid, &node->left};  // Popped first: preorder
+    }
+    return root;
+}
+
+// --- Order Statistics and Range Queries ---
+// Every node stores the size of its subtree, so "how many keys are smaller than x" and
+// "which key is the k-th smallest" follow one root-to-leaf path instead of walking the
+// whole tree. insert, delete, the AVL operations and build_from_sorted keep the sizes
+// exact. The range functions start the in-order cursor at the first key >= lo, so they
+// only touch the keys they return plus one path.
+
+// 24. Node Size: O(1)
+// This function returns the stored size of a subtree (0 for an empty subtree).
+// Time complexity: O(1).
+int node_size(TreeNode *node) {
+    return node == NULL ? 0 : node->size;
+}
+
+// 25. Rank: O(h)
+// This function counts the keys smaller than data (data itself need not be in the tree).
+// Each step right skips the current node and its whole left subtree at once.
+// Time complexity: O(h), O(log n) for AVL trees, against O(n) for a counting traversal.
+int tree_rank(TreeNode *root, int data) {
+    int rank = 0;
+    while (root != NULL) {
+        STAT_VISIT(1);
+        if (data <= root->data) {
+            root = root->left;
+        } else {
+            rank += node_size(root->left) + 1;  // The left subtree and the node are all smaller
+            root = root->right;
+        }
+    }
+    return rank;
+}
+
+// 26. Select: O(h)
+// This function returns the node with the k-th smallest key, counting from 0, so
+// tree_select(root, tree_rank(root, x)) is the first key >= x.
+// Returns NULL (with an error message) if k is not in [0, size).
+// Time complexity: O(h), O(log n) for AVL trees.
+TreeNode* tree_select(TreeNode *root, int k) {
+    if (k < 0 || k >= node_size(root)) {
+        printf("Error: Index out of bounds.\n");
+        return NULL;
+    }
+    while (1) {
+        STAT_VISIT(1);
+        int left = node_size(root->left);
+        if (k < left) {
+            root = root->left;
+        } else if (k == left) {
+            return root;
+        } else {
+            k -= left + 1;  // Skip the left subtree and this node
+            root = root->right;
+        }
+    }
+}
+
+// 27. Range Count: O(h)
+// This function counts the keys in [lo, hi] as the difference of two ranks.
+// Time complexity: O(h), whatever the number of keys in the range.
+int range_count(TreeNode *root, int lo, int hi) {
+    if (lo > hi) {
+        return 0;
+    }
+    int below_hi = hi == INT_MAX ? node_size(root) : tree_rank(root, hi + 1);  // Keys <= hi
+    return below_hi - tree_rank(root, lo);
+}
+
+// 28. Cursor Init At: O(h)
+// This function positions a cursor before the first key >= lo, so cursor_next walks the
+// keys from lo upwards and the caller stops whenever it likes. The stack only holds the
+// nodes on the search path whose key is >= lo: exactly the ones still to be returned.
+// Time complexity: O(h), then O(1) amortized per cursor_next as usual.
+void cursor_init_at(TreeCursor *cursor, TreeNode *root, int lo) {
+    cursor->stack.items = NULL;
+    cursor->stack.size = 0;
+    cursor->stack.capacity = 0;
+    while (root != NULL) {
+        STAT_VISIT(1);
+        if (root->data >= lo) {
+            stack_push(&cursor->stack, root, 0);  // Returned after its left subtree
+            root = root->left;
+        } else {
+            root = root->right;  // This node and its left subtree are all below lo
+        }
+    }
+}
+
+// 29. Range Visit: O(h + k)
+// This function passes every node with a key in [lo, hi] to visit, in ascending order,
+// and returns how many there were. The callback must not insert or delete nodes.
+// Time complexity: O(h + k) for k keys in the range, against O(n) for a full traversal.
+int range_visit(TreeNode *root, int lo, int hi, TreeVisit visit, void *ctx) {
+    TreeCursor cursor;
+    cursor_init_at(&cursor, root, lo);
+    int count = 0;
+    for (TreeNode *node = cursor_next(&cursor); node != NULL && node->data <= hi;
+         node = cursor_next(&cursor)) {
+        visit(node, ctx);
+        count++;
+    }
+    cursor_free(&cursor);
+    return count;
+}
+
+// --- Frozen (Pointer-Free) Layouts ---
+// Snapshots that are only read do not need child pointers, which are 16 of the 32 bytes of
+// a TreeNode, and every level of a search jumps to an unrelated address. freeze_tree copies
+// the keys into one int array shaped as a complete binary tree, where each node's slot is
+// computed from its BFS index. Two slot orders are offered:
+//   Eytzinger: plain BFS order. The top levels share a few cache lines, and the 16 nodes
+//   four levels below index i are contiguous, so a search can prefetch them.
+//   van Emde Boas: the tree is cut at half its height, the top half is stored first and
+//   then each bottom subtree, every part laid out the same way recursively. Any subtree of
+//   height h sits in 2^h - 1 consecutive slots, so a search touches O(log_B n) blocks for
+//   every block size B at once (cache line, page) without knowing B: it is cache-oblivious.
+// Either way a key costs one 4 byte slot, plus at most n - 1 padding slots.
+
+// Fills the vEB tables for a subtree of `height` levels whose root is at `depth`.
+// The recursion is only log2(levels) deep.
+static void frozen_veb_split(FrozenTree *frozen, int depth, int height) {
+    if (height <= 1) {
+        return;
+    }
+    int top = height / 2;
+    int bottom = height - top;
+    frozen->veb_top[depth + top] = (1 << top) - 1;
+    frozen->veb_bottom[depth + top] = (1 << bottom) - 1;
+    frozen->veb_depth[depth + top] = depth;
+    frozen_veb_split(frozen, depth, top);
+    frozen_veb_split(frozen, depth + top, bottom);
+}
+
+// Slot of the cursor's node, given the slots of its ancestors.
+static int frozen_slot(const FrozenCursor *cursor) {
+    const FrozenTree *frozen = cursor->tree;
+    int depth = cursor->depth;
+    if (frozen->layout == FROZEN_EYTZINGER) {
+        return (int)cursor->index - 1;
+    }
+    if (depth == 0) {
+        return 0;
+    }
+    // The bottom trees follow their top tree from left to right, and the low bits of the
+    // index say which bottom tree this node is the root of
+    int top = frozen->veb_top[depth];
+    return cursor->slots[frozen->veb_depth[depth]] + top +
+           (int)(cursor->index & (unsigned)top) * frozen->veb_bottom[depth];
+}
+
+// Puts the cursor on the root.
+static void frozen_start(FrozenCursor *cursor, const FrozenTree *frozen) {
+    cursor->tree = frozen;
+    cursor->index = 1;
+    cursor->depth = 0;
+    cursor->slots[0] = 0;
+}
+
+// Moves the cursor to its left (0) or right (1) child.
+static void frozen_down(FrozenCursor *cursor, unsigned right) {
+    cursor->index = 2 * cursor->index + right;
+    cursor->depth++;
+    cursor->slots[cursor->depth] = frozen_slot(cursor);
+}
+
+// Moves the cursor to the in-order successor, or to the end (index 0).
+static void frozen_advance(FrozenCursor *cursor) {
+    int last = cursor->tree->levels - 1;
+    if (cursor->depth < last) {
+        frozen_down(cursor, 1);  // The successor is the leftmost node of the right subtree
+        while (cursor->depth < last) {
+            frozen_down(cursor, 0);
+        }
+    } else {
+        // A leaf: climb over the right turns, then one more level. The trailing one bits
+        // of the index are exactly those right turns; the slots above are still recorded.
+        int up = __builtin_ffs((int)~cursor->index);
+        cursor->index >>= up;
+        cursor->depth -= up;
+    }
+}
+
+// 30. Freeze Tree: O(n)
+// This function copies the keys of a tree into a new frozen snapshot with the given
+// layout. The tree is read with a cursor while a second cursor walks the empty array in
+// order, so each key lands in the slot its in-order position calls for. The tree is not
+// changed; free it as usual if it is no longer needed. Free the snapshot with frozen_free.
+// Time complexity: O(n), plus O(n) for the padding slots.
+void freeze_tree(FrozenTree *frozen, TreeNode *root, FrozenLayout layout) {
+    frozen->keys = NULL;
+    frozen->count = node_size(root);
+    frozen->layout = layout;
+    frozen->levels = 0;
+    for (int count = frozen->count; count > 0; count >>= 1) {
+        frozen->levels++;  // Smallest complete tree that holds count keys
+    }
+    if (frozen->count == 0) {
+        return;
+    }
+    frozen_veb_split(frozen, 0, frozen->levels);
+
+    size_t slots = ((size_t)1 << frozen->levels) - 1;
+    frozen->keys = (int*)aligned_alloc(64, (slots * sizeof(int) + 63) / 64 * 64);
+    if (!frozen->keys) {
+        printf("Memory allocation error!\n");
+        exit(1);  // Exit if memory allocation fails
+    }
+
+    TreeCursor source;
+    cursor_init(&source, root);
+    FrozenCursor target;
+    frozen_start(&target, frozen);
+    while (target.depth < frozen->levels - 1) {
+        frozen_down(&target, 0);  // Start at the leftmost slot
+    }
+    int key = 0;
+    for (size_t i = 0; i < slots; i++) {
+        TreeNode *node = cursor_next(&source);
+        if (node != NULL) {
+            key = node->data;  // Past the last node, the largest key is repeated as padding
+        }
+        frozen->keys[target.slots[target.depth]] = key;
+        frozen_advance(&target);
+    }
+    cursor_free(&source);
+}
+
+// 31. Frozen Cursor Init At: O(log n)
+// This function positions a cursor before the first key >= lo (the lower bound), found by
+// one root-to-leaf descent that remembers the last node where it turned left.
+// Time complexity: O(log n), the frozen tree is always balanced.
+void frozen_cursor_init_at(FrozenCursor *cursor, const FrozenTree *frozen, int lo) {
+    frozen_start(cursor, frozen);
+    if (frozen->count == 0) {
+        cursor->index = 0;
+        return;
+    }
+    unsigned found = 0;  // BFS index of the lower bound so far (0 = none)
+    int found_depth = 0;
+    while (1) {
+        if (frozen->layout == FROZEN_EYTZINGER) {
+            __builtin_prefetch(&frozen->keys[16 * cursor->index]);  // Four levels ahead
+        }
+        unsigned right = frozen->keys[cursor->slots[cursor->depth]] < lo;
+        if (!right) {
+            found = cursor->index;
+            found_depth = cursor->depth;
+        }
+        if (cursor->depth == frozen->levels - 1) {
+            break;
+        }
+        frozen_down(cursor, right);
+    }
+    cursor->index = found;  // The slots of the lower bound's path are still recorded
+    cursor->depth = found_depth;
+}
+
+// 32. Frozen Cursor Next: O(1) amortized
+// This function returns a pointer to the next key in ascending order, or NULL at the end.
+// Time complexity: O(1) amortized, O(log n) for a single step.
+const int* frozen_cursor_next(FrozenCursor *cursor) {
+    if (cursor->index == 0) {
+        return NULL;
+    }
+    const int *key = &cursor->tree->keys[cursor->slots[cursor->depth]];
+    frozen_advance(cursor);
+    // The keys are distinct, so meeting the same key again means the padding has started
+    if (cursor->index != 0 && cursor->tree->keys[cursor->slots[cursor->depth]] == *key) {
+        cursor->index = 0;
+    }
+    return key;
+}
+
+// 33. Frozen Find: O(log n)
+// This function returns a pointer to data in the snapshot, or NULL if it is not there.
+// Same descent as frozen_cursor_init_at, without a cursor: the next index is computed
+// from the comparison instead of branching on it, so mispredictions cannot stall it, and
+// the lower bound is kept with a conditional move.
+// Time complexity: O(log n), exactly `levels` steps and no pointer chasing.
+const int* frozen_find(const FrozenTree *frozen, int data) {
+    const int *keys = frozen->keys;
+    int found = -1;  // Slot of the lower bound so far
+    if (frozen->layout == FROZEN_EYTZINGER) {
+        unsigned index = 1;
+        for (int depth = 0; depth < frozen->levels; depth++) {
+            __builtin_prefetch(&keys[16 * index]);  // Four levels ahead
+            int key = keys[index - 1];
+            found = key >= data ? (int)index - 1 : found;
+            index = 2 * index + (key < data);
+        }
+    } else {
+        int slots[FROZEN_MAX_LEVELS];
+        unsigned index = 1;
+        slots[0] = 0;
+        for (int depth = 0; depth < frozen->levels; depth++) {
+            int key = keys[slots[depth]];
+            found = key >= data ? slots[depth] : found;
+            index = 2 * index + (key < data);
+            int next = depth + 1;
+            if (next == frozen->levels) {
+                break;
+            }
+            int top = frozen->veb_top[next];
+            slots[next] = slots[frozen->veb_depth[next]] + top +
+                          (int)(index & (unsigned)top) * frozen->veb_bottom[next];
+        }
+    }
+    return found >= 0 && keys[found] == data ? &keys[found] : NULL;
+}
+
+// 34. Frozen Find Minimum: O(log n)
+// This function returns a pointer to the smallest key, or NULL for an empty snapshot.
+// Time complexity: O(log n), one walk down the left edge.
+const int* frozen_find_min(const FrozenTree *frozen) {
+    FrozenCursor cursor;
+    frozen_cursor_init_at(&cursor, frozen, INT_MIN);
+    return frozen_cursor_next(&cursor);
+}
+
+// 35. Frozen Free: O(1)
+// This function releases the key array of a snapshot.
+// Time complexity: O(1).
+void frozen_free(FrozenTree *frozen) {
+    free(frozen->keys);
+    frozen->keys = NULL;
+    frozen->count = 0;
+    frozen->levels = 0;
+}
+
+// --- Snapshot Operations ---
+// A tree snapshot (see common/snapshot.h) stores one TreeRecord per node in preorder, the
+// same order build_from_sorted uses in memory. The mapped file can be searched directly,
+// or loaded back into TreeNodes without a single comparison or rotation.
+
+// 36. Save Tree: O(n)
+// This function writes the tree to path. Because the nodes go out in preorder, a node's
+// left child is the next record and its right child comes after the whole left subtree,
+// so the stored subtree sizes give every child index up front.
+// Returns 0, or -1 (with an error message) if the file cannot be written.
+// Time complexity: O(n), plus O(h) heap memory for the stack.
+int save_tree(TreeNode *root, const char *path) {
+    SnapshotWriter writer;
+    if (snapshot_create(&writer, path, SNAPSHOT_TREE, sizeof(TreeRecord)) != 0) {
+        return -1;
+    }
+    NodeStack stack = {NULL, 0, 0};
+    uint32_t index = 0;
     if (root != NULL) {
-        free_tree(root->left);    // Free the left subtree
-        free_tree(root->right);   // Free the right subtree
-        free(root);               // Free the root
+        stack_push(&stack, root, 0);
     }
+    while (stack.size > 0) {
+        TreeNode *node = stack_pop(&stack).node;
+        TreeRecord record;
+        record.data = node->data;
+        record.height = node->height;
+        record.size = node->size;
+        record.left = node->left != NULL ? index + 1 : SNAPSHOT_NIL;
+        record.right = node->right != NULL ? index + 1 + (uint32_t)node_size(node->left) : SNAPSHOT_NIL;
+        snapshot_put(&writer, &record);
+        index++;
+        if (node->right != NULL) {
+            stack_push(&stack, node->right, 0);
+        }
+        if (node->left != NULL) {
+            stack_push(&stack, node->left, 0);  // Popped first: preorder
+        }
+    }
+    stack_free(&stack);
+    return snapshot_finish(&writer, root != NULL ? 0 : SNAPSHOT_NIL, 0);
+}
+
+// 37. Open Tree Snapshot: O(1), or O(n) with verify
+// This function maps a tree snapshot read-only (see snapshot_open).
+// Returns 0, or -1 (with an error message) if the file is missing or not a tree snapshot.
+// Time complexity: O(1) without verify; nothing is allocated or rebuilt.
+int open_tree_snapshot(SnapshotView *view, const char *path, int verify) {
+    return snapshot_open(view, path, SNAPSHOT_TREE, sizeof(TreeRecord), verify);
+}
+
+// 38. Tree Snapshot Find: O(h)
+// This function searches the mapped records directly, following child indexes.
+// Returns the record holding data, or NULL if it is not there. Every index is checked
+// against the record count and the walk takes at most count steps, so a damaged file
+// opened without verify gives an error message instead of a bad read or an endless loop.
+// Time complexity: O(h), like find on the tree that was saved.
+const TreeRecord* tree_snapshot_find(const SnapshotView *view, int data) {
+    const TreeRecord *records = (const TreeRecord*)view->records;
+    uint64_t count = view->header->count;
+    uint64_t index = view->header->root;
+    for (uint64_t steps = 0; index != SNAPSHOT_NIL; steps++) {
+        if (index >= count || steps >= count) {
+            printf("Error: Snapshot is corrupted (bad record index).\n");
+            return NULL;
+        }
+        const TreeRecord *record = &records[index];
+        if (record->data == data) {
+            return record;
+        }
+        index = data < record->data ? record->left : record->right;
+    }
+    return NULL;
+}
+
+// 39. Load Tree: O(n)
+// This function turns a mapped snapshot back into an ordinary tree that can be changed.
+// All nodes come from one slab_alloc_array block in the file's preorder, and record
+// indexes become pointers into that block; heights and sizes are copied, so the AVL
+// operations and order statistics work on the result right away.
+// The indexes are checked first, with or without verify: every child must be a later
+// record (as in preorder, so there is no cycle) that no other record points to. A damaged
+// file gives an error message and NULL.
+// Time complexity: O(n), two sequential passes with no comparisons.
+TreeNode* load_tree(const SnapshotView *view) {
+    size_t count = (size_t)view->header->count;
+    if (count == 0) {
+        return NULL;
+    }
+    const TreeRecord *records = (const TreeRecord*)view->records;
+    unsigned char *has_parent = (unsigned char*)calloc(count, 1);
+    if (!has_parent) {
+        printf("Memory allocation error!\n");
+        exit(1);
+    }
+    int damaged = view->header->root >= count;
+    for (size_t i = 0; i < count && !damaged; i++) {
+        uint32_t children[2] = { records[i].left, records[i].right };
+        for (int c = 0; c < 2; c++) {
+            if (children[c] == SNAPSHOT_NIL) {
+                continue;
+            }
+            if (children[c] <= i || children[c] >= count || has_parent[children[c]] ||
+                children[c] == view->header->root) {
+                damaged = 1;
+                break;
+            }
+            has_parent[children[c]] = 1;
+        }
+    }
+    free(has_parent);
+    if (damaged) {
+        printf("Error: Snapshot is corrupted (bad record index).\n");
+        return NULL;
+    }
+    TreeNode *nodes = (TreeNode*)slab_alloc_array(&node_pool, count);
+    for (size_t i = 0; i < count; i++) {
+        nodes[i].data = records[i].data;
+        nodes[i].height = records[i].height;
+        nodes[i].size = records[i].size;
+        nodes[i].left = records[i].left != SNAPSHOT_NIL ? &nodes[records[i].left] : NULL;
+        nodes[i].right = records[i].right != SNAPSHOT_NIL ? &nodes[records[i].right] : NULL;
+    }
+    return &nodes[view->header->root];
+}
+
+// --- Dump Operations ---
+
+// 40. Dump Tree: O(n)
+// This function writes the keys in sorted (in-order) order to out in out's format: one int
+// per line (DUMP_TEXT) or raw 32-bit ints (DUMP_BINARY). Sorted keys rebuild a balanced
+// tree with build_from_sorted.
+// Time complexity: O(n), where n is the number of nodes in the tree.
+void dump_tree(TreeNode *root, DumpWriter *out) {
+    inorder_visit(root, dump_node, out);
+}
+
+// --- Instrumentation ---
+
+// 41. Tree Stats: O(n)
+// Takes a snapshot of the instrumentation counters (see common/stats.h) and adds the size
+// and the measured height. The counters only move in builds with -DDS_STATS; otherwise
+// they stay 0.
+// Time complexity: O(n) for tree_height, which also covers plain trees (their nodes do not
+// keep a height); the counters themselves are O(1).
+void tree_stats(TreeNode *root, DsStats *stats) {
+    ds_stats_snapshot(stats);
+    stats->length = node_size(root);
+    stats->height = tree_height(root);
 }
 
 // --- Exercise ---
@@ -257,7 +1369,27 @@ void exercise_solution() {
 // 3. Find Operation: O(log n) on average, O(n) in the worst case (unbalanced).
 // 4. Delete Operation: O(log n) on average, O(n) in the worst case (unbalanced).
 // 5. Find Minimum: O(log n) on average, O(n) in the worst case (unbalanced).
-// 6. Inorder Traversal: O(n) - Traversing the tree takes linear time.
-// 7. Preorder Traversal: O(n) - Traversing the tree takes linear time.
-// 8. Postorder Traversal: O(n) - Traversing the tree takes linear time.
-// 9. Free Tree: O(n) - Freeing each node takes linear time.
+// 6. Inorder Traversal: O(n) - Morris traversal, O(1) extra memory, no recursion.
+// 7. Preorder Traversal: O(n) - Morris traversal, O(1) extra memory, no recursion.
+// 8. Postorder Traversal: O(n) - Heap stack of O(h) entries, no recursion.
+// 9. Free Tree: O(n) - Rotations flatten the tree while freeing it, O(1) extra memory.
+// 10. Destroy Pool: O(b) - Releasing the arena costs one free per slab block, not per node.
+// 11. Tree Height: O(n) - Every node is visited once.
+// 12. Rotations / Rebalance: O(1) - A constant number of pointer and height updates.
+// 13. AVL Insert: O(log n) - The height is always O(log n), whatever the key order.
+// 14. AVL Delete: O(log n) - The height is always O(log n), whatever the key order.
+// 15. Cursor: O(n) for a full scan - O(1) amortized per step, O(h) heap memory.
+// 16. Build from Sorted Array: O(n) - One contiguous block, perfectly balanced, no rotations.
+// 17. Rank / Select / Range Count: O(h) - One path, thanks to the subtree sizes.
+// 18. Range Visit / Cursor Init At: O(h + k) - One path, then only the k keys in the range.
+// 19. Freeze Tree: O(n) - Keys only, 4 bytes per key instead of a 32 byte node.
+// 20. Frozen Find / Find Minimum / Range Scan: O(log n), O(log n + k) - No pointers to chase;
+//     the vEB layout needs O(log_B n) block transfers for any block size B.
+// 21. Save Tree / Load Tree: O(n) - One sequential pass each way, no comparisons on load.
+// 22. Open Tree Snapshot: O(1) - The file is mapped and searched in place (O(h) per find).
+// 23. Print Traversals / Dump Tree: O(n) - Formatted into one buffer, one write(2) per MiB.
+// 24. Tree Stats: O(n) - A copy of the counters plus a height measurement; with -DDS_STATS each
+//     step down the tree adds one visit and each single rotation one rotation.
+// Insert, find, delete, the traversals and free_tree are all loops, so a degenerate tree
+// of any depth cannot overflow the call stack. The AVL operations still recurse, but only
+// O(log n) deep.
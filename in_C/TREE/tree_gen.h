@@ -0,0 +1,313 @@
+// This header generates AVL trees of any element type, the type-generic version of the
+// AVL operations in TREE/simple.c (with subtree sizes for rank and select). Elements are
+// ordered by key; an element with an equal key replaces the stored one, so a tree of
+// key/value pairs works as an ordered map. See common/generic.h for the arguments.
+//
+// Example: an ordered map from 64-bit keys to 64-bit values
+//   typedef struct Pair { int64_t key; int64_t value; } Pair;
+//   #define PAIR_KEY(p) ((p).key)
+//   DEFINE_TREE(PairTree, Pair, int64_t, PAIR_KEY, GEN_LESS)
+//   PairTree tree;
+//   PairTree_init(&tree);
+//   PairTree_insert(&tree, (Pair){7, 700});
+//   Pair *found = PairTree_find(&tree, 7);
+//
+// Generated for DEFINE_TREE(Name, T, K, KEY_OF, LESS):
+//   NameNode                             { T data; int height; int size; NameNode *left, *right; }
+//   Name                                 { NameNode *root; }
+//   NameCursor                           in-order cursor, no heap memory
+//   void Name_init(Name *tree)
+//   int  Name_size(const Name *tree)
+//   int  Name_insert(Name *tree, T value)         1 if added, 0 if an equal key was replaced
+//   T*   Name_find(const Name *tree, K key)       NULL if absent
+//   int  Name_delete(Name *tree, K key)           1 if removed, 0 if absent
+//   T*   Name_min(const Name *tree)               NULL if empty
+//   int  Name_rank(const Name *tree, K key)       number of keys smaller than key
+//   T*   Name_select(const Name *tree, int k)     k-th smallest, from 0
+//   void Name_cursor_init(NameCursor *cursor, const Name *tree)
+//   void Name_cursor_init_at(NameCursor *cursor, const Name *tree, K lo)
+//   T*   Name_cursor_next(NameCursor *cursor)     next element in key order, or NULL
+//   void Name_free(Name *tree)
+//   Name_pool                            the SlabPool the nodes come from
+// The element is stored inside its node. For T = int the node has exactly the layout of
+// TreeNode, and the recursion below is the same as avl_insert / avl_delete, so the int
+// instantiation costs the same. The tree is always balanced, so its height stays below
+// 1.44 log2(n + 2) and the cursor can keep its path in a fixed array of GEN_TREE_MAX_HEIGHT.
+
+#ifndef TREE_GEN_H
+#define TREE_GEN_H
+
+// --- Includes Section ---
+#include <stdio.h>
+#include <stdlib.h>
+#include "../common/slab.h"  // Shared fixed-size node allocator
+#include "../common/generic.h"  // GEN_SELF, GEN_LESS, GEN_EQUAL
+
+// An AVL tree of height 64 would need more than 2^44 nodes.
+#define GEN_TREE_MAX_HEIGHT 64
+
+// --- Generator ---
+#define DEFINE_TREE(Name, T, K, KEY_OF, LESS)                                                    \
+typedef struct Name##Node {                                                                      \
+    T data;                        /* Element stored in the node */                              \
+    int height;                    /* Height of the subtree rooted here (leaf = 1) */            \
+    int size;                      /* Number of nodes in the subtree rooted here */              \
+    struct Name##Node *left;       /* Pointer to the left child */                               \
+    struct Name##Node *right;      /* Pointer to the right child */                              \
+} Name##Node;                                                                                    \
+                                                                                                 \
+typedef struct Name {                                                                            \
+    Name##Node *root;              /* Root node (NULL when empty) */                             \
+} Name;                                                                                          \
+                                                                                                 \
+typedef struct Name##Cursor {                                                                    \
+    Name##Node *stack[GEN_TREE_MAX_HEIGHT];  /* Ancestors not returned yet */                    \
+    int depth;                     /* Number of entries in use */                                \
+} Name##Cursor;                                                                                  \
+                                                                                                 \
+static SlabPool Name##_pool = SLAB_POOL_INIT(sizeof(Name##Node));                                \
+                                                                                                 \
+static inline int Name##_node_height(const Name##Node *node) {                                   \
+    return node == NULL ? 0 : node->height;                                                      \
+}                                                                                                \
+                                                                                                 \
+static inline int Name##_node_size(const Name##Node *node) {                                     \
+    return node == NULL ? 0 : node->size;                                                        \
+}                                                                                                \
+                                                                                                 \
+/* Recomputes a node's height and size from its children. */                                     \
+static inline void Name##_update(Name##Node *node) {                                             \
+    int left = Name##_node_height(node->left);                                                   \
+    int right = Name##_node_height(node->right);                                                 \
+    node->height = 1 + (left > right ? left : right);                                            \
+    node->size = 1 + Name##_node_size(node->left) + Name##_node_size(node->right);               \
+}                                                                                                \
+                                                                                                 \
+static inline Name##Node* Name##_rotate_left(Name##Node *root) {                                 \
+    Name##Node *new_root = root->right;                                                          \
+    root->right = new_root->left;                                                                \
+    new_root->left = root;                                                                       \
+    Name##_update(root);                                                                         \
+    Name##_update(new_root);                                                                     \
+    return new_root;                                                                             \
+}                                                                                                \
+                                                                                                 \
+static inline Name##Node* Name##_rotate_right(Name##Node *root) {                                \
+    Name##Node *new_root = root->left;                                                           \
+    root->left = new_root->right;                                                                \
+    new_root->right = root;                                                                      \
+    Name##_update(root);                                                                         \
+    Name##_update(new_root);                                                                     \
+    return new_root;                                                                             \
+}                                                                                                \
+                                                                                                 \
+/* Restores the AVL property at one node with a single or double rotation. */                    \
+static inline Name##Node* Name##_rebalance(Name##Node *root) {                                   \
+    Name##_update(root);                                                                         \
+    int balance = Name##_node_height(root->left) - Name##_node_height(root->right);              \
+    if (balance > 1) {                                                                           \
+        if (Name##_node_height(root->left->left) < Name##_node_height(root->left->right)) {      \
+            root->left = Name##_rotate_left(root->left);                                         \
+        }                                                                                        \
+        return Name##_rotate_right(root);                                                        \
+    }                                                                                            \
+    if (balance < -1) {                                                                          \
+        if (Name##_node_height(root->right->right) < Name##_node_height(root->right->left)) {    \
+            root->right = Name##_rotate_right(root->right);                                      \
+        }                                                                                        \
+        return Name##_rotate_left(root);                                                         \
+    }                                                                                            \
+    return root;                                                                                 \
+}                                                                                                \
+                                                                                                 \
+static Name##Node* Name##_insert_node(Name##Node *root, T value) {                               \
+    if (root == NULL) {                                                                          \
+        Name##Node *node = (Name##Node*)slab_alloc(&Name##_pool);                                \
+        node->data = value;                                                                      \
+        node->height = 1;                                                                        \
+        node->size = 1;                                                                          \
+        node->left = NULL;                                                                       \
+        node->right = NULL;                                                                      \
+        return node;                                                                             \
+    }                                                                                            \
+    if (LESS(KEY_OF(value), KEY_OF(root->data))) {                                               \
+        root->left = Name##_insert_node(root->left, value);                                      \
+    } else if (LESS(KEY_OF(root->data), KEY_OF(value))) {                                        \
+        root->right = Name##_insert_node(root->right, value);                                    \
+    } else {                                                                                     \
+        root->data = value;  /* Equal key: replace, the shape does not change */                 \
+        return root;                                                                             \
+    }                                                                                            \
+    return Name##_rebalance(root);                                                               \
+}                                                                                                \
+                                                                                                 \
+static Name##Node* Name##_delete_node(Name##Node *root, K key) {                                 \
+    if (root == NULL) {                                                                          \
+        return root;                                                                             \
+    }                                                                                            \
+    if (LESS(key, KEY_OF(root->data))) {                                                         \
+        root->left = Name##_delete_node(root->left, key);                                        \
+    } else if (LESS(KEY_OF(root->data), key)) {                                                  \
+        root->right = Name##_delete_node(root->right, key);                                      \
+    } else {                                                                                     \
+        if (root->left == NULL || root->right == NULL) {                                         \
+            Name##Node *temp = root->left != NULL ? root->left : root->right;                    \
+            slab_free(&Name##_pool, root);                                                       \
+            return temp;                                                                         \
+        }                                                                                        \
+        Name##Node *succ = root->right;  /* Copy the in-order successor and delete it instead */ \
+        while (succ->left != NULL) {                                                             \
+            succ = succ->left;                                                                   \
+        }                                                                                        \
+        root->data = succ->data;                                                                 \
+        root->right = Name##_delete_node(root->right, KEY_OF(succ->data));                       \
+    }                                                                                            \
+    return Name##_rebalance(root);                                                               \
+}                                                                                                \
+                                                                                                 \
+/* 1. Init: O(1) */                                                                              \
+static inline void Name##_init(Name *tree) {                                                     \
+    tree->root = NULL;                                                                           \
+}                                                                                                \
+                                                                                                 \
+/* 2. Size: O(1), read from the root */                                                          \
+static inline int Name##_size(const Name *tree) {                                                \
+    return Name##_node_size(tree->root);                                                         \
+}                                                                                                \
+                                                                                                 \
+/* 3. Insert: O(log n) */                                                                        \
+static inline int Name##_insert(Name *tree, T value) {                                           \
+    int before = Name##_node_size(tree->root);                                                   \
+    tree->root = Name##_insert_node(tree->root, value);                                          \
+    return Name##_node_size(tree->root) != before;                                               \
+}                                                                                                \
+                                                                                                 \
+/* 4. Find: O(log n); both comparisons are made before the branch, so for plain keys the */      \
+/* child is picked with a conditional move like find in simple.c, not a mispredicted jump */     \
+static inline T* Name##_find(const Name *tree, K key) {                                          \
+    Name##Node *node = tree->root;                                                               \
+    while (node != NULL) {                                                                       \
+        int less = LESS(key, KEY_OF(node->data));                                                \
+        if ((less | LESS(KEY_OF(node->data), key)) == 0) {                                       \
+            return &node->data;                                                                  \
+        }                                                                                        \
+        node = less ? node->left : node->right;                                                  \
+    }                                                                                            \
+    return NULL;                                                                                 \
+}                                                                                                \
+                                                                                                 \
+/* 5. Delete: O(log n) */                                                                        \
+static inline int Name##_delete(Name *tree, K key) {                                             \
+    int before = Name##_node_size(tree->root);                                                   \
+    tree->root = Name##_delete_node(tree->root, key);                                            \
+    return Name##_node_size(tree->root) != before;                                               \
+}                                                                                                \
+                                                                                                 \
+/* 6. Min: O(log n) */                                                                           \
+static inline T* Name##_min(const Name *tree) {                                                  \
+    Name##Node *node = tree->root;                                                               \
+    if (node == NULL) {                                                                          \
+        return NULL;                                                                             \
+    }                                                                                            \
+    while (node->left != NULL) {                                                                 \
+        node = node->left;                                                                       \
+    }                                                                                            \
+    return &node->data;                                                                          \
+}                                                                                                \
+                                                                                                 \
+/* 7. Rank: O(log n), counts the keys smaller than key */                                        \
+static inline int Name##_rank(const Name *tree, K key) {                                         \
+    int rank = 0;                                                                                \
+    Name##Node *node = tree->root;                                                               \
+    while (node != NULL) {                                                                       \
+        if (LESS(KEY_OF(node->data), key)) {                                                     \
+            rank += Name##_node_size(node->left) + 1;                                            \
+            node = node->right;                                                                  \
+        } else {                                                                                 \
+            node = node->left;                                                                   \
+        }                                                                                        \
+    }                                                                                            \
+    return rank;                                                                                 \
+}                                                                                                \
+                                                                                                 \
+/* 8. Select: O(log n), the k-th smallest element counting from 0 */                             \
+static inline T* Name##_select(const Name *tree, int k) {                                        \
+    Name##Node *node = tree->root;                                                               \
+    if (k < 0 || k >= Name##_node_size(node)) {                                                  \
+        printf("Error: Index out of bounds.\n");                                                 \
+        return NULL;                                                                             \
+    }                                                                                            \
+    while (1) {                                                                                  \
+        int left = Name##_node_size(node->left);                                                 \
+        if (k < left) {                                                                          \
+            node = node->left;                                                                   \
+        } else if (k == left) {                                                                  \
+            return &node->data;                                                                  \
+        } else {                                                                                 \
+            k -= left + 1;                                                                       \
+            node = node->right;                                                                  \
+        }                                                                                        \
+    }                                                                                            \
+}                                                                                                \
+                                                                                                 \
+/* 9. Cursor Init: O(log n), positions the cursor before the smallest element */                 \
+static inline void Name##_cursor_init(Name##Cursor *cursor, const Name *tree) {                  \
+    cursor->depth = 0;                                                                           \
+    for (Name##Node *node = tree->root; node != NULL; node = node->left) {                       \
+        cursor->stack[cursor->depth++] = node;                                                   \
+    }                                                                                            \
+}                                                                                                \
+                                                                                                 \
+/* 10. Cursor Init At: O(log n), positions the cursor before the first key >= lo */              \
+static inline void Name##_cursor_init_at(Name##Cursor *cursor, const Name *tree, K lo) {         \
+    Name##Node *node = tree->root;                                                               \
+    cursor->depth = 0;                                                                           \
+    while (node != NULL) {                                                                       \
+        if (LESS(KEY_OF(node->data), lo)) {                                                      \
+            node = node->right;                                                                  \
+        } else {                                                                                 \
+            cursor->stack[cursor->depth++] = node;                                               \
+            node = node->left;                                                                   \
+        }                                                                                        \
+    }                                                                                            \
+}                                                                                                \
+                                                                                                 \
+/* 11. Cursor Next: O(1) amortized; the tree must not change while a cursor is in use */         \
+static inline T* Name##_cursor_next(Name##Cursor *cursor) {                                      \
+    if (cursor->depth == 0) {                                                                    \
+        return NULL;                                                                             \
+    }                                                                                            \
+    Name##Node *node = cursor->stack[--cursor->depth];                                           \
+    for (Name##Node *next = node->right; next != NULL; next = next->left) {                      \
+        cursor->stack[cursor->depth++] = next;                                                   \
+    }                                                                                            \
+    return &node->data;                                                                          \
+}                                                                                                \
+                                                                                                 \
+/* 12. Free: O(n), the nodes go back to the pool's free list; uses the right spine */            \
+static inline void Name##_free(Name *tree) {                                                     \
+    Name##Node *node = tree->root;                                                               \
+    while (node != NULL) {                                                                       \
+        if (node->left != NULL) {                                                                \
+            Name##Node *left = node->left;  /* Rotate the left child up, no stack needed */      \
+            node->left = left->right;                                                            \
+            left->right = node;                                                                  \
+            node = left;                                                                         \
+        } else {                                                                                 \
+            Name##Node *right = node->right;                                                     \
+            slab_free(&Name##_pool, node);                                                       \
+            node = right;                                                                        \
+        }                                                                                        \
+    }                                                                                            \
+    tree->root = NULL;                                                                           \
+}
+
+// --- Big O Summary ---
+// 1. Init / Size: O(1) - The size is kept in every node.
+// 2. Insert / Delete: O(log n) - AVL rebalancing on the way back up.
+// 3. Find / Min: O(log n) - The key comparisons are inlined, not called.
+// 4. Rank / Select: O(log n) - The subtree sizes skip whole subtrees.
+// 5. Cursor: O(log n) to start, O(1) amortized per element, no heap memory.
+// 6. Free: O(n) - Every node goes back to the pool.
+
+#endif // TREE_GEN_H
@@ -5,46 +5,124 @@
 // --- Includes Section ---
 #include <stdio.h>
 #include <stdlib.h>
+#include <limits.h>
+#include <string.h>
+#include "../common/simd_scan.h"  // SIMD find/min/max/count kernels
+#include "../common/snapshot.h"   // mmap-able on-disk snapshots
+#include "../common/ingest.h"     // Streaming int loader for text and binary files
+#include "../common/dump.h"       // Buffered output writer
+#include "../common/hash_index.h" // Open-addressing hash table for O(1) find
 
 // Arrays are fixed-size, sequential data structures that store elements of the same type.
 // In C, an array's size must be declared at compile time or dynamically allocated at runtime.
+// A dynamic array (vector) keeps a heap buffer plus its size and capacity. When the buffer
+// is full it grows geometrically (doubles), so inserting never has to drop an element.
+
+// --- Struct Definitions ---
+typedef struct Vector {
+    int *data;             // Heap buffer holding the elements
+    int size;              // Number of elements in use
+    int capacity;          // Number of elements the buffer can hold
+} Vector;
+
+// Hashed mode: a hash index next to the vector maps each distinct value to its count and the
+// position of its first occurrence, so find_element's O(n) scan becomes an O(1) lookup.
+// The hashed vector owns a plain Vector. Read it with the plain functions (print_array,
+// min_element, ...), but change it only through the hashed_ functions while the index is
+// attached, or the positions go stale.
+typedef struct HashedVector {
+    Vector vec;            // The ordinary vector
+    HashIndex index;       // value -> {count, first position}
+} HashedVector;
 
 // --- Function Declarations ---
-void print_array(int *arr, int size);
-void insert_element(int *arr, int size, int index, int value);
-void delete_element(int *arr, int size, int index);
-int find_element(int *arr, int size, int value);
-void update_element(int *arr, int size, int index, int new_value);
+void vector_init(Vector *vec);
+void vector_reserve(Vector *vec, int capacity);
+void vector_shrink_to_fit(Vector *vec);
+void vector_push_back(Vector *vec, int value);
+void vector_free(Vector *vec);
+void print_array(const Vector *vec);
+void insert_element(Vector *vec, int index, int value);
+void delete_element(Vector *vec, int index);
+int find_element(const Vector *vec, int value);
+int count_element(const Vector *vec, int value);
+int min_element(const Vector *vec);
+int max_element(const Vector *vec);
+void update_element(Vector *vec, int index, int new_value);
+int save_array(const Vector *vec, const char *path);
+int open_array_snapshot(SnapshotView *view, const char *path, int verify, Vector *vec);
+void load_array(Vector *vec, const SnapshotView *view);
+void vector_append_many(Vector *vec, const int *values, int count);
+void insert_elements(Vector *vec, int index, const int *values, int count);
+int ingest_array(Vector *vec, const char *path, int format);
+void dump_array(const Vector *vec, DumpWriter *out);
+void hashed_vector_init(HashedVector *hv);
+void hashed_vector_attach(HashedVector *hv, Vector *vec);
+void hashed_vector_detach(HashedVector *hv, Vector *vec);
+void hashed_push_back(HashedVector *hv, int value);
+void hashed_insert_element(HashedVector *hv, int index, int value);
+void hashed_delete_element(HashedVector *hv, int index);
+void hashed_update_element(HashedVector *hv, int index, int new_value);
+int hashed_find_element(const HashedVector *hv, int value);
+void hashed_vector_free(HashedVector *hv);
 void exercise_solution();
 
 // --- Main Function ---
 // The main function will demonstrate the array operations.
-int main() {
-    // Array Initialization: O(1)
-    // We create an array of size 5.
-    int arr[5] = {10, 20, 30, 40, 50};  // Array initialization
-    int size = 5;                       // Size of the array
+// Benchmarks include this file with DS_NO_MAIN defined to reuse the array operations.
+#ifndef DS_NO_MAIN
+int main(int argc, char *argv[]) {
+    // Bulk Load: O(n)
+    // Given a file ("-" for stdin), the program loads it instead of running the demo:
+    //   ./arrays numbers.txt          decimal ints separated by whitespace or commas
+    //   ./arrays numbers.bin --binary raw 32-bit ints
+    if (argc > 1) {
+        Vector loaded;
+        vector_init(&loaded);
+        int format = argc > 2 && strcmp(argv[2], "--binary") == 0 ? INGEST_BINARY : INGEST_TEXT;
+        if (ingest_array(&loaded, argv[1], format) < 0) {
+            vector_free(&loaded);
+            return 1;
+        }
+        if (loaded.size > 0) {
+            printf("Loaded %d elements from %s (min %d, max %d).\n", loaded.size, argv[1],
+                   min_element(&loaded), max_element(&loaded));
+        } else {
+            printf("Loaded 0 elements from %s.\n", argv[1]);
+        }
+        vector_free(&loaded);
+        return 0;
+    }
+
+    // Array Initialization: O(n)
+    // We create a vector and push 5 elements into it.
+    Vector arr;
+    vector_init(&arr);
+    int initial[5] = {10, 20, 30, 40, 50};
+    for (int i = 0; i < 5; i++) {
+        vector_push_back(&arr, initial[i]);  // Amortized O(1) per element
+    }
 
     // Print the initial array
     printf("Initial Array:\n");
-    print_array(arr, size);
+    print_array(&arr);
 
     // 1. Insert Operation: O(n)
-    // We'll insert a new element at index 2.
+    // We'll insert a new element at index 2. The vector grows, nothing is dropped.
     printf("\nInserting 25 at index 2:\n");
-    insert_element(arr, size, 2, 25); // Insert 25 at index 2
-    print_array(arr, size);  // Print after insertion
+    insert_element(&arr, 2, 25); // Insert 25 at index 2
+    print_array(&arr);  // Print after insertion
 
     // 2. Delete Operation: O(n)
     // We'll delete the element at index 4.
     printf("\nDeleting element at index 4:\n");
-    delete_element(arr, size, 4);  // Delete element at index 4
-    print_array(arr, size);  // Print after deletion
+    delete_element(&arr, 4);  // Delete element at index 4
+    print_array(&arr);  // Print after deletion
 
     // 3. Find Operation: O(n)
     // Find if element 40 exists in the array.
     printf("\nFinding element 40 in the array:\n");
-    int index = find_element(arr, size, 40);  // Find element 40
+    int index = find_element(&arr, 40);  // Find element 40
     if (index != -1) {
         printf("Element 40 found at index %d.\n", index);
     } else {
@@ -54,119 +132,594 @@ int main() {
     // 4. Update Operation: O(1)
     // Update the element at index 3 to 99.
     printf("\nUpdating element at index 3 to 99:\n");
-    update_element(arr, size, 3, 99);  // Update index 3 to 99
-    print_array(arr, size);  // Print after update
+    update_element(&arr, 3, 99);  // Update index 3 to 99
+    print_array(&arr);  // Print after update
+
+    // 5. Min, Max and Count: O(n)
+    printf("\nMin %d, max %d, count of 99: %d\n", min_element(&arr), max_element(&arr), count_element(&arr, 99));
+
+    // 6. Shrink to Fit: O(n)
+    // Give the unused capacity back to the allocator.
+    printf("\nSize %d, capacity %d", arr.size, arr.capacity);
+    vector_shrink_to_fit(&arr);
+    printf(" -> capacity after shrink_to_fit %d\n", arr.capacity);
+
+    // 7. Batched Insert: O(n + k)
+    // k elements go in with one grow and one memmove, not k separate shifts.
+    printf("\nAppending 60, 70 and inserting 1, 2, 3 at index 0:\n");
+    int more[2] = {60, 70};
+    int front[3] = {1, 2, 3};
+    vector_append_many(&arr, more, 2);
+    insert_elements(&arr, 0, front, 3);
+    print_array(&arr);
+
+    // 8. Snapshots: save O(n), open O(1)
+    // The opened snapshot is a read-only vector over the mapped file, so the searches
+    // and scans run on it directly.
+    printf("\nSaving the array to array.snap:\n");
+    SnapshotView view;
+    Vector mapped;
+    if (save_array(&arr, "array.snap") == 0 && open_array_snapshot(&view, "array.snap", 1, &mapped) == 0) {
+        printf("Mapped array: ");
+        print_array(&mapped);
+        printf("Element 99 at index %d, max %d\n", find_element(&mapped, 99), max_element(&mapped));
+        snapshot_close(&view);
+        remove("array.snap");
+    }
+
+    // 9. Dump: O(n)
+    // Text dumps hold one element per line and read back with ingest_array.
+    printf("\nDumping the array as text:\n");
+    DumpWriter *out = dump_stdout();
+    dump_array(&arr, out);
+    dump_flush(out);
+
+    // 10. Hash Index: find in O(1) expected
+    // The index is built once; after that every change goes through the hashed_ functions,
+    // which keep the positions in it up to date.
+    printf("\nAttaching a hash index, inserting 99 at index 0, deleting index 5:\n");
+    HashedVector hashed;
+    hashed_vector_init(&hashed);
+    hashed_vector_attach(&hashed, &arr);
+    printf("Element 99 at index %d\n", hashed_find_element(&hashed, 99));
+    hashed_insert_element(&hashed, 0, 99);
+    hashed_delete_element(&hashed, 5);
+    print_array(&hashed.vec);
+    printf("Element 99 at index %d, element 60 at index %d, element 40 at index %d\n",
+           hashed_find_element(&hashed, 99), hashed_find_element(&hashed, 60), hashed_find_element(&hashed, 40));
+    hashed_vector_detach(&hashed, &arr);
 
     // --- Demonstrating Exercise ---
     // Calling the solution function to an exercise.
     printf("\n--- Exercise Solution ---\n");
     exercise_solution();
 
+    // Free the vector buffer
+    vector_free(&arr);
+
     return 0;
 }
+#endif // DS_NO_MAIN
+
+// --- Vector Operations ---
+
+// 1. Init Vector: O(1)
+// This function sets up an empty vector. No memory is allocated until the first insert.
+// Time complexity: O(1).
+void vector_init(Vector *vec) {
+    vec->data = NULL;
+    vec->size = 0;
+    vec->capacity = 0;
+}
+
+// 2. Reserve: O(n)
+// This function makes sure the buffer can hold at least `capacity` elements.
+// realloc may have to copy the existing elements to a new buffer.
+// Time complexity: O(n) when the buffer moves, O(1) when it is already big enough.
+void vector_reserve(Vector *vec, int capacity) {
+    if (capacity <= vec->capacity) {
+        return;
+    }
+    int *data = (int*)realloc(vec->data, (size_t)capacity * sizeof(int));
+    if (!data) {
+        printf("Memory allocation error!\n");
+        exit(1);  // Exit if memory allocation fails
+    }
+    vec->data = data;
+    vec->capacity = capacity;
+}
+
+// Makes room for one more element, doubling the capacity when the buffer is full.
+// A capacity above INT_MAX / 2 cannot double as an int, so that is an allocation failure.
+static void vector_grow(Vector *vec) {
+    if (vec->size == vec->capacity) {
+        if (vec->capacity > INT_MAX / 2) {
+            printf("Memory allocation error!\n");
+            exit(1);
+        }
+        int new_capacity = vec->capacity == 0 ? 8 : vec->capacity * 2;
+        vector_reserve(vec, new_capacity);
+    }
+}
+
+// 3. Shrink to Fit: O(n)
+// This function reduces the capacity to the current size.
+// Time complexity: O(n) in the worst case, because realloc may copy the elements.
+void vector_shrink_to_fit(Vector *vec) {
+    if (vec->size == vec->capacity) {
+        return;
+    }
+    if (vec->size == 0) {
+        vector_free(vec);
+        return;
+    }
+    int *data = (int*)realloc(vec->data, (size_t)vec->size * sizeof(int));
+    if (data) {  // If shrinking fails, the old buffer is still valid
+        vec->data = data;
+        vec->capacity = vec->size;
+    }
+}
+
+// 4. Push Back: O(1) amortized
+// This function appends an element at the end. Because the capacity doubles, the total
+// copying over n pushes is at most 2n elements.
+// Time complexity: O(1) amortized, O(n) for the push that triggers a resize.
+void vector_push_back(Vector *vec, int value) {
+    vector_grow(vec);
+    vec->data[vec->size++] = value;
+}
+
+// 5. Free Vector: O(1)
+// This function releases the buffer and leaves an empty vector.
+// Time complexity: O(1).
+void vector_free(Vector *vec) {
+    free(vec->data);
+    vector_init(vec);
+}
 
 // --- Array Operations ---
 
-// 1. Print Array Function: O(n)
+// 6. Print Array Function: O(n)
 // This function prints the contents of the array.
+// The text goes through the shared stdout writer (see common/dump.h), so printing a large
+// array costs one write(2) per MiB instead of one printf per element.
 // Time complexity: O(n) where n is the size of the array.
-void print_array(int *arr, int size) {
-    printf("[");
-    for (int i = 0; i < size; i++) {
-        printf("%d", arr[i]);
-        if (i < size - 1) {
-            printf(", ");
+void print_array(const Vector *vec) {
+    DumpWriter *out = dump_stdout();
+    dump_text(out, "[");
+    for (int i = 0; i < vec->size; i++) {
+        dump_int(out, vec->data[i]);
+        if (i < vec->size - 1) {
+            dump_text(out, ", ");
         }
     }
-    printf("]\n");
+    dump_text(out, "]\n");
+    dump_flush(out);
 }
 
-// 2. Insert Element Function: O(n)
+// 7. Insert Element Function: O(n)
 // Inserting an element into an array can be expensive because the array is a contiguous block of memory.
 // If we insert at the beginning or middle, we need to shift all elements after it.
+// The shift is a single memmove, and the vector grows instead of dropping the last element.
+// Index == size appends at the end.
 // Time complexity: O(n) where n is the number of elements in the array.
-void insert_element(int *arr, int size, int index, int value) {
+void insert_element(Vector *vec, int index, int value) {
     // Check if index is valid
-    if (index < 0 || index >= size) {
+    if (index < 0 || index > vec->size) {
         printf("Error: Index out of bounds.\n");
         return;
     }
 
+    vector_grow(vec);
+
     // Shift elements to the right
-    for (int i = size - 1; i > index; i--) {
-        arr[i] = arr[i - 1];  // Shifting elements to the right
-    }
+    memmove(&vec->data[index + 1], &vec->data[index], (size_t)(vec->size - index) * sizeof(int));
     // Insert new value
-    arr[index] = value;
+    vec->data[index] = value;
+    vec->size++;
 }
 
-// 3. Delete Element Function: O(n)
+// 8. Delete Element Function: O(n)
 // Deleting an element from an array also requires shifting all elements after it to the left.
+// The shift is a single memmove, and the size shrinks by one.
 // Time complexity: O(n) where n is the number of elements in the array.
-void delete_element(int *arr, int size, int index) {
+void delete_element(Vector *vec, int index) {
     // Check if index is valid
-    if (index < 0 || index >= size) {
+    if (index < 0 || index >= vec->size) {
         printf("Error: Index out of bounds.\n");
         return;
     }
 
     // Shift elements to the left
-    for (int i = index; i < size - 1; i++) {
-        arr[i] = arr[i + 1];  // Shifting elements to the left
-    }
-    // For simplicity, we leave the last element as is.
+    memmove(&vec->data[index], &vec->data[index + 1], (size_t)(vec->size - index - 1) * sizeof(int));
+    vec->size--;
 }
 
-// 4. Find Element Function: O(n)
+// 9. Find Element Function: O(n)
 // To find an element in an array, we might have to iterate through the entire array.
-// This is known as a linear search.
+// This is known as a linear search. The scan compares 8 ints per instruction on AVX2
+// CPUs (4 with SSE4.1) and falls back to a plain loop elsewhere.
+// Returns the index of the first match, or -1 if the element is not found.
 // Time complexity: O(n) where n is the number of elements in the array.
-int find_element(int *arr, int size, int value) {
-    for (int i = 0; i < size; i++) {
-        if (arr[i] == value) {
-            return i;  // Return index if element is found
-        }
-    }
-    return -1;  // Return -1 if element is not found
+int find_element(const Vector *vec, int value) {
+    return scan_find_int(vec->data, vec->size, value);
 }
 
-// 5. Update Element Function: O(1)
+// 10. Update Element Function: O(1)
 // Updating an element in an array is fast since we directly access the index.
 // Time complexity: O(1) because it's a direct access operation.
-void update_element(int *arr, int size, int index, int new_value) {
+void update_element(Vector *vec, int index, int new_value) {
     // Check if index is valid
-    if (index < 0 || index >= size) {
+    if (index < 0 || index >= vec->size) {
+        printf("Error: Index out of bounds.\n");
+        return;
+    }
+    vec->data[index] = new_value;  // Directly update the value
+}
+
+// 11. Count Element Function: O(n)
+// This function counts how many elements are equal to value, with the SIMD scan.
+// Time complexity: O(n) where n is the number of elements in the array.
+int count_element(const Vector *vec, int value) {
+    return scan_count_int(vec->data, vec->size, value);
+}
+
+// 12. Min Element Function: O(n)
+// This function returns the smallest element (INT_MAX for an empty array), with the SIMD scan.
+// Time complexity: O(n) where n is the number of elements in the array.
+int min_element(const Vector *vec) {
+    return scan_min_int(vec->data, vec->size);
+}
+
+// 13. Max Element Function: O(n)
+// This function returns the largest element (INT_MIN for an empty array), with the SIMD scan.
+// Time complexity: O(n) where n is the number of elements in the array.
+int max_element(const Vector *vec) {
+    return scan_max_int(vec->data, vec->size);
+}
+
+// --- Snapshot Operations ---
+// An array snapshot (see common/snapshot.h) is the flat layout: the elements as int32
+// records, one after the other, exactly like the vector's buffer.
+
+// 14. Save Array: O(n)
+// This function writes the elements to path in large buffered writes.
+// Returns 0, or -1 (with an error message) if the file cannot be written.
+// Time complexity: O(n) where n is the number of elements in the array.
+int save_array(const Vector *vec, const char *path) {
+    SnapshotWriter writer;
+    if (snapshot_create(&writer, path, SNAPSHOT_ARRAY, sizeof(int32_t)) != 0) {
+        return -1;
+    }
+    snapshot_put_many(&writer, vec->data, (size_t)vec->size);
+    return snapshot_finish(&writer, 0, 0);
+}
+
+// 15. Open Array Snapshot: O(1), or O(n) with verify
+// This function maps an array snapshot read-only (see snapshot_open) and points vec at the
+// mapped elements, without copying them. Only the read operations (find_element,
+// count_element, min_element, max_element, print_array) may be used on vec, and it must
+// not be freed: snapshot_close releases it. Use load_array for a vector that can change.
+// Returns 0, or -1 (with an error message) if the file is missing or not an array snapshot.
+// Time complexity: O(1) without verify.
+int open_array_snapshot(SnapshotView *view, const char *path, int verify, Vector *vec) {
+    if (snapshot_open(view, path, SNAPSHOT_ARRAY, sizeof(int32_t), verify) != 0) {
+        return -1;
+    }
+    if (view->header->count > (uint64_t)INT32_MAX) {
+        printf("Error: %s has too many elements for a vector.\n", path);
+        snapshot_close(view);
+        return -1;
+    }
+    vec->data = (int*)view->records;  // Read-only: the mapping is PROT_READ
+    vec->size = (int)view->header->count;
+    vec->capacity = vec->size;
+    return 0;
+}
+
+// 16. Load Array: O(n)
+// This function copies a mapped snapshot into an ordinary vector with one memcpy.
+// A count above INT32_MAX gives an error message and leaves the vector empty.
+// Time complexity: O(n).
+void load_array(Vector *vec, const SnapshotView *view) {
+    vector_init(vec);
+    if (view->header->count > (uint64_t)INT32_MAX) {
+        printf("Error: Snapshot has too many elements for a vector.\n");
+        return;
+    }
+    int size = (int)view->header->count;
+    if (size == 0) {
+        return;
+    }
+    vector_reserve(vec, size);
+    memcpy(vec->data, view->records, (size_t)size * sizeof(int));
+    vec->size = size;
+}
+
+// --- Bulk Operations ---
+// Batched inserts and the streaming loader. They touch the buffer once per batch instead
+// of once per element, which is what makes loading hundreds of millions of ints practical.
+
+// Makes room for `extra` more elements, at least doubling the capacity so a run of
+// batches stays amortized O(1) per element. Returns 0, or -1 if the size would pass INT_MAX.
+static int vector_make_room(Vector *vec, int extra) {
+    long long needed = (long long)vec->size + extra;
+    if (needed > INT32_MAX) {
+        printf("Error: Too many elements for a vector.\n");
+        return -1;
+    }
+    if (needed > vec->capacity) {
+        long long doubled = (long long)vec->capacity * 2;
+        vector_reserve(vec, (int)(doubled > needed && doubled <= INT32_MAX ? doubled : needed));
+    }
+    return 0;
+}
+
+// 17. Append Many: O(k) amortized
+// This function appends count elements with at most one resize and one memcpy.
+// Time complexity: O(k) amortized, where k is count.
+void vector_append_many(Vector *vec, const int *values, int count) {
+    if (count < 0) {
+        printf("Error: Invalid count.\n");
+        return;
+    }
+    if (count == 0 || vector_make_room(vec, count) != 0) {
+        return;
+    }
+    memcpy(&vec->data[vec->size], values, (size_t)count * sizeof(int));
+    vec->size += count;
+}
+
+// 18. Insert Elements Function: O(n + k)
+// This function inserts count elements before index, in their order. The tail is shifted
+// once by count places, where count calls to insert_element would shift it count times.
+// Index == size appends at the end.
+// Time complexity: O(n + k) where n is the size and k is count.
+void insert_elements(Vector *vec, int index, const int *values, int count) {
+    if (index < 0 || index > vec->size) {
+        printf("Error: Index out of bounds.\n");
+        return;
+    }
+    if (count < 0) {
+        printf("Error: Invalid count.\n");
+        return;
+    }
+    if (count == 0 || vector_make_room(vec, count) != 0) {
+        return;
+    }
+    memmove(&vec->data[index + count], &vec->data[index], (size_t)(vec->size - index) * sizeof(int));
+    memcpy(&vec->data[index], values, (size_t)count * sizeof(int));
+    vec->size += count;
+}
+
+// 19. Ingest Array: O(n)
+// This function appends every int of a text or binary file (see common/ingest.h) to vec.
+// NULL or "-" reads stdin. The reader parses straight into the spare capacity at the end
+// of the buffer, so there is no copy between the parser and the vector. Binary files
+// reserve their exact size up front (plus one slot, so the read that finds the end of the
+// file does not trigger a resize).
+// Returns the number of elements appended, or -1 (with an error message) on an unreadable
+// file or bad input; the elements read before the error stay in vec.
+// Time complexity: O(n), where n is the number of bytes in the file.
+int ingest_array(Vector *vec, const char *path, int format) {
+    IntReader reader;
+    if (ingest_open(&reader, path, format) != 0) {
+        return -1;
+    }
+    uint64_t hint = ingest_size_hint(&reader);
+    if (hint > 0 && vector_make_room(vec, hint < INT32_MAX ? (int)hint + 1 : INT32_MAX) != 0) {
+        ingest_close(&reader);
+        return -1;
+    }
+    int before = vec->size;
+    int count = 0;
+    while (1) {
+        if (vec->size == vec->capacity && vector_make_room(vec, INGEST_BATCH) != 0) {
+            count = -1;
+            break;
+        }
+        count = ingest_read(&reader, &vec->data[vec->size], vec->capacity - vec->size);
+        if (count <= 0) {
+            break;
+        }
+        vec->size += count;
+    }
+    ingest_close(&reader);
+    return count < 0 ? -1 : vec->size - before;
+}
+
+// 20. Dump Array: O(n)
+// This function writes every element to out in out's format: one int per line (DUMP_TEXT)
+// or raw 32-bit ints (DUMP_BINARY). Both read back with ingest_array.
+// Time complexity: O(n) where n is the number of elements in the array.
+void dump_array(const Vector *vec, DumpWriter *out) {
+    if (out->format == DUMP_BINARY) {
+        dump_bytes(out, vec->data, (size_t)vec->size * sizeof(int));  // Already in dump layout
+        return;
+    }
+    for (int i = 0; i < vec->size; i++) {
+        dump_value(out, vec->data[i]);
+    }
+}
+
+// --- Hash Index ---
+// The index stores, for each distinct value, how many elements hold it and the position
+// of the first one. Every change keeps that position exact: an insert or delete moves the
+// positions after it by one (a lookup per moved element, or one pass over the index when
+// many moved), and when the first occurrence of a value goes away, the next one is found by
+// scanning forward from it.
+
+// Records that data[index] now holds value (the element is already in the vector).
+static void vector_index_add(HashedVector *hv, int value, int index) {
+    HashEntry *entry = hash_index_upsert(&hv->index, value);
+    if (entry->count == 0 || entry->ref > index) {
+        entry->ref = index;  // New value, or a new first occurrence
+    }
+    entry->count++;
+}
+
+// Forgets data[index] (the element is still in the vector). If it was the first occurrence,
+// the others all come after it, so the next one is the first match to the right.
+static void vector_index_remove(HashedVector *hv, int index) {
+    int value = hv->vec.data[index];
+    HashEntry *entry = hash_index_lookup(&hv->index, value);
+    if (--entry->count == 0) {
+        hash_index_erase(&hv->index, entry);
+    } else if (entry->ref == index) {
+        entry->ref = index + 1 + scan_find_int(&hv->vec.data[index + 1], hv->vec.size - index - 1, value);
+    }
+}
+
+// Fixes the stored positions after data[first..last) moved by delta (+1 or -1). Only a
+// first occurrence has its position stored, so when few elements moved it is cheaper to
+// look each one up than to pass over the whole index. The order matters with duplicates:
+// walking against the move, a later copy never sees the first copy's already-updated
+// position. When many elements moved, one pass over the index is cheaper.
+static void vector_index_moved(HashedVector *hv, int first, int last, int delta) {
+    if ((size_t)(last - first) * 16 >= hv->index.capacity) {
+        hash_index_shift(&hv->index, first - delta, delta);
+        return;
+    }
+    for (int k = 0; k < last - first; k++) {
+        int j = delta > 0 ? last - 1 - k : first + k;
+        HashEntry *entry = hash_index_lookup(&hv->index, hv->vec.data[j]);
+        if (entry->ref == j - delta) {
+            entry->ref = j;
+        }
+    }
+}
+
+// 21. Hashed Init: O(1)
+// This function sets up an empty hashed vector.
+// Time complexity: O(1).
+void hashed_vector_init(HashedVector *hv) {
+    vector_init(&hv->vec);
+    hash_index_init(&hv->index);
+}
+
+// 22. Attach: O(n)
+// Moves an existing vector into the hashed vector (the caller's vector is left empty) and
+// indexes every element in one pass.
+// Time complexity: O(n) expected.
+void hashed_vector_attach(HashedVector *hv, Vector *vec) {
+    hashed_vector_free(hv);
+    hv->vec = *vec;
+    vector_init(vec);
+    hash_index_reserve(&hv->index, (size_t)hv->vec.size);
+    for (int i = 0; i < hv->vec.size; i++) {
+        vector_index_add(hv, hv->vec.data[i], i);
+    }
+}
+
+// 23. Detach: O(1)
+// Frees the index and hands the plain vector back to the caller.
+// Time complexity: O(1).
+void hashed_vector_detach(HashedVector *hv, Vector *vec) {
+    *vec = hv->vec;
+    vector_init(&hv->vec);
+    hash_index_free(&hv->index);
+}
+
+// 24. Hashed Push Back: O(1) amortized
+// Time complexity: O(1) amortized, the vector and the index both grow geometrically.
+void hashed_push_back(HashedVector *hv, int value) {
+    vector_push_back(&hv->vec, value);
+    vector_index_add(hv, value, hv->vec.size - 1);
+}
+
+// 25. Hashed Insert: O(n)
+// Inserts as insert_element does, then moves the stored positions of the elements after
+// index by one. Index == size appends, and then no position moves.
+// Time complexity: O(m) expected for m moved elements, at most O(n + d) for d distinct
+// values in the index.
+void hashed_insert_element(HashedVector *hv, int index, int value) {
+    if (index < 0 || index > hv->vec.size) {
         printf("Error: Index out of bounds.\n");
         return;
     }
-    arr[index] = new_value;  // Directly update the value
+    insert_element(&hv->vec, index, value);
+    vector_index_moved(hv, index + 1, hv->vec.size, 1);
+    vector_index_add(hv, value, index);
+}
+
+// 26. Hashed Delete: O(n)
+// Time complexity: O(m) expected for m moved elements, at most O(n + d).
+void hashed_delete_element(HashedVector *hv, int index) {
+    if (index < 0 || index >= hv->vec.size) {
+        printf("Error: Index out of bounds.\n");
+        return;
+    }
+    vector_index_remove(hv, index);
+    delete_element(&hv->vec, index);
+    vector_index_moved(hv, index, hv->vec.size, -1);
+}
+
+// 27. Hashed Update: O(1) expected
+// No element moves, so only the old and the new value's entries change.
+// Time complexity: O(1) expected, plus the forward scan when the old value's first
+// occurrence is overwritten.
+void hashed_update_element(HashedVector *hv, int index, int new_value) {
+    if (index < 0 || index >= hv->vec.size) {
+        printf("Error: Index out of bounds.\n");
+        return;
+    }
+    if (hv->vec.data[index] == new_value) {
+        return;
+    }
+    vector_index_remove(hv, index);
+    hv->vec.data[index] = new_value;
+    vector_index_add(hv, new_value, index);
+}
+
+// 28. Hashed Find: O(1) expected
+// Returns the index of the first element equal to value, or -1, like find_element.
+// Time complexity: O(1) expected, against O(n) for find_element.
+int hashed_find_element(const HashedVector *hv, int value) {
+    const HashEntry *entry = hash_index_lookup(&hv->index, value);
+    return entry == NULL ? -1 : (int)entry->ref;
+}
+
+// 29. Hashed Free: O(1)
+// Releases the vector buffer and the index.
+// Time complexity: O(1).
+void hashed_vector_free(HashedVector *hv) {
+    vector_free(&hv->vec);
+    hash_index_free(&hv->index);
 }
 
 // --- Exercise ---
 // Problem: Given an array of integers, find the maximum element.
 // For simplicity, we assume the array has at least one element.
+// Only main runs the exercise, so benchmarks that include this file next to another
+// program (which has its own exercise_solution) leave it out.
+#ifndef DS_NO_MAIN
 void exercise_solution() {
     // Example array for the exercise
     int example_arr[] = {5, 10, 3, 99, 65, 2, 43, 76};
     int size = 8;  // Size of the array
 
-    // Initialize max with the first element
-    int max = example_arr[0];
-
-    // Traverse the array to find the maximum
-    for (int i = 1; i < size; i++) {
-        if (example_arr[i] > max) {
-            max = example_arr[i];  // Update max if a larger element is found
-        }
-    }
+    // Traverse the array to find the maximum (8 elements per step with AVX2)
+    int max = scan_max_int(example_arr, size);
 
     // Output the result
     printf("The maximum element in the array is: %d\n", max);
 }
+#endif // DS_NO_MAIN
 
 // --- Big O Summary ---
 // 1. Array Initialization: O(1) - Initializing an array takes constant time.
 // 2. Insertion at a specific index: O(n) - Because we might need to shift all elements after the insertion point.
 // 3. Deletion at a specific index: O(n) - Similarly, we need to shift all elements after the deletion point.
-// 4. Finding an element: O(n) - A linear search requires traversing the array.
+// 4. Finding an element: O(n) - A linear search requires traversing the array (n / 8 steps with AVX2).
 // 5. Updating an element: O(1) - Direct access means it takes constant time to update an element.
+// 6. Push Back: O(1) amortized - Doubling the capacity makes resizes rare.
+// 7. Reserve / Shrink to Fit: O(n) - realloc may copy every element once.
+// 8. Min / Max / Count: O(n) - SIMD scans, n / 8 steps with AVX2.
+// 9. Save / Load Array: O(n) - One buffered write, one memcpy.
+// 10. Open Array Snapshot: O(1) - The mapped file is used as the vector's buffer.
+// 11. Append Many / Insert Elements: O(n + k) - One resize and one shift per batch of k, not per element.
+// 12. Ingest Array: O(n) - One pass over the file, parsed straight into the buffer.
+// 13. Print / Dump Array: O(n) - Formatted into one buffer, one write(2) per MiB.
+// 14. Hashed Find: O(1) expected - One hash index lookup instead of a scan.
+// 15. Hashed Push Back / Update: O(1) expected - One or two index entries change.
+// 16. Hashed Insert / Delete: O(n + d) - The memmove plus fixing the moved positions (per element, or one index pass).
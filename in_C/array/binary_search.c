@@ -0,0 +1,421 @@
+// This C program ports binarySearch.py to C and adds faster variants of the same search
+// for sorted int and double arrays, explaining each one along with its Big O complexity.
+// All variants are O(log n); they differ in how well they use the CPU:
+//   1. Classic: the loop from binarySearch.py. Each step is a hard-to-predict branch.
+//   2. Branchless: the comparison becomes arithmetic instead of a branch, and the two
+//      possible next probes are prefetched, so the CPU never waits on a misprediction.
+//   3. Eytzinger: the array is stored in BFS order (like a heap), so the first levels of
+//      the search share a few cache lines and the next probes can be prefetched 4 levels ahead.
+//   4. K-ary (S-tree): the array is stored as a static B-tree with one cache line per node,
+//      and each node is searched with AVX2 compares, so a lookup touches log_17(n) lines.
+// Layouts 3 and 4 are built once from a sorted array; the search returns the slot in that
+// layout, so payloads for lookup tables should be stored in the same order.
+
+// --- Includes Section ---
+#include <stdio.h>
+#include <stdlib.h>
+#include <limits.h>
+#include <math.h>
+#include "../common/simd_scan.h"  // scan_cpu_level() for AVX2 detection
+
+// --- Struct Definitions ---
+// Keys per k-ary node: one 64 byte cache line.
+#define KARY_INT_KEYS 16
+#define KARY_DOUBLE_KEYS 8
+
+// Static B-tree over ints. Node k holds keys[k * 16 .. k * 16 + 15]; its children are
+// nodes k * 17 + 1 .. k * 17 + 17. Unused slots are padded with INT_MAX.
+typedef struct KaryTreeInt {
+    int *keys;             // blocks * 16 keys, 64 byte aligned
+    int blocks;            // Number of nodes
+    int has_max;           // 1 if INT_MAX is a real key (padding uses the same value)
+} KaryTreeInt;
+
+// Same for doubles: 8 keys per node, 9 children, padding is +INFINITY.
+typedef struct KaryTreeDouble {
+    double *keys;
+    int blocks;
+    int has_max;
+} KaryTreeDouble;
+
+// --- Function Declarations ---
+int binary_search_int(const int *arr, int size, int target);
+int binary_search_double(const double *arr, int size, double target);
+int branchless_search_int(const int *arr, int size, int target);
+int branchless_search_double(const double *arr, int size, double target);
+int* eytzinger_build_int(const int *sorted, int size);
+double* eytzinger_build_double(const double *sorted, int size);
+int eytzinger_search_int(const int *eyt, int size, int target);
+int eytzinger_search_double(const double *eyt, int size, double target);
+void kary_build_int(KaryTreeInt *tree, const int *sorted, int size);
+void kary_build_double(KaryTreeDouble *tree, const double *sorted, int size);
+int kary_search_int(const KaryTreeInt *tree, int target);
+int kary_search_double(const KaryTreeDouble *tree, double target);
+void kary_free_int(KaryTreeInt *tree);
+void kary_free_double(KaryTreeDouble *tree);
+
+// --- Main Function ---
+// Benchmarks include this file with DS_NO_MAIN defined to reuse the searches.
+#ifndef DS_NO_MAIN
+int main() {
+    // Sorted input: the odd numbers 1, 3, ..., 99
+    int arr[50];
+    for (int i = 0; i < 50; i++) {
+        arr[i] = 2 * i + 1;
+    }
+
+    // 1. Classic and branchless searches return the index in the sorted array
+    printf("Searching 37 in 1, 3, ..., 99:\n");
+    printf("Classic: index %d\n", binary_search_int(arr, 50, 37));
+    printf("Branchless: index %d\n", branchless_search_int(arr, 50, 37));
+    printf("Classic, missing 38: index %d\n", binary_search_int(arr, 50, 38));
+
+    // 2. Eytzinger and k-ary layouts return the slot in their own layout
+    int *eyt = eytzinger_build_int(arr, 50);
+    int slot = eytzinger_search_int(eyt, 50, 37);
+    printf("Eytzinger: slot %d holds %d\n", slot, eyt[slot]);
+    free(eyt);
+
+    KaryTreeInt tree;
+    kary_build_int(&tree, arr, 50);
+    slot = kary_search_int(&tree, 37);
+    printf("K-ary: slot %d holds %d\n", slot, tree.keys[slot]);
+    printf("K-ary, missing 38: slot %d\n", kary_search_int(&tree, 38));
+    kary_free_int(&tree);
+
+    // 3. Doubles, the example from binarySearch.py
+    double hey[] = {1.2, 3.4, 5.6, 7.8, 9.0};
+    double needle = 5.6;
+    printf("\nSearching 5.6 in [1.2, 3.4, 5.6, 7.8, 9.0]:\n");
+    printf("Classic: index %d\n", binary_search_double(hey, 5, needle));
+    printf("Branchless: index %d\n", branchless_search_double(hey, 5, needle));
+    double *eyt_d = eytzinger_build_double(hey, 5);
+    printf("Eytzinger: slot %d\n", eytzinger_search_double(eyt_d, 5, needle));
+    free(eyt_d);
+    KaryTreeDouble tree_d;
+    kary_build_double(&tree_d, hey, 5);
+    printf("K-ary: slot %d\n", kary_search_double(&tree_d, needle));
+    kary_free_double(&tree_d);
+
+    return 0;
+}
+#endif // DS_NO_MAIN
+
+// --- Helpers ---
+
+// Allocates memory aligned to a 64 byte cache line.
+static void* alloc_aligned(size_t bytes) {
+    size_t rounded = (bytes + 63) / 64 * 64;  // aligned_alloc needs a multiple of the alignment
+    void *ptr = aligned_alloc(64, rounded == 0 ? 64 : rounded);
+    if (!ptr) {
+        printf("Memory allocation error!\n");
+        exit(1);  // Exit if memory allocation fails
+    }
+    return ptr;
+}
+
+// --- Classic Binary Search ---
+
+// 1. Classic Search: O(log n)
+// The loop from binarySearch.py: compare with the middle element and keep one half.
+// Returns the index of target, or -1 if it is not in the array.
+// Time complexity: O(log n), with one unpredictable branch per step.
+int binary_search_int(const int *arr, int size, int target) {
+    int left = 0;
+    int right = size - 1;
+    while (left <= right) {
+        int mid = left + (right - left) / 2;  // Avoids overflow of left + right
+        if (arr[mid] == target) {
+            return mid;
+        } else if (arr[mid] < target) {
+            left = mid + 1;
+        } else {
+            right = mid - 1;
+        }
+    }
+    return -1;
+}
+
+int binary_search_double(const double *arr, int size, double target) {
+    int left = 0;
+    int right = size - 1;
+    while (left <= right) {
+        int mid = left + (right - left) / 2;
+        if (arr[mid] == target) {
+            return mid;
+        } else if (arr[mid] < target) {
+            left = mid + 1;
+        } else {
+            right = mid - 1;
+        }
+    }
+    return -1;
+}
+
+// --- Branchless Binary Search ---
+
+// 2. Branchless Search: O(log n)
+// Keeps a base pointer and a remaining length. Each step halves the length and moves the
+// base forward when the middle element is smaller than target. The move is written as
+// arithmetic (compare result times half), so it compiles without a branch.
+// Both candidates for the next probe are prefetched.
+// The loop always runs ceil(log2(n)) times, then one final compare checks for a match.
+// Time complexity: O(log n), with no data-dependent branches.
+int branchless_search_int(const int *arr, int size, int target) {
+    if (size <= 0) {
+        return -1;
+    }
+    const int *base = arr;
+    int length = size;
+    while (length > 1) {
+        int half = length / 2;
+        __builtin_prefetch(&base[half / 2]);           // Next probe if we stay
+        __builtin_prefetch(&base[half + half / 2]);    // Next probe if we move
+        base += (base[half - 1] < target) * half;  // Arithmetic, so the compiler cannot emit a branch
+        length -= half;
+    }
+    int pos = (int)(base - arr);
+    return arr[pos] == target ? pos : -1;
+}
+
+int branchless_search_double(const double *arr, int size, double target) {
+    if (size <= 0) {
+        return -1;
+    }
+    const double *base = arr;
+    int length = size;
+    while (length > 1) {
+        int half = length / 2;
+        __builtin_prefetch(&base[half / 2]);
+        __builtin_prefetch(&base[half + half / 2]);
+        base += (base[half - 1] < target) * half;  // Arithmetic, so the compiler cannot emit a branch
+        length -= half;
+    }
+    int pos = (int)(base - arr);
+    return arr[pos] == target ? pos : -1;
+}
+
+// --- Eytzinger (BFS) Layout ---
+// Slot 1 is the root, and the children of slot k are slots 2k and 2k + 1, like a binary
+// heap. Filling the slots with an in-order walk puts the sorted array into this shape.
+
+static int eytzinger_fill_int(const int *sorted, int *eyt, int size, int next, int k) {
+    if (k <= size) {
+        next = eytzinger_fill_int(sorted, eyt, size, next, 2 * k);      // Left subtree
+        eyt[k] = sorted[next++];                                        // This slot
+        next = eytzinger_fill_int(sorted, eyt, size, next, 2 * k + 1);  // Right subtree
+    }
+    return next;
+}
+
+static int eytzinger_fill_double(const double *sorted, double *eyt, int size, int next, int k) {
+    if (k <= size) {
+        next = eytzinger_fill_double(sorted, eyt, size, next, 2 * k);
+        eyt[k] = sorted[next++];
+        next = eytzinger_fill_double(sorted, eyt, size, next, 2 * k + 1);
+    }
+    return next;
+}
+
+// 3. Eytzinger Build: O(n)
+// Returns a new 64 byte aligned array of size + 1 slots (slot 0 is unused). Free it with free().
+// The recursion is only log2(n) deep.
+// Time complexity: O(n).
+int* eytzinger_build_int(const int *sorted, int size) {
+    int *eyt = (int*)alloc_aligned((size_t)(size + 1) * sizeof(int));
+    eyt[0] = 0;
+    eytzinger_fill_int(sorted, eyt, size, 0, 1);
+    return eyt;
+}
+
+double* eytzinger_build_double(const double *sorted, int size) {
+    double *eyt = (double*)alloc_aligned((size_t)(size + 1) * sizeof(double));
+    eyt[0] = 0.0;
+    eytzinger_fill_double(sorted, eyt, size, 0, 1);
+    return eyt;
+}
+
+// 4. Eytzinger Search: O(log n)
+// Walks down from slot 1: go right (2k + 1) when the slot is smaller than target, else left.
+// The 16 slots four levels below k are one cache line (16 ints), so prefetching eyt[16k]
+// hides most of the memory latency. When the walk falls off the tree, the trailing one bits
+// of k are the right turns taken since the last left turn; shifting them out gives the
+// slot of the lower bound.
+// Returns the slot of target in eyt, or -1 if it is not there.
+// Time complexity: O(log n), with no data-dependent branches.
+int eytzinger_search_int(const int *eyt, int size, int target) {
+    unsigned k = 1;
+    while (k <= (unsigned)size) {
+        __builtin_prefetch(&eyt[16 * k]);  // Prefetching past the end is harmless
+        k = 2 * k + (eyt[k] < target);
+    }
+    k >>= __builtin_ffs((int)~k);  // Undo the right turns after the last left turn
+    return k != 0 && eyt[k] == target ? (int)k : -1;
+}
+
+int eytzinger_search_double(const double *eyt, int size, double target) {
+    unsigned k = 1;
+    while (k <= (unsigned)size) {
+        __builtin_prefetch(&eyt[8 * k]);  // 8 doubles per cache line, three levels ahead
+        k = 2 * k + (eyt[k] < target);
+    }
+    k >>= __builtin_ffs((int)~k);
+    return k != 0 && eyt[k] == target ? (int)k : -1;
+}
+
+// --- K-ary (S-tree) Layout ---
+
+// Child `branch` (0..keys_per_node) of node k.
+static inline int kary_child(int k, int branch, int keys_per_node) {
+    return k * (keys_per_node + 1) + branch + 1;
+}
+
+static int kary_fill_int(KaryTreeInt *tree, const int *sorted, int size, int next, int k) {
+    if (k < tree->blocks) {
+        for (int i = 0; i < KARY_INT_KEYS; i++) {
+            next = kary_fill_int(tree, sorted, size, next, kary_child(k, i, KARY_INT_KEYS));
+            tree->keys[k * KARY_INT_KEYS + i] = next < size ? sorted[next++] : INT_MAX;
+        }
+        next = kary_fill_int(tree, sorted, size, next, kary_child(k, KARY_INT_KEYS, KARY_INT_KEYS));
+    }
+    return next;
+}
+
+static int kary_fill_double(KaryTreeDouble *tree, const double *sorted, int size, int next, int k) {
+    if (k < tree->blocks) {
+        for (int i = 0; i < KARY_DOUBLE_KEYS; i++) {
+            next = kary_fill_double(tree, sorted, size, next, kary_child(k, i, KARY_DOUBLE_KEYS));
+            tree->keys[k * KARY_DOUBLE_KEYS + i] = next < size ? sorted[next++] : INFINITY;
+        }
+        next = kary_fill_double(tree, sorted, size, next, kary_child(k, KARY_DOUBLE_KEYS, KARY_DOUBLE_KEYS));
+    }
+    return next;
+}
+
+// 5. K-ary Build: O(n)
+// Lays the sorted array out as a static B-tree with one cache line per node.
+// Time complexity: O(n).
+void kary_build_int(KaryTreeInt *tree, const int *sorted, int size) {
+    tree->blocks = (size + KARY_INT_KEYS - 1) / KARY_INT_KEYS;
+    tree->keys = (int*)alloc_aligned((size_t)tree->blocks * KARY_INT_KEYS * sizeof(int));
+    tree->has_max = size > 0 && sorted[size - 1] == INT_MAX;
+    kary_fill_int(tree, sorted, size, 0, 0);
+}
+
+void kary_build_double(KaryTreeDouble *tree, const double *sorted, int size) {
+    tree->blocks = (size + KARY_DOUBLE_KEYS - 1) / KARY_DOUBLE_KEYS;
+    tree->keys = (double*)alloc_aligned((size_t)tree->blocks * KARY_DOUBLE_KEYS * sizeof(double));
+    tree->has_max = size > 0 && sorted[size - 1] == INFINITY;
+    kary_fill_double(tree, sorted, size, 0, 0);
+}
+
+// Number of keys in one int node that are smaller than target.
+#ifdef SIMD_SCAN_X86
+__attribute__((target("avx2")))
+static int kary_rank_int_avx2(const int *node, int target) {
+    __m256i x = _mm256_set1_epi32(target);
+    __m256i lo = _mm256_cmpgt_epi32(x, _mm256_load_si256((const __m256i*)node));
+    __m256i hi = _mm256_cmpgt_epi32(x, _mm256_load_si256((const __m256i*)(node + 8)));
+    unsigned mask = (unsigned)_mm256_movemask_ps(_mm256_castsi256_ps(lo))
+                  | (unsigned)_mm256_movemask_ps(_mm256_castsi256_ps(hi)) << 8;
+    return __builtin_popcount(mask);
+}
+
+__attribute__((target("avx2")))
+static int kary_rank_double_avx2(const double *node, double target) {
+    __m256d x = _mm256_set1_pd(target);
+    __m256d lo = _mm256_cmp_pd(_mm256_load_pd(node), x, _CMP_LT_OQ);
+    __m256d hi = _mm256_cmp_pd(_mm256_load_pd(node + 4), x, _CMP_LT_OQ);
+    unsigned mask = (unsigned)_mm256_movemask_pd(lo) | (unsigned)_mm256_movemask_pd(hi) << 4;
+    return __builtin_popcount(mask);
+}
+#endif
+
+static int kary_rank_int_scalar(const int *node, int target) {
+    int rank = 0;
+    for (int i = 0; i < KARY_INT_KEYS; i++) {
+        rank += node[i] < target;
+    }
+    return rank;
+}
+
+static int kary_rank_double_scalar(const double *node, double target) {
+    int rank = 0;
+    for (int i = 0; i < KARY_DOUBLE_KEYS; i++) {
+        rank += node[i] < target;
+    }
+    return rank;
+}
+
+// 6. K-ary Search: O(log n)
+// In each node, count the keys smaller than target (one AVX2 compare per 8 keys). That count
+// is the branch to follow. The first key >= target seen on the way down is the lower bound.
+// Returns the slot of target in tree->keys, or -1 if it is not there.
+// Time complexity: O(log_17(n)) nodes for ints, O(log_9(n)) for doubles, one cache line each.
+int kary_search_int(const KaryTreeInt *tree, int target) {
+    int k = 0;
+    int found = -1;
+    int avx2 = scan_cpu_level() >= 2;
+    while (k < tree->blocks) {
+        const int *node = &tree->keys[k * KARY_INT_KEYS];
+#ifdef SIMD_SCAN_X86
+        int rank = avx2 ? kary_rank_int_avx2(node, target) : kary_rank_int_scalar(node, target);
+#else
+        int rank = kary_rank_int_scalar(node, target);
+        (void)avx2;
+#endif
+        if (rank < KARY_INT_KEYS) {
+            found = k * KARY_INT_KEYS + rank;  // Smallest key >= target so far
+        }
+        k = kary_child(k, rank, KARY_INT_KEYS);
+    }
+    if (found < 0 || tree->keys[found] != target || (target == INT_MAX && !tree->has_max)) {
+        return -1;
+    }
+    return found;
+}
+
+int kary_search_double(const KaryTreeDouble *tree, double target) {
+    int k = 0;
+    int found = -1;
+    int avx2 = scan_cpu_level() >= 2;
+    while (k < tree->blocks) {
+        const double *node = &tree->keys[k * KARY_DOUBLE_KEYS];
+#ifdef SIMD_SCAN_X86
+        int rank = avx2 ? kary_rank_double_avx2(node, target) : kary_rank_double_scalar(node, target);
+#else
+        int rank = kary_rank_double_scalar(node, target);
+        (void)avx2;
+#endif
+        if (rank < KARY_DOUBLE_KEYS) {
+            found = k * KARY_DOUBLE_KEYS + rank;
+        }
+        k = kary_child(k, rank, KARY_DOUBLE_KEYS);
+    }
+    if (found < 0 || tree->keys[found] != target || (target == INFINITY && !tree->has_max)) {
+        return -1;
+    }
+    return found;
+}
+
+// 7. K-ary Free: O(1)
+void kary_free_int(KaryTreeInt *tree) {
+    free(tree->keys);
+    tree->keys = NULL;
+    tree->blocks = 0;
+}
+
+void kary_free_double(KaryTreeDouble *tree) {
+    free(tree->keys);
+    tree->keys = NULL;
+    tree->blocks = 0;
+}
+
+// --- Big O Summary ---
+// 1. Classic Search: O(log n) - One branch per level, about half of them mispredicted.
+// 2. Branchless Search: O(log n) - Arithmetic instead of branches, plus prefetching.
+// 3. Eytzinger Build: O(n) - One in-order walk of the implicit tree.
+// 4. Eytzinger Search: O(log n) - The top levels share cache lines, the rest are prefetched.
+// 5. K-ary Build: O(n) - One in-order walk of the implicit B-tree.
+// 6. K-ary Search: O(log_17 n) - One cache line and two AVX2 compares per level.
+// Keys must not be NaN: NaN breaks the ordering every search relies on.
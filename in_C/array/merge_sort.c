@@ -0,0 +1,409 @@
+// This C program ports merge_sort and merge from in_Python/tricks.py to C for int arrays,
+// explaining each part along with its Big O complexity. The Python version slices a new
+// list for every half and builds a new list for every merge; here the whole sort works
+// in the array itself plus one scratch buffer of n ints, allocated once:
+//   1. Base case: blocks of 64 keys are sorted by a sorting network. With AVX2 the network
+//      sorts 8 columns at once (one key per lane, 19 min/max pairs), a transpose turns the
+//      columns into 8 sorted runs of 8, and three short merges finish the block in L1.
+//   2. Merge sort: top-down recursion that alternates between the array and the scratch
+//      buffer, so every level merges straight into the other one with no copy back. The
+//      recursion works on ever smaller halves, so once a half fits in a cache level all of
+//      its levels run there, whatever the cache sizes are (cache-oblivious).
+//   3. Parallel merge sort: each thread of a pool sorts one slice with (2), then all the
+//      threads merge the sorted slices pairwise, round after round. In every round each
+//      thread writes an equal share of the output, found with a binary search (merge path),
+//      so the last rounds keep all threads busy too.
+// The linked lists sort their nodes with sort_list in SLL/SLL_FIRTS.c and DDL/DDL_first.c.
+//
+// Build:  gcc -O2 -pthread merge_sort.c -o merge_sort
+
+// --- Includes Section ---
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include "../common/simd_scan.h"  // scan_cpu_level() for AVX2 detection
+#include "../common/pool.h"  // Fork-join thread pool
+
+// --- Struct Definitions ---
+#define SORT_BLOCK 64               // Keys sorted by one run of the network base case
+#define SORT_PARALLEL_MIN (1 << 16) // Below this many keys the parallel sort runs on one thread
+
+// Shared state of a parallel sort. Run r covers [bounds[r], bounds[r + 1]).
+typedef struct MergeJob {
+    int *arr;                  // The keys; also the source of the first merge round
+    int *scratch;              // The one scratch buffer, n ints
+    int n;
+    int *bounds;               // runs + 1 run boundaries
+    int runs;                  // Sorted runs left
+    const int *src;            // This round reads the runs from here ...
+    int *dst;                  // ... and writes the merged pairs here
+} MergeJob;
+
+// --- Function Declarations ---
+void network_sort_block(const int *src, int *dst, int n);
+void merge_runs(const int *a, int na, const int *b, int nb, int *out);
+void merge_sort_with(int *arr, int *scratch, int n);
+void merge_sort_int(int *arr, int n);
+void parallel_merge_sort(WorkPool *pool, int *arr, int n);
+
+// --- Main Function ---
+// Benchmarks include this file with DS_NO_MAIN defined to reuse the sorts.
+#ifndef DS_NO_MAIN
+int main() {
+    // 1. Sorting Network: one block of up to 64 keys
+    int small[] = {38, 27, 43, 3, 9, 82, 10, 3, -5, 64, 0, 17};
+    int count = (int)(sizeof(small) / sizeof(small[0]));
+    printf("Sorting a block of %d keys with the network:\n", count);
+    network_sort_block(small, small, count);
+    for (int i = 0; i < count; i++) {
+        printf("%d ", small[i]);
+    }
+    printf("\n");
+
+    // 2. Merge Sort: one scratch buffer for the whole sort
+    int n = 1000;
+    int *arr = (int*)malloc((size_t)n * sizeof(int));
+    if (!arr) {
+        printf("Memory allocation error!\n");
+        exit(1);
+    }
+    for (int i = 0; i < n; i++) {
+        arr[i] = (i * 7919) % n;  // A permutation of 0 .. 999
+    }
+    merge_sort_int(arr, n);
+    printf("\nMerge sort of a permutation of 0..%d: first %d, last %d, %s\n", n - 1, arr[0], arr[n - 1],
+           arr[500] == 500 ? "in order." : "out of order.");
+
+    // 3. Parallel Merge Sort: 4 threads, one scratch buffer
+    int big = 200000;
+    int *keys = (int*)malloc((size_t)big * sizeof(int));
+    if (!keys) {
+        printf("Memory allocation error!\n");
+        exit(1);
+    }
+    for (int i = 0; i < big; i++) {
+        keys[i] = big - i;  // Descending
+    }
+    WorkPool pool;
+    pool_init(&pool, 4);
+    parallel_merge_sort(&pool, keys, big);
+    pool_free(&pool);
+    int sorted = 1;
+    for (int i = 1; i < big; i++) {
+        sorted &= keys[i - 1] <= keys[i];
+    }
+    printf("Parallel merge sort of %d descending keys on 4 threads: %s\n", big,
+           sorted ? "in order." : "out of order.");
+
+    free(arr);
+    free(keys);
+    return 0;
+}
+#endif // DS_NO_MAIN
+
+// --- Sorting Network Base Case ---
+
+// The optimal 8-input sorting network (19 comparators in 6 layers). CMPSWAP(x, y) must
+// leave the smaller value in x and the larger one in y.
+#define SORT_NETWORK8(CMPSWAP, r)                                                   \
+    do {                                                                            \
+        CMPSWAP(r[0], r[2]); CMPSWAP(r[1], r[3]); CMPSWAP(r[4], r[6]); CMPSWAP(r[5], r[7]); \
+        CMPSWAP(r[0], r[4]); CMPSWAP(r[1], r[5]); CMPSWAP(r[2], r[6]); CMPSWAP(r[3], r[7]); \
+        CMPSWAP(r[0], r[1]); CMPSWAP(r[2], r[3]); CMPSWAP(r[4], r[5]); CMPSWAP(r[6], r[7]); \
+        CMPSWAP(r[2], r[4]); CMPSWAP(r[3], r[5]);                                   \
+        CMPSWAP(r[1], r[4]); CMPSWAP(r[3], r[6]);                                   \
+        CMPSWAP(r[1], r[2]); CMPSWAP(r[3], r[4]); CMPSWAP(r[5], r[6]);              \
+    } while (0)
+
+// Branch-free compare-exchange of two ints (compilers emit cmov or min/max).
+#define SCALAR_CMPSWAP(x, y)                 \
+    do {                                     \
+        int lo_ = (x) < (y) ? (x) : (y);     \
+        int hi_ = (x) < (y) ? (y) : (x);     \
+        (x) = lo_;                           \
+        (y) = hi_;                           \
+    } while (0)
+
+// Sorts each row of 8 in block[64] with the network: 8 sorted runs of 8.
+static void network_rows_scalar(int *block) {
+    for (int row = 0; row < SORT_BLOCK; row += 8) {
+        int *r = &block[row];
+        SORT_NETWORK8(SCALAR_CMPSWAP, r);
+    }
+}
+
+#ifdef SIMD_SCAN_X86
+#define AVX2_CMPSWAP(x, y)                          \
+    do {                                            \
+        __m256i lo_ = _mm256_min_epi32((x), (y));   \
+        (y) = _mm256_max_epi32((x), (y));           \
+        (x) = lo_;                                  \
+    } while (0)
+
+// Same result with AVX2: the network runs down the 8 columns at once, one per lane, and an
+// 8x8 transpose turns the sorted columns into sorted rows. block must be 32 byte aligned.
+__attribute__((target("avx2")))
+static void network_rows_avx2(int *block) {
+    __m256i r[8];
+    for (int i = 0; i < 8; i++) {
+        r[i] = _mm256_load_si256((const __m256i*)&block[8 * i]);
+    }
+    SORT_NETWORK8(AVX2_CMPSWAP, r);
+
+    // Transpose: pairs of 32-bit lanes, then pairs of 64-bit lanes, then the 128-bit halves
+    __m256i t[8], u[8];
+    for (int i = 0; i < 8; i += 4) {
+        t[i] = _mm256_unpacklo_epi32(r[i], r[i + 1]);
+        t[i + 1] = _mm256_unpackhi_epi32(r[i], r[i + 1]);
+        t[i + 2] = _mm256_unpacklo_epi32(r[i + 2], r[i + 3]);
+        t[i + 3] = _mm256_unpackhi_epi32(r[i + 2], r[i + 3]);
+        u[i] = _mm256_unpacklo_epi64(t[i], t[i + 2]);
+        u[i + 1] = _mm256_unpackhi_epi64(t[i], t[i + 2]);
+        u[i + 2] = _mm256_unpacklo_epi64(t[i + 1], t[i + 3]);
+        u[i + 3] = _mm256_unpackhi_epi64(t[i + 1], t[i + 3]);
+    }
+    for (int i = 0; i < 4; i++) {
+        _mm256_store_si256((__m256i*)&block[8 * i], _mm256_permute2x128_si256(u[i], u[i + 4], 0x20));
+        _mm256_store_si256((__m256i*)&block[8 * (i + 4)], _mm256_permute2x128_si256(u[i], u[i + 4], 0x31));
+    }
+}
+#endif
+
+// 1. Network Sort Block: O(1)
+// Sorts src[0..n), n <= 64, into dst (src == dst is fine). The block is padded with
+// INT_MAX, which sorts after every real key, so short blocks take the same path.
+// Time complexity: O(1) for at most 64 keys: 19 vector min/max pairs, a transpose and three
+// merges of 64 keys.
+void network_sort_block(const int *src, int *dst, int n) {
+    _Alignas(32) int block[SORT_BLOCK];
+    _Alignas(32) int other[SORT_BLOCK];
+    memcpy(block, src, (size_t)n * sizeof(int));
+    for (int i = n; i < SORT_BLOCK; i++) {
+        block[i] = INT_MAX;
+    }
+#ifdef SIMD_SCAN_X86
+    if (scan_cpu_level() >= 2) {
+        network_rows_avx2(block);
+    } else {
+        network_rows_scalar(block);
+    }
+#else
+    network_rows_scalar(block);
+#endif
+    // Runs of 8 -> 16 -> 32 -> 64, back and forth between the two blocks
+    for (int width = 8; width < SORT_BLOCK; width *= 2) {
+        const int *from = width == 16 ? other : block;
+        int *to = width == 16 ? block : other;
+        for (int i = 0; i < SORT_BLOCK; i += 2 * width) {
+            merge_runs(&from[i], width, &from[i + width], width, &to[i]);
+        }
+    }
+    memcpy(dst, other, (size_t)n * sizeof(int));
+}
+
+// --- Merge Sort ---
+
+// 2. Merge Runs: O(na + nb)
+// The merge from tricks.py on raw arrays: out receives a and b merged, a first on ties (so
+// the sort is stable). The loop has no data-dependent branch: the comparison only decides
+// which pointer moves. When one run lies entirely before the other (sorted or reversed
+// input), both are copied in one go instead.
+// Time complexity: O(na + nb).
+void merge_runs(const int *a, int na, const int *b, int nb, int *out) {
+    if (na > 0 && nb > 0 && a[na - 1] <= b[0]) {
+        memcpy(out, a, (size_t)na * sizeof(int));
+        memcpy(out + na, b, (size_t)nb * sizeof(int));
+        return;
+    }
+    if (na > 0 && nb > 0 && b[nb - 1] < a[0]) {
+        memcpy(out, b, (size_t)nb * sizeof(int));
+        memcpy(out + nb, a, (size_t)na * sizeof(int));
+        return;
+    }
+    const int *a_end = a + na;
+    const int *b_end = b + nb;
+    while (a < a_end && b < b_end) {
+        int va = *a, vb = *b;
+        int take_b = vb < va;
+        *out++ = take_b ? vb : va;
+        a += !take_b;
+        b += take_b;
+    }
+    memcpy(out, a, (size_t)(a_end - a) * sizeof(int));
+    out += a_end - a;
+    memcpy(out, b, (size_t)(b_end - b) * sizeof(int));
+}
+
+// Left half of n > SORT_BLOCK keys: about n / 2, rounded up to whole network blocks.
+static int split_point(int n) {
+    return (n / 2 + SORT_BLOCK - 1) / SORT_BLOCK * SORT_BLOCK;
+}
+
+static void sort_into(int *arr, int *out, int n);
+
+// Sorts arr[0..n) in place; scratch[0..n) is free to use.
+static void sort_in_place(int *arr, int *scratch, int n) {
+    if (n <= SORT_BLOCK) {
+        network_sort_block(arr, arr, n);
+        return;
+    }
+    int half = split_point(n);
+    sort_into(arr, scratch, half);  // Both halves end up sorted in the scratch buffer ...
+    sort_into(arr + half, scratch + half, n - half);
+    merge_runs(scratch, half, scratch + half, n - half, arr);  // ... and merge back into arr
+}
+
+// Sorts arr[0..n) into out[0..n); arr is left as scratch.
+static void sort_into(int *arr, int *out, int n) {
+    if (n <= SORT_BLOCK) {
+        network_sort_block(arr, out, n);
+        return;
+    }
+    int half = split_point(n);
+    sort_in_place(arr, out, half);
+    sort_in_place(arr + half, out + half, n - half);
+    merge_runs(arr, half, arr + half, n - half, out);
+}
+
+// 3. Merge Sort With Scratch: O(n log n)
+// Sorts arr[0..n) using the caller's scratch buffer of n ints; nothing is allocated.
+// Time complexity: O(n log n), every level is one merge pass; for sorted or reversed input
+// every merge is a plain copy.
+void merge_sort_with(int *arr, int *scratch, int n) {
+    if (n > 1) {
+        sort_in_place(arr, scratch, n);
+    }
+}
+
+// 4. Merge Sort: O(n log n)
+// Allocates the scratch buffer once and sorts arr[0..n).
+// Time complexity: O(n log n), with n ints of extra memory against O(n log n) for tricks.py.
+void merge_sort_int(int *arr, int n) {
+    if (n <= 1) {
+        return;
+    }
+    int *scratch = (int*)malloc((size_t)n * sizeof(int));
+    if (!scratch) {
+        printf("Memory allocation error!\n");
+        exit(1);
+    }
+    merge_sort_with(arr, scratch, n);
+    free(scratch);
+}
+
+// --- Parallel Merge Sort ---
+
+// Number of keys of a that come before position k of the merge of a and b (a first on
+// ties), found by binary search: the "merge path" split of the output at k.
+static int co_rank(int k, const int *a, int na, const int *b, int nb) {
+    int lo = k > nb ? k - nb : 0;
+    int hi = k < na ? k : na;
+    while (lo < hi) {
+        int i = lo + (hi - lo) / 2;
+        int j = k - i;
+        if (j > 0 && i < na && b[j - 1] >= a[i]) {
+            lo = i + 1;  // a[i] still comes before b[j - 1]
+        } else {
+            hi = i;
+        }
+    }
+    return lo;
+}
+
+// Phase 1: thread id sorts its slice in place.
+static void sort_slice_job(void *arg, int id, int count) {
+    (void)count;
+    MergeJob *job = (MergeJob*)arg;
+    int lo = job->bounds[id];
+    int hi = job->bounds[id + 1];
+    merge_sort_with(job->arr + lo, job->scratch + lo, hi - lo);
+}
+
+// Phase 2: one merge round. Thread id writes dst[n * id / count .. n * (id + 1) / count),
+// whichever pairs of runs that range covers.
+static void merge_round_job(void *arg, int id, int count) {
+    MergeJob *job = (MergeJob*)arg;
+    int out_lo = (int)((long long)job->n * id / count);
+    int out_hi = (int)((long long)job->n * (id + 1) / count);
+    for (int r = 0; r < job->runs; r += 2) {
+        int base = job->bounds[r];
+        int mid = job->bounds[r + 1];
+        int end = r + 2 <= job->runs ? job->bounds[r + 2] : mid;  // A last run without a partner
+        int lo = out_lo > base ? out_lo : base;
+        int hi = out_hi < end ? out_hi : end;
+        if (lo >= hi) {
+            continue;
+        }
+        const int *a = job->src + base;
+        const int *b = job->src + mid;
+        int na = mid - base, nb = end - mid;
+        int i_lo = co_rank(lo - base, a, na, b, nb);
+        int i_hi = co_rank(hi - base, a, na, b, nb);
+        int j_lo = lo - base - i_lo;
+        int j_hi = hi - base - i_hi;
+        merge_runs(a + i_lo, i_hi - i_lo, b + j_lo, j_hi - j_lo, job->dst + lo);
+    }
+}
+
+// Last phase when the result ended up in the scratch buffer: copy it back in parallel.
+static void copy_back_job(void *arg, int id, int count) {
+    MergeJob *job = (MergeJob*)arg;
+    int lo = (int)((long long)job->n * id / count);
+    int hi = (int)((long long)job->n * (id + 1) / count);
+    memcpy(job->arr + lo, job->scratch + lo, (size_t)(hi - lo) * sizeof(int));
+}
+
+// 5. Parallel Merge Sort: O(n log n / p + n log p / p)
+// Sorts arr[0..n) on the p threads of pool with one scratch buffer of n ints. Each thread
+// sorts a slice of about n / p keys, then log2(p) merge rounds run with every thread
+// writing n / p keys per round. Small arrays are sorted on the calling thread.
+// Time complexity: O(n log n / p) for the slices plus O(n / p) per merge round, O(n)
+// extra memory whatever p is.
+void parallel_merge_sort(WorkPool *pool, int *arr, int n) {
+    if (n < SORT_PARALLEL_MIN || pool->count == 1) {
+        merge_sort_int(arr, n);
+        return;
+    }
+    int threads = pool->count;
+    int *scratch = (int*)malloc((size_t)n * sizeof(int));
+    int *bounds = (int*)malloc((size_t)(threads + 1) * sizeof(int));
+    if (!scratch || !bounds) {
+        printf("Memory allocation error!\n");
+        exit(1);
+    }
+    // Slices start on whole network blocks, so every slice sorts full blocks but the last
+    for (int i = 0; i < threads; i++) {
+        bounds[i] = (int)((long long)n * i / threads / SORT_BLOCK * SORT_BLOCK);
+    }
+    bounds[threads] = n;
+    MergeJob job = { arr, scratch, n, bounds, threads, arr, scratch };
+    pool_run(pool, sort_slice_job, &job);
+
+    while (job.runs > 1) {
+        pool_run(pool, merge_round_job, &job);
+        // Pair r of this round is run r / 2 of the next one
+        int runs = (job.runs + 1) / 2;
+        for (int r = 0; r < runs; r++) {
+            job.bounds[r] = job.bounds[2 * r];
+        }
+        job.bounds[runs] = n;
+        job.runs = runs;
+        const int *src = job.src;
+        job.src = job.dst;
+        job.dst = (int*)src;
+    }
+    if (job.src == scratch) {
+        pool_run(pool, copy_back_job, &job);
+    }
+    free(scratch);
+    free(bounds);
+}
+
+// --- Big O Summary ---
+// 1. Network Sort Block: O(1) - At most 64 keys: 19 min/max layers on 8 lanes, then three merges.
+// 2. Merge Runs: O(na + nb) - Branch-free; runs that do not overlap are copied.
+// 3. Merge Sort: O(n log n) - O(n) extra memory in one buffer, against a new list per call in
+//    tricks.py; plain copies on sorted or reversed input.
+// 4. Parallel Merge Sort: O(n log n / p + n log p / p) on p threads - Every merge round is
+//    split evenly by output position, so no thread waits for the largest run.
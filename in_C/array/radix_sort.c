@@ -0,0 +1,443 @@
+// This C program sorts 32-bit int arrays with an LSD (least significant digit first) radix
+// sort, explaining each part along with its Big O complexity. A comparison sort such as
+// merge_sort (tricks.py, array/merge_sort.c) needs about n log2 n comparisons; radix sort
+// never compares two keys. It distributes the keys by one digit at a time, lowest digit
+// first, and each distribution is stable, so after the last digit the keys are in order:
+//   1. Digits of 8 bits (4 passes, 256 buckets) or 11 bits (3 passes, 2048 buckets). Wider
+//      digits mean fewer passes over the data but more output streams per pass.
+//   2. One read of the keys counts the digits of every pass at once (one histogram per
+//      pass); each pass then only moves keys.
+//   3. A pass whose digit is the same for every key would move nothing, so it is skipped:
+//      small non-negative keys, for example, skip the upper passes.
+//   4. Key-only and key + payload versions: the payload (an index, a row id, ...) moves
+//      with its key, and equal keys keep their order.
+//   5. Parallel version: each thread of a pool counts and moves its own slice of the
+//      array; a prefix sum over (digit, thread) tells every thread where its keys go.
+// The sort needs one scratch buffer the size of the input (two with a payload).
+//
+// Build:  gcc -O2 -pthread radix_sort.c -o radix_sort
+
+// --- Includes Section ---
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include "../common/pool.h"  // Fork-join thread pool
+
+// --- Struct Definitions ---
+#define RADIX_MAX_PASSES 4          // 32 bits in 8-bit digits
+#define RADIX_MAX_BUCKETS 2048      // 11-bit digits
+#define RADIX_WIDE_MIN (1 << 16)    // From this many keys on, 11-bit digits are used
+#define RADIX_SMALL 64              // Below this many keys, radix_sort_int uses insertion sort
+#define RADIX_PARALLEL_MIN (1 << 17) // Below this many keys the parallel sort runs on one thread
+
+// One histogram per pass: counts[pass][digit], later turned into write offsets.
+typedef uint32_t RadixCounts[RADIX_MAX_PASSES][RADIX_MAX_BUCKETS];
+
+// Shared state of a parallel sort. Thread t owns the slice [n * t / p, n * (t + 1) / p).
+typedef struct RadixJob {
+    const int *src;            // Keys (and payloads) are read from here ...
+    int *dst;                  // ... and written here in the current pass
+    const int *src_values;     // NULL for the key-only sort
+    int *dst_values;
+    int n;
+    int bits;
+    int pass;                  // Current pass
+    RadixCounts *counts;       // One set of histograms per thread
+} RadixJob;
+
+// --- Function Declarations ---
+void radix_sort_with(int *arr, int *scratch, int n, int bits);
+void radix_sort_int(int *arr, int n);
+void radix_sort_pairs_with(int *keys, int *values, int *key_scratch, int *value_scratch, int n, int bits);
+void radix_sort_pairs(int *keys, int *values, int n);
+void parallel_radix_sort(WorkPool *pool, int *arr, int n);
+void parallel_radix_sort_pairs(WorkPool *pool, int *keys, int *values, int n);
+
+// --- Main Function ---
+// Benchmarks include this file with DS_NO_MAIN defined to reuse the sorts.
+#ifndef DS_NO_MAIN
+int main() {
+    // 1. Key-Only Sort: negative keys sort before positive ones
+    int arr[] = {170, -45, 75, -90, 802, 24, 2, 66, -2147483647 - 1, 2147483647};
+    int count = (int)(sizeof(arr) / sizeof(arr[0]));
+    int scratch[10];
+    radix_sort_with(arr, scratch, count, 8);
+    printf("Radix sort with 8-bit digits:\n");
+    for (int i = 0; i < count; i++) {
+        printf("%d ", arr[i]);
+    }
+    printf("\n");
+
+    // 2. Key + Payload: the payload is the original position, so equal keys show that the
+    // order among them is kept
+    int keys[] = {3, 1, 3, 0, 1, 3};
+    int values[] = {0, 1, 2, 3, 4, 5};
+    radix_sort_pairs(keys, values, 6);
+    printf("\nPairs (key:position) sorted by key:\n");
+    for (int i = 0; i < 6; i++) {
+        printf("%d:%d ", keys[i], values[i]);
+    }
+    printf("\n");
+
+    // 3. Large Array: 11-bit digits, and the upper passes are skipped for small keys
+    int n = 1000000;
+    int *big = (int*)malloc((size_t)n * sizeof(int));
+    if (!big) {
+        printf("Memory allocation error!\n");
+        exit(1);
+    }
+    for (int i = 0; i < n; i++) {
+        big[i] = (int)((i * 2654435761u) % 1000u);  // 0 .. 999: one digit of 11 bits varies
+    }
+    WorkPool pool;
+    pool_init(&pool, 4);
+    parallel_radix_sort(&pool, big, n);
+    pool_free(&pool);
+    int sorted = 1;
+    for (int i = 1; i < n; i++) {
+        sorted &= big[i - 1] <= big[i];
+    }
+    printf("\nParallel radix sort of %d keys in 0..999 on 4 threads: %s\n", n, sorted ? "in order." : "out of order.");
+    free(big);
+    return 0;
+}
+#endif // DS_NO_MAIN
+
+// --- Helpers ---
+
+// The key as an unsigned number with the same order: flipping the sign bit moves
+// INT_MIN .. -1 below 0 .. INT_MAX.
+static inline uint32_t radix_key(int key) {
+    return (uint32_t)key ^ 0x80000000u;
+}
+
+static inline int radix_passes(int bits) {
+    return bits == 8 ? 4 : 3;
+}
+
+// Insertion sort of a short array, payloads moving with their keys (values may be NULL).
+static void radix_insertion_sort(int *keys, int *values, int n) {
+    for (int i = 1; i < n; i++) {
+        int key = keys[i];
+        int value = values != NULL ? values[i] : 0;
+        int j = i;
+        for (; j > 0 && keys[j - 1] > key; j--) {
+            keys[j] = keys[j - 1];
+            if (values != NULL) {
+                values[j] = values[j - 1];
+            }
+        }
+        keys[j] = key;
+        if (values != NULL) {
+            values[j] = value;
+        }
+    }
+}
+
+// One read of keys[0..n) counts the digits of every pass into counts (added to it).
+static void radix_histogram(const int *keys, int n, int bits, RadixCounts counts) {
+    if (bits == 8) {
+        for (int i = 0; i < n; i++) {
+            uint32_t k = radix_key(keys[i]);
+            counts[0][k & 0xFF]++;
+            counts[1][(k >> 8) & 0xFF]++;
+            counts[2][(k >> 16) & 0xFF]++;
+            counts[3][k >> 24]++;
+        }
+    } else {
+        for (int i = 0; i < n; i++) {
+            uint32_t k = radix_key(keys[i]);
+            counts[0][k & 0x7FF]++;
+            counts[1][(k >> 11) & 0x7FF]++;
+            counts[2][k >> 22]++;
+        }
+    }
+}
+
+// Counts the digits of one pass only (the parallel sort recounts after each move).
+static void radix_count_pass(const int *keys, int n, int bits, int pass, uint32_t *counts) {
+    int shift = pass * bits;
+    uint32_t mask = (1u << bits) - 1;
+    memset(counts, 0, sizeof(uint32_t) << bits);
+    for (int i = 0; i < n; i++) {
+        counts[(radix_key(keys[i]) >> shift) & mask]++;
+    }
+}
+
+// Turns the counts of one pass into the first write position of every digit.
+static void radix_offsets(uint32_t *counts, int bits) {
+    uint32_t sum = 0;
+    for (int d = 0; d < 1 << bits; d++) {
+        uint32_t c = counts[d];
+        counts[d] = sum;
+        sum += c;
+    }
+}
+
+// 1 if every key has the same digit in this pass, so the pass can be skipped.
+static int radix_trivial(const uint32_t *counts, const int *keys, int n, int bits, int pass) {
+    uint32_t digit = (radix_key(keys[0]) >> (pass * bits)) & ((1u << bits) - 1);
+    return counts[digit] == (uint32_t)n;
+}
+
+// Moves src[0..n) (and its payloads) to dst by the digit of this pass. offsets holds the
+// next write position of every digit and is advanced; keys with the same digit keep
+// their order.
+static void radix_scatter(const int *src, int *dst, const int *src_values, int *dst_values, int n,
+                          int bits, int pass, uint32_t *offsets) {
+    int shift = pass * bits;
+    uint32_t mask = (1u << bits) - 1;
+    if (src_values == NULL) {
+        for (int i = 0; i < n; i++) {
+            int key = src[i];
+            dst[offsets[(radix_key(key) >> shift) & mask]++] = key;
+        }
+    } else {
+        for (int i = 0; i < n; i++) {
+            int key = src[i];
+            uint32_t at = offsets[(radix_key(key) >> shift) & mask]++;
+            dst[at] = key;
+            dst_values[at] = src_values[i];
+        }
+    }
+}
+
+// The sequential sort behind the four entry points; values and value_scratch may be NULL.
+static void radix_sort_core(int *keys, int *values, int *key_scratch, int *value_scratch, int n, int bits) {
+    if (n < 2) {
+        return;
+    }
+    static _Thread_local RadixCounts counts;  // 32 KiB, too much for some thread stacks
+    memset(counts, 0, sizeof(counts));
+    radix_histogram(keys, n, bits, counts);
+
+    int *src = keys, *dst = key_scratch;
+    int *src_values = values, *dst_values = value_scratch;
+    for (int pass = 0; pass < radix_passes(bits); pass++) {
+        if (radix_trivial(counts[pass], keys, n, bits, pass)) {
+            continue;
+        }
+        radix_offsets(counts[pass], bits);
+        radix_scatter(src, dst, src_values, dst_values, n, bits, pass, counts[pass]);
+        int *swap = src;
+        src = dst;
+        dst = swap;
+        swap = src_values;
+        src_values = dst_values;
+        dst_values = swap;
+    }
+    if (src != keys) {  // An odd number of passes ran: the result is in the scratch buffer
+        memcpy(keys, src, (size_t)n * sizeof(int));
+        if (values != NULL) {
+            memcpy(values, src_values, (size_t)n * sizeof(int));
+        }
+    }
+}
+
+static int* radix_alloc(int n) {
+    int *arr = (int*)malloc((size_t)n * sizeof(int));
+    if (!arr) {
+        printf("Memory allocation error!\n");
+        exit(1);
+    }
+    return arr;
+}
+
+// --- Sequential Radix Sort ---
+
+// 1. Radix Sort With Scratch: O(n * passes)
+// Sorts arr[0..n) with digits of `bits` bits (8 or 11), using the caller's scratch buffer
+// of n ints. One read builds every histogram; each pass that is not skipped moves every
+// key once.
+// Time complexity: O(n * passes + passes * 2^bits): at most 5 reads and 4 writes of the
+// array with 8-bit digits, 4 reads and 3 writes with 11-bit digits.
+void radix_sort_with(int *arr, int *scratch, int n, int bits) {
+    if (bits != 8 && bits != 11) {
+        printf("Error: Digits must be 8 or 11 bits.\n");
+        return;
+    }
+    radix_sort_core(arr, NULL, scratch, NULL, n, bits);
+}
+
+// 2. Radix Sort: O(n)
+// Allocates the scratch buffer and sorts arr[0..n), with 11-bit digits for large arrays
+// (3 passes) and 8-bit digits for small ones, whose 2048-bucket histograms would cost more
+// than the pass they save.
+// Time complexity: O(n) for 32-bit keys, against O(n log n) for merge_sort.
+void radix_sort_int(int *arr, int n) {
+    if (n < RADIX_SMALL) {
+        radix_insertion_sort(arr, NULL, n);
+        return;
+    }
+    int *scratch = radix_alloc(n);
+    radix_sort_core(arr, NULL, scratch, NULL, n, n >= RADIX_WIDE_MIN ? 11 : 8);
+    free(scratch);
+}
+
+// 3. Radix Sort Pairs With Scratch: O(n * passes)
+// Sorts keys[0..n) and moves values[i] along with keys[i]. Stable: equal keys keep the
+// order of their values. Needs two scratch buffers of n ints.
+// Time complexity: O(n * passes), twice the memory traffic of the key-only sort.
+void radix_sort_pairs_with(int *keys, int *values, int *key_scratch, int *value_scratch, int n, int bits) {
+    if (bits != 8 && bits != 11) {
+        printf("Error: Digits must be 8 or 11 bits.\n");
+        return;
+    }
+    radix_sort_core(keys, values, key_scratch, value_scratch, n, bits);
+}
+
+// 4. Radix Sort Pairs: O(n)
+// Allocates both scratch buffers and sorts the pairs, with the digit width chosen as in
+// radix_sort_int.
+// Time complexity: O(n).
+void radix_sort_pairs(int *keys, int *values, int n) {
+    if (n < RADIX_SMALL) {
+        radix_insertion_sort(keys, values, n);
+        return;
+    }
+    int *key_scratch = radix_alloc(n);
+    int *value_scratch = radix_alloc(n);
+    radix_sort_core(keys, values, key_scratch, value_scratch, n, n >= RADIX_WIDE_MIN ? 11 : 8);
+    free(key_scratch);
+    free(value_scratch);
+}
+
+// --- Parallel Radix Sort ---
+
+static inline int radix_slice(int n, int id, int count) {
+    return (int)((long long)n * id / count);
+}
+
+// Histograms of every pass over this thread's slice, in one read.
+static void radix_histogram_job(void *arg, int id, int count) {
+    RadixJob *job = (RadixJob*)arg;
+    int lo = radix_slice(job->n, id, count);
+    int hi = radix_slice(job->n, id + 1, count);
+    memset(job->counts[id], 0, sizeof(RadixCounts));
+    radix_histogram(job->src + lo, hi - lo, job->bits, job->counts[id]);
+}
+
+// Digits of the current pass over this thread's slice of the current source.
+static void radix_count_job(void *arg, int id, int count) {
+    RadixJob *job = (RadixJob*)arg;
+    int lo = radix_slice(job->n, id, count);
+    int hi = radix_slice(job->n, id + 1, count);
+    radix_count_pass(job->src + lo, hi - lo, job->bits, job->pass, job->counts[id][job->pass]);
+}
+
+// Moves this thread's slice to the offsets the prefix sum gave it.
+static void radix_scatter_job(void *arg, int id, int count) {
+    RadixJob *job = (RadixJob*)arg;
+    int lo = radix_slice(job->n, id, count);
+    int hi = radix_slice(job->n, id + 1, count);
+    radix_scatter(job->src + lo, job->dst, job->src_values != NULL ? job->src_values + lo : NULL,
+                  job->dst_values, hi - lo, job->bits, job->pass, job->counts[id][job->pass]);
+}
+
+// Copies this thread's slice of the result from the scratch buffers back into place.
+static void radix_copy_job(void *arg, int id, int count) {
+    RadixJob *job = (RadixJob*)arg;
+    int lo = radix_slice(job->n, id, count);
+    int hi = radix_slice(job->n, id + 1, count);
+    memcpy(job->dst + lo, job->src + lo, (size_t)(hi - lo) * sizeof(int));
+    if (job->src_values != NULL) {
+        memcpy(job->dst_values + lo, job->src_values + lo, (size_t)(hi - lo) * sizeof(int));
+    }
+}
+
+// The parallel sort behind both entry points; values may be NULL.
+static void radix_sort_parallel(WorkPool *pool, int *keys, int *values, int n) {
+    int threads = pool->count;
+    int bits = 11;
+    int buckets = 1 << bits;
+    int *key_scratch = radix_alloc(n);
+    int *value_scratch = values != NULL ? radix_alloc(n) : NULL;
+    RadixCounts *counts = (RadixCounts*)malloc((size_t)threads * sizeof(RadixCounts));
+    uint32_t *total = (uint32_t*)malloc((size_t)buckets * sizeof(uint32_t));
+    if (!counts || !total) {
+        printf("Memory allocation error!\n");
+        exit(1);
+    }
+    RadixJob job = { keys, key_scratch, values, value_scratch, n, bits, 0, counts };
+
+    // Every thread histograms its slice for all passes in one read
+    pool_run(pool, radix_histogram_job, &job);
+    int first = 1;
+    for (int pass = 0; pass < radix_passes(bits); pass++) {
+        job.pass = pass;
+        if (!first) {
+            pool_run(pool, radix_count_job, &job);  // The slices hold other keys now
+        }
+        for (int d = 0; d < buckets; d++) {
+            total[d] = 0;
+            for (int t = 0; t < threads; t++) {
+                total[d] += counts[t][pass][d];
+            }
+        }
+        if (radix_trivial(total, job.src, n, bits, pass)) {
+            continue;
+        }
+        // Digit d of thread t goes after every smaller digit and after digit d of threads < t
+        uint32_t sum = 0;
+        for (int d = 0; d < buckets; d++) {
+            for (int t = 0; t < threads; t++) {
+                uint32_t c = counts[t][pass][d];
+                counts[t][pass][d] = sum;
+                sum += c;
+            }
+        }
+        pool_run(pool, radix_scatter_job, &job);
+        first = 0;
+        const int *src = job.src;
+        job.src = job.dst;
+        job.dst = (int*)src;
+        const int *src_values = job.src_values;
+        job.src_values = job.dst_values;
+        job.dst_values = (int*)src_values;
+    }
+    if (job.src != keys) {
+        job.dst = keys;
+        job.dst_values = values;
+        pool_run(pool, radix_copy_job, &job);
+    }
+    free(key_scratch);
+    free(value_scratch);
+    free(counts);
+    free(total);
+}
+
+// 5. Parallel Radix Sort: O(n / p * passes)
+// Sorts arr[0..n) with 11-bit digits on the p threads of pool. Each pass: every thread
+// counts the digits of its slice, one prefix sum over (digit, thread) gives each thread its
+// own write positions, and every thread moves its slice without any locking. The first
+// pass reuses the one-read histograms. Small arrays are sorted on the calling thread.
+// Time complexity: O(n / p) per pass plus O(p * 2^11) for the prefix sum.
+void parallel_radix_sort(WorkPool *pool, int *arr, int n) {
+    if (n < RADIX_PARALLEL_MIN || pool->count == 1) {
+        radix_sort_int(arr, n);
+        return;
+    }
+    radix_sort_parallel(pool, arr, NULL, n);
+}
+
+// 6. Parallel Radix Sort Pairs: O(n / p * passes)
+// The same for keys with payloads; stable like radix_sort_pairs, since thread t's keys of a
+// digit land before those of thread t + 1.
+// Time complexity: O(n / p) per pass plus O(p * 2^11).
+void parallel_radix_sort_pairs(WorkPool *pool, int *keys, int *values, int n) {
+    if (n < RADIX_PARALLEL_MIN || pool->count == 1) {
+        radix_sort_pairs(keys, values, n);
+        return;
+    }
+    radix_sort_parallel(pool, keys, values, n);
+}
+
+// --- Big O Summary ---
+// 1. Radix Sort: O(n * passes) - 3 passes with 11-bit digits, 4 with 8-bit digits, no comparisons.
+// 2. Histograms: O(n) - One read counts the digits of every pass.
+// 3. Skipped Passes: O(2^bits) - A digit shared by every key costs nothing but a look at its count.
+// 4. Radix Sort Pairs: O(n * passes) - Stable; each pass moves a payload with its key.
+// 5. Parallel Radix Sort: O(n / p * passes + p * 2^11) - Each thread counts and moves its own
+//    slice; two reads per pass after the first.
+// Memory: one scratch buffer of n ints (two with payloads), plus 32 KiB of counts per thread.
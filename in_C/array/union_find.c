@@ -0,0 +1,395 @@
+// This C program ports the UnionFind of tricks.py (disjoint sets) to C and adds a version
+// that many threads can fill at once, explaining each operation along with its Big O
+// complexity. tricks.py keeps a list of parents, compresses paths recursively and links the
+// first root under the second, so a bad edge order builds chains of length n (and a Python
+// recursion that deep fails). Here:
+//   1. One flat int32 array: parent[x] >= 0 is x's parent, and a root stores minus the
+//      size of its set, so union by size needs no second array (4 bytes per vertex, 400 MB
+//      for 10^8 vertices).
+//   2. Union by size: the smaller set goes under the larger one, so no tree is deeper than
+//      log2 n.
+//   3. Path halving: a find points every other node of its path at its grandparent, in one
+//      loop without recursion or a second pass. Together with union by size a find costs
+//      O(alpha(n)) amortized, a constant for any real n.
+//   4. Concurrent version: roots point to themselves and a union links a root with one
+//      compare-and-swap (CAS), so threads never lock and a stalled thread blocks nobody.
+//      A set size cannot be updated in the same CAS, so the roots are ordered by a fixed
+//      random priority instead of their size (randomized linking): the lower root goes
+//      under the higher one, which keeps trees O(log n) deep in expectation whatever the
+//      edge order. Finds halve paths with CAS too, never retry, and finish in a bounded
+//      number of steps (wait-free).
+//
+// Build:  gcc -O2 -pthread union_find.c -o union_find
+
+// --- Includes Section ---
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdatomic.h>
+#include "../common/pool.h"  // Fork-join thread pool for parallel edge ingestion
+
+// --- Struct Definitions ---
+typedef struct UnionFind {
+    int32_t *parent;           // Parent of each vertex, or -(set size) for a root
+    int32_t n;                 // Number of vertices
+    int32_t sets;              // Number of disjoint sets
+} UnionFind;
+
+typedef struct ConcurrentUnionFind {
+    _Atomic(int32_t) *parent;  // Parent of each vertex; a root is its own parent
+    int32_t n;
+} ConcurrentUnionFind;
+
+// Shared state of a parallel ingestion: thread t unites the edges of its slice.
+typedef struct UnionJob {
+    ConcurrentUnionFind *uf;
+    const int32_t *edges;      // Edge i joins edges[2 * i] and edges[2 * i + 1]
+    long m;                    // Number of edges
+    long merged[POOL_MAX_THREADS];  // Unions that joined two sets, per thread
+} UnionJob;
+
+// --- Function Declarations ---
+void uf_init(UnionFind *uf, int32_t n);
+int32_t uf_find(UnionFind *uf, int32_t x);
+int uf_union(UnionFind *uf, int32_t a, int32_t b);
+int uf_connected(UnionFind *uf, int32_t a, int32_t b);
+int32_t uf_set_size(UnionFind *uf, int32_t x);
+void uf_free(UnionFind *uf);
+void cuf_init(ConcurrentUnionFind *uf, int32_t n);
+int32_t cuf_find(ConcurrentUnionFind *uf, int32_t x);
+int cuf_union(ConcurrentUnionFind *uf, int32_t a, int32_t b);
+int cuf_connected(ConcurrentUnionFind *uf, int32_t a, int32_t b);
+long parallel_union_edges(WorkPool *pool, ConcurrentUnionFind *uf, const int32_t *edges, long m);
+int32_t cuf_count_sets(ConcurrentUnionFind *uf);
+void cuf_free(ConcurrentUnionFind *uf);
+
+// --- Main Function ---
+// Benchmarks include this file with DS_NO_MAIN defined to reuse the operations.
+#ifndef DS_NO_MAIN
+int main() {
+    // 1. Sequential: 10 vertices, three unions
+    UnionFind uf;
+    uf_init(&uf, 10);
+    uf_union(&uf, 1, 2);
+    uf_union(&uf, 3, 4);
+    uf_union(&uf, 2, 4);
+    printf("After union(1, 2), union(3, 4), union(2, 4): %d sets\n", uf.sets);
+    printf("1 and 3 connected: %s\n", uf_connected(&uf, 1, 3) ? "yes" : "no");
+    printf("1 and 5 connected: %s\n", uf_connected(&uf, 1, 5) ? "yes" : "no");
+    printf("Size of the set of 4: %d\n", uf_set_size(&uf, 4));
+    printf("union(1, 3) joins two sets: %s\n", uf_union(&uf, 1, 3) ? "yes" : "no");
+    uf_union(&uf, 10, 1);  // Out of range: prints an error
+    uf_free(&uf);
+
+    // 2. Concurrent: 4 threads unite the edges (i, i + 1) of a path of 100000 vertices,
+    // except every 1000th edge, which leaves 100 sets
+    int32_t n = 100000;
+    int32_t *edges = (int32_t*)malloc((size_t)n * 2 * sizeof(int32_t));
+    if (!edges) {
+        printf("Memory allocation error!\n");
+        exit(1);
+    }
+    long m = 0;
+    for (int32_t i = 0; i + 1 < n; i++) {
+        if ((i + 1) % 1000 != 0) {
+            edges[2 * m] = i;
+            edges[2 * m + 1] = i + 1;
+            m++;
+        }
+    }
+    ConcurrentUnionFind cuf;
+    cuf_init(&cuf, n);
+    WorkPool pool;
+    pool_init(&pool, 4);
+    long merged = parallel_union_edges(&pool, &cuf, edges, m);
+    pool_free(&pool);
+    printf("\nParallel ingestion of %ld edges on 4 threads: %ld unions joined two sets, %d sets left\n",
+           m, merged, cuf_count_sets(&cuf));
+    printf("0 and 999 connected: %s, 999 and 1000 connected: %s\n",
+           cuf_connected(&cuf, 0, 999) ? "yes" : "no", cuf_connected(&cuf, 999, 1000) ? "yes" : "no");
+    cuf_free(&cuf);
+    free(edges);
+    return 0;
+}
+#endif // DS_NO_MAIN
+
+// --- Helpers ---
+
+static int32_t* uf_alloc(int32_t n) {
+    int32_t *arr = (int32_t*)malloc((size_t)(n > 0 ? n : 1) * sizeof(int32_t));
+    if (!arr) {
+        printf("Memory allocation error!\n");
+        exit(1);
+    }
+    return arr;
+}
+
+// Root of x with path halving, without a range check.
+static inline int32_t uf_root(int32_t *parent, int32_t x) {
+    while (parent[x] >= 0) {
+        int32_t up = parent[x];
+        if (parent[up] >= 0) {
+            parent[x] = parent[up];  // Skip the parent: x now hangs off its grandparent
+        }
+        x = parent[x];
+    }
+    return x;
+}
+
+// --- Sequential Union-Find ---
+
+// 1. Init: O(n)
+// n singleton sets 0 .. n - 1, each of size 1.
+// Time complexity: O(n) to fill the array.
+void uf_init(UnionFind *uf, int32_t n) {
+    if (n < 0) {
+        printf("Error: Negative number of vertices.\n");
+        n = 0;
+    }
+    uf->parent = uf_alloc(n);
+    for (int32_t i = 0; i < n; i++) {
+        uf->parent[i] = -1;
+    }
+    uf->n = n;
+    uf->sets = n;
+}
+
+// 2. Find: O(alpha(n)) amortized
+// Returns the root that represents x's set, or -1 if x is out of range. Halves the path
+// on the way up.
+// Time complexity: O(log n) worst case for one call, O(alpha(n)) amortized over many.
+int32_t uf_find(UnionFind *uf, int32_t x) {
+    if (x < 0 || x >= uf->n) {
+        printf("Error: Vertex out of range.\n");
+        return -1;
+    }
+    return uf_root(uf->parent, x);
+}
+
+// 3. Union: O(alpha(n)) amortized
+// Joins the sets of a and b: the root of the smaller set goes under the root of the larger
+// one and the sizes are added. Returns 1 if two sets were joined, 0 if a and b were
+// already connected (or out of range).
+// Time complexity: two finds plus O(1).
+int uf_union(UnionFind *uf, int32_t a, int32_t b) {
+    if (a < 0 || a >= uf->n || b < 0 || b >= uf->n) {
+        printf("Error: Vertex out of range.\n");
+        return 0;
+    }
+    int32_t *parent = uf->parent;
+    a = uf_root(parent, a);
+    b = uf_root(parent, b);
+    if (a == b) {
+        return 0;
+    }
+    if (parent[a] > parent[b]) {  // Sizes are negative: a is the smaller set
+        int32_t swap = a;
+        a = b;
+        b = swap;
+    }
+    parent[a] += parent[b];
+    parent[b] = a;
+    uf->sets--;
+    return 1;
+}
+
+// 4. Connected: O(alpha(n)) amortized
+// Returns 1 if a and b are in the same set.
+// Time complexity: two finds.
+int uf_connected(UnionFind *uf, int32_t a, int32_t b) {
+    if (a < 0 || a >= uf->n || b < 0 || b >= uf->n) {
+        printf("Error: Vertex out of range.\n");
+        return 0;
+    }
+    return uf_root(uf->parent, a) == uf_root(uf->parent, b);
+}
+
+// 5. Set Size: O(alpha(n)) amortized
+// Returns the number of vertices in x's set (0 if x is out of range).
+// Time complexity: one find; the size is stored at the root.
+int32_t uf_set_size(UnionFind *uf, int32_t x) {
+    int32_t root = uf_find(uf, x);
+    return root < 0 ? 0 : -uf->parent[root];
+}
+
+// 6. Free: O(1)
+// Time complexity: O(1).
+void uf_free(UnionFind *uf) {
+    free(uf->parent);
+    uf->parent = NULL;
+    uf->n = 0;
+    uf->sets = 0;
+}
+
+// --- Concurrent Union-Find ---
+
+// Fixed random priority of a vertex: a bijective hash, so no two roots tie and no edge
+// order can favour a vertex.
+static inline uint32_t cuf_priority(int32_t x) {
+    uint32_t h = (uint32_t)x * 0x9E3779B1u;
+    h ^= h >> 16;
+    h *= 0x85EBCA6Bu;
+    h ^= h >> 13;
+    return h;
+}
+
+// Root of x with path halving by CAS, without a range check. A failed CAS means another
+// thread moved the pointer higher already, so it is not retried. Every step goes to a
+// vertex of higher priority, so the walk ends within n steps whatever the other threads do.
+static inline int32_t cuf_root(_Atomic(int32_t) *parent, int32_t x) {
+    for (;;) {
+        int32_t up = atomic_load_explicit(&parent[x], memory_order_acquire);
+        if (up == x) {
+            return x;
+        }
+        int32_t grand = atomic_load_explicit(&parent[up], memory_order_acquire);
+        if (grand != up) {
+            atomic_compare_exchange_weak_explicit(&parent[x], &up, grand, memory_order_release,
+                                                  memory_order_relaxed);
+        }
+        x = grand;
+    }
+}
+
+// 7. Concurrent Init: O(n)
+// n singleton sets; every vertex is its own root. Not thread safe: call it before the
+// threads start.
+// Time complexity: O(n).
+void cuf_init(ConcurrentUnionFind *uf, int32_t n) {
+    if (n < 0) {
+        printf("Error: Negative number of vertices.\n");
+        n = 0;
+    }
+    uf->parent = (_Atomic(int32_t)*)uf_alloc(n);
+    for (int32_t i = 0; i < n; i++) {
+        atomic_init(&uf->parent[i], i);
+    }
+    uf->n = n;
+}
+
+// 8. Concurrent Find: O(log n) expected, wait-free
+// Returns the current root of x's set, or -1 if x is out of range. While other threads
+// unite sets the root may stop being one right after the return; the answer is then the
+// root at some moment of the call.
+// Time complexity: O(log n) expected with randomized linking, less after halving.
+int32_t cuf_find(ConcurrentUnionFind *uf, int32_t x) {
+    if (x < 0 || x >= uf->n) {
+        printf("Error: Vertex out of range.\n");
+        return -1;
+    }
+    return cuf_root(uf->parent, x);
+}
+
+// 9. Concurrent Union: O(log n) expected, lock-free
+// Joins the sets of a and b: the root of lower priority is linked under the other with one
+// CAS, which only succeeds if it is still a root. If another thread linked it first, both
+// roots are looked up again. Returns 1 if this call joined two sets, 0 if they were
+// already connected (or out of range), so over all threads the 1s add up to n - sets.
+// Time complexity: two finds per attempt; a failed CAS means another union succeeded.
+int cuf_union(ConcurrentUnionFind *uf, int32_t a, int32_t b) {
+    if (a < 0 || a >= uf->n || b < 0 || b >= uf->n) {
+        printf("Error: Vertex out of range.\n");
+        return 0;
+    }
+    _Atomic(int32_t) *parent = uf->parent;
+    for (;;) {
+        a = cuf_root(parent, a);
+        b = cuf_root(parent, b);
+        if (a == b) {
+            return 0;
+        }
+        if (cuf_priority(a) > cuf_priority(b)) {
+            int32_t swap = a;
+            a = b;
+            b = swap;
+        }
+        int32_t expected = a;  // a must still be a root
+        if (atomic_compare_exchange_strong_explicit(&parent[a], &expected, b, memory_order_acq_rel,
+                                                    memory_order_acquire)) {
+            return 1;
+        }
+    }
+}
+
+// 10. Concurrent Connected: O(log n) expected, lock-free
+// Returns 1 if a and b are in the same set. Two finds can see different roots just because
+// a union ran between them, so a "no" is only returned if a's root is still a root after
+// the second find; otherwise the finds are repeated.
+// Time complexity: two finds per attempt.
+int cuf_connected(ConcurrentUnionFind *uf, int32_t a, int32_t b) {
+    if (a < 0 || a >= uf->n || b < 0 || b >= uf->n) {
+        printf("Error: Vertex out of range.\n");
+        return 0;
+    }
+    _Atomic(int32_t) *parent = uf->parent;
+    for (;;) {
+        a = cuf_root(parent, a);
+        b = cuf_root(parent, b);
+        if (a == b) {
+            return 1;
+        }
+        if (atomic_load_explicit(&parent[a], memory_order_acquire) == a) {
+            return 0;
+        }
+    }
+}
+
+// Unites the edges of this thread's slice.
+static void union_edges_job(void *arg, int id, int count) {
+    UnionJob *job = (UnionJob*)arg;
+    long lo = job->m * id / count;
+    long hi = job->m * (id + 1) / count;
+    long merged = 0;
+    for (long i = lo; i < hi; i++) {
+        merged += cuf_union(job->uf, job->edges[2 * i], job->edges[2 * i + 1]);
+    }
+    job->merged[id] = merged;
+}
+
+// 11. Parallel Union Edges: O(m / p * log n) expected
+// Unites the m edges (edges[2 * i], edges[2 * i + 1]) on the p threads of pool, each
+// thread taking one slice of the edge array. Returns the number of unions that joined two
+// sets. Other threads may use the structure at the same time.
+// Time complexity: O(m / p) unions per thread, with no locks.
+long parallel_union_edges(WorkPool *pool, ConcurrentUnionFind *uf, const int32_t *edges, long m) {
+    UnionJob job;
+    job.uf = uf;
+    job.edges = edges;
+    job.m = m;
+    pool_run(pool, union_edges_job, &job);
+    long merged = 0;
+    for (int t = 0; t < pool->count; t++) {
+        merged += job.merged[t];
+    }
+    return merged;
+}
+
+// 12. Count Sets: O(n)
+// Counts the roots. Exact once no union is running.
+// Time complexity: O(n), one pass over the array.
+int32_t cuf_count_sets(ConcurrentUnionFind *uf) {
+    int32_t sets = 0;
+    for (int32_t i = 0; i < uf->n; i++) {
+        sets += atomic_load_explicit(&uf->parent[i], memory_order_relaxed) == i;
+    }
+    return sets;
+}
+
+// 13. Concurrent Free: O(1)
+// Not thread safe: call it after the threads are done.
+// Time complexity: O(1).
+void cuf_free(ConcurrentUnionFind *uf) {
+    free((void*)uf->parent);
+    uf->parent = NULL;
+    uf->n = 0;
+}
+
+// --- Big O Summary ---
+// 1. Find / Union / Connected: O(alpha(n)) amortized - Union by size and path halving; no
+//    tree deeper than log2 n, against chains of length n in tricks.py.
+// 2. Set Size: O(alpha(n)) amortized - Stored negated at the root, in the parent array itself.
+// 3. Concurrent Find: O(log n) expected, wait-free - CAS halving that never retries.
+// 4. Concurrent Union / Connected: O(log n) expected, lock-free - One CAS links two roots;
+//    randomized linking replaces union by size.
+// 5. Parallel Union Edges: O(m / p * log n) expected on p threads.
+// 6. Memory: 4 bytes per vertex in both versions.
@@ -0,0 +1,156 @@
+// This header generates dynamic arrays (vectors) of any element type, the type-generic
+// version of the Vector in array/arrays.c. See common/generic.h for the arguments.
+//
+// Example: a vector of 64-bit ints and a vector of records keyed by id
+//   DEFINE_VECTOR(I64Vector, int64_t, int64_t, GEN_SELF, GEN_LESS)
+//   #define RECORD_ID(r) ((r).id)
+//   DEFINE_VECTOR(RecordVector, Record, uint32_t, RECORD_ID, GEN_LESS)
+//   I64Vector vec;
+//   I64Vector_init(&vec);
+//   I64Vector_push_back(&vec, 42);
+//
+// Generated for DEFINE_VECTOR(Name, T, K, KEY_OF, LESS):
+//   Name                                 { T *data; int size; int capacity; }
+//   void Name_init(Name *vec)
+//   void Name_reserve(Name *vec, int capacity)
+//   void Name_push_back(Name *vec, T value)
+//   void Name_append_many(Name *vec, const T *values, int count)
+//   T*   Name_at(Name *vec, int index)             NULL (with an error) if out of bounds
+//   void Name_insert(Name *vec, int index, T value)
+//   void Name_delete(Name *vec, int index)
+//   int  Name_find(const Name *vec, K key)         index of the first match, or -1
+//   void Name_free(Name *vec)
+// Elements are stored by value in one heap buffer, so a vector of structs is one block
+// of structs, not an array of pointers to them.
+
+#ifndef VECTOR_GEN_H
+#define VECTOR_GEN_H
+
+// --- Includes Section ---
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../common/generic.h"  // GEN_SELF, GEN_LESS, GEN_EQUAL
+
+// --- Generator ---
+#define DEFINE_VECTOR(Name, T, K, KEY_OF, LESS)                                                     \
+typedef struct Name {                                                                               \
+    T *data;               /* Heap buffer holding the elements */                                   \
+    int size;              /* Number of elements in use */                                          \
+    int capacity;          /* Number of elements the buffer can hold */                             \
+} Name;                                                                                             \
+                                                                                                    \
+/* 1. Init: O(1) */                                                                                 \
+static inline void Name##_init(Name *vec) {                                                         \
+    vec->data = NULL;                                                                               \
+    vec->size = 0;                                                                                  \
+    vec->capacity = 0;                                                                              \
+}                                                                                                   \
+                                                                                                    \
+/* 2. Reserve: O(n) when the buffer moves */                                                        \
+static inline void Name##_reserve(Name *vec, int capacity) {                                        \
+    if (capacity <= vec->capacity) {                                                                \
+        return;                                                                                     \
+    }                                                                                               \
+    T *data = (T*)realloc(vec->data, (size_t)capacity * sizeof(T));                                 \
+    if (!data) {                                                                                    \
+        printf("Memory allocation error!\n");                                                       \
+        exit(1);                                                                                    \
+    }                                                                                               \
+    vec->data = data;                                                                               \
+    vec->capacity = capacity;                                                                       \
+}                                                                                                   \
+                                                                                                    \
+/* 3. Push Back: O(1) amortized, the capacity doubles */                                            \
+static inline void Name##_push_back(Name *vec, T value) {                                           \
+    if (vec->size == vec->capacity) {                                                               \
+        if (vec->capacity > INT_MAX / 2) {                                                          \
+            printf("Memory allocation error!\n");                                                   \
+            exit(1);                                                                                \
+        }                                                                                           \
+        Name##_reserve(vec, vec->capacity == 0 ? 8 : vec->capacity * 2);                            \
+    }                                                                                               \
+    vec->data[vec->size++] = value;                                                                 \
+}                                                                                                   \
+                                                                                                    \
+/* 4. Append Many: O(k) amortized, one resize and one memcpy */                                     \
+static inline void Name##_append_many(Name *vec, const T *values, int count) {                      \
+    if (count <= 0) {                                                                               \
+        return;                                                                                     \
+    }                                                                                               \
+    long long needed = (long long)vec->size + count;                                                \
+    if (needed > INT_MAX) {                                                                         \
+        printf("Error: Too many elements for a vector.\n");                                         \
+        return;                                                                                     \
+    }                                                                                               \
+    if (needed > vec->capacity) {                                                                   \
+        long long doubled = (long long)vec->capacity * 2;                                           \
+        Name##_reserve(vec, (int)(doubled > needed && doubled <= INT_MAX ? doubled : needed));      \
+    }                                                                                               \
+    memcpy(&vec->data[vec->size], values, (size_t)count * sizeof(T));                               \
+    vec->size += count;                                                                             \
+}                                                                                                   \
+                                                                                                    \
+/* 5. Element at Index: O(1) */                                                                     \
+static inline T* Name##_at(Name *vec, int index) {                                                  \
+    if (index < 0 || index >= vec->size) {                                                          \
+        printf("Error: Index out of bounds.\n");                                                    \
+        return NULL;                                                                                \
+    }                                                                                               \
+    return &vec->data[index];                                                                       \
+}                                                                                                   \
+                                                                                                    \
+/* 6. Insert: O(n), one memmove; index == size appends */                                           \
+static inline void Name##_insert(Name *vec, int index, T value) {                                   \
+    if (index < 0 || index > vec->size) {                                                           \
+        printf("Error: Index out of bounds.\n");                                                    \
+        return;                                                                                     \
+    }                                                                                               \
+    if (vec->size == vec->capacity) {                                                               \
+        if (vec->capacity > INT_MAX / 2) {                                                          \
+            printf("Memory allocation error!\n");                                                   \
+            exit(1);                                                                                \
+        }                                                                                           \
+        Name##_reserve(vec, vec->capacity == 0 ? 8 : vec->capacity * 2);                            \
+    }                                                                                               \
+    memmove(&vec->data[index + 1], &vec->data[index], (size_t)(vec->size - index) * sizeof(T));     \
+    vec->data[index] = value;                                                                       \
+    vec->size++;                                                                                    \
+}                                                                                                   \
+                                                                                                    \
+/* 7. Delete: O(n), one memmove */                                                                  \
+static inline void Name##_delete(Name *vec, int index) {                                            \
+    if (index < 0 || index >= vec->size) {                                                          \
+        printf("Error: Index out of bounds.\n");                                                    \
+        return;                                                                                     \
+    }                                                                                               \
+    memmove(&vec->data[index], &vec->data[index + 1], (size_t)(vec->size - index - 1) * sizeof(T)); \
+    vec->size--;                                                                                    \
+}                                                                                                   \
+                                                                                                    \
+/* 8. Find: O(n), linear search with the inlined key comparison */                                  \
+static inline int Name##_find(const Name *vec, K key) {                                             \
+    for (int i = 0; i < vec->size; i++) {                                                           \
+        if (GEN_EQUAL(LESS, KEY_OF(vec->data[i]), key)) {                                           \
+            return i;                                                                               \
+        }                                                                                           \
+    }                                                                                               \
+    return -1;                                                                                      \
+}                                                                                                   \
+                                                                                                    \
+/* 9. Free: O(1) */                                                                                 \
+static inline void Name##_free(Name *vec) {                                                         \
+    free(vec->data);                                                                                \
+    Name##_init(vec);                                                                               \
+}
+
+// --- Big O Summary ---
+// 1. Init / Free: O(1) - No allocation until the first insert.
+// 2. Push Back: O(1) amortized - Doubling the capacity makes resizes rare.
+// 3. Append Many: O(k) amortized - One resize and one memcpy per batch.
+// 4. Element at Index: O(1) - Direct access.
+// 5. Insert / Delete: O(n) - One memmove of the elements after the index.
+// 6. Find: O(n) - A linear search; the key comparison is inlined, not called.
+
+#endif // VECTOR_GEN_H
@@ -0,0 +1,102 @@
+// This C program benchmarks the dynamic array (Vector) from array/arrays.c against the
+// element-by-element shift loops the array program used before, on bulk insert and erase.
+//
+// Build:  gcc -O2 array_bench.c -o array_bench
+// Usage:  ./array_bench [n]   (default n = 50000; bulk insert/erase at the front is O(n^2))
+
+#define _POSIX_C_SOURCE 200809L
+#define DS_NO_MAIN
+
+// --- Includes Section ---
+#include "../array/arrays.c"
+#include "../common/timer.h"
+
+// --- Old Loop Versions ---
+// These are the original shift loops, working on a preallocated buffer of size `size`.
+
+static void loop_insert(int *arr, int size, int index, int value) {
+    for (int i = size; i > index; i--) {
+        arr[i] = arr[i - 1];  // Shifting elements to the right
+    }
+    arr[index] = value;
+}
+
+static void loop_delete(int *arr, int size, int index) {
+    for (int i = index; i < size - 1; i++) {
+        arr[i] = arr[i + 1];  // Shifting elements to the left
+    }
+}
+
+// --- Benchmark ---
+
+// Index used by each workload: 0 = front, 1 = middle, 2 = back.
+static int position(int where, int size) {
+    return where == 0 ? 0 : where == 1 ? size / 2 : size;
+}
+
+static const char *where_names[] = { "front", "middle", "back" };
+
+// Inserts n elements and then erases them all, at the given position.
+static void bench_workload(int n, int where) {
+    // Old loops over a buffer that is big enough from the start
+    int *arr = (int*)malloc((size_t)n * sizeof(int));
+    if (!arr) {
+        printf("Memory allocation error!\n");
+        exit(1);
+    }
+    uint64_t t0 = now_ns();
+    for (int size = 0; size < n; size++) {
+        loop_insert(arr, size, position(where, size), size);
+    }
+    uint64_t t1 = now_ns();
+    for (int size = n; size > 0; size--) {
+        int index = position(where, size);
+        loop_delete(arr, size, index < size ? index : size - 1);
+    }
+    uint64_t t2 = now_ns();
+    free(arr);
+
+    // Vector with geometric growth and memmove
+    Vector vec;
+    vector_init(&vec);
+    uint64_t t3 = now_ns();
+    for (int i = 0; i < n; i++) {
+        insert_element(&vec, position(where, vec.size), i);
+    }
+    uint64_t t4 = now_ns();
+    while (vec.size > 0) {
+        int index = position(where, vec.size);
+        delete_element(&vec, index < vec.size ? index : vec.size - 1);
+    }
+    uint64_t t5 = now_ns();
+    vector_free(&vec);
+
+    printf("%-8s %10d %14.1f %14.1f %14.1f %14.1f\n", where_names[where], n,
+           (double)(t1 - t0) / n, (double)(t4 - t3) / n, (double)(t2 - t1) / n, (double)(t5 - t4) / n);
+}
+
+// --- Main Function ---
+int main(int argc, char *argv[]) {
+    int n = argc > 1 ? atoi(argv[1]) : 50000;
+    if (n < 1) n = 1;
+
+    printf("%-8s %10s %14s %14s %14s %14s\n", "where", "n", "loop ins ns", "vector ins ns",
+           "loop del ns", "vector del ns");
+    for (int where = 0; where <= 2; where++) {
+        bench_workload(n, where);
+    }
+
+    // Amortized push_back: total time divided by the number of pushes
+    Vector vec;
+    vector_init(&vec);
+    int pushes = n * 200;
+    uint64_t t0 = now_ns();
+    for (int i = 0; i < pushes; i++) {
+        vector_push_back(&vec, i);
+    }
+    uint64_t t1 = now_ns();
+    printf("\npush_back: %d elements, %.2f ns each, capacity %d\n", pushes,
+           (double)(t1 - t0) / pushes, vec.capacity);
+    vector_free(&vec);
+    return 0;
+}
@@ -0,0 +1,122 @@
+// This C program benchmarks the B+ tree from TREE/bplus.c against the binary search tree
+// (plain and AVL) from TREE/simple.c, on random point lookups and on range scans.
+//
+// Build:  gcc -O2 bplus_bench.c -o bplus_bench
+// Usage:  ./bplus_bench [n] [lookups]   (defaults: n = 1000000, lookups = 1000000)
+
+#define _POSIX_C_SOURCE 200809L
+#define DS_NO_MAIN
+
+// --- Includes Section ---
+#include "../TREE/simple.c"
+#include "../TREE/bplus.c"
+#include "../common/timer.h"
+
+// Width of each range scan, in keys.
+#define RANGE_WIDTH 1000
+// Number of range scans per run.
+#define RANGE_QUERIES 1000
+
+// --- Benchmark Helpers ---
+
+// Counts the keys of a binary search tree in [lo, hi], skipping subtrees outside the range.
+static long bst_range_count(TreeNode *root, int lo, int hi) {
+    if (root == NULL) {
+        return 0;
+    }
+    long count = 0;
+    if (lo < root->data) {
+        count += bst_range_count(root->left, lo, hi);
+    }
+    if (root->data >= lo && root->data <= hi) {
+        count++;
+    }
+    if (hi > root->data) {
+        count += bst_range_count(root->right, lo, hi);
+    }
+    return count;
+}
+
+// Keys are spread over [0, 2n) so about half of the random lookups miss.
+static int random_key(uint64_t *seed, int n) {
+    return (int)(xorshift64(seed) % (uint64_t)(2 * n));
+}
+
+static void print_row(const char *name, int height, uint64_t build, uint64_t lookup, uint64_t range,
+                      int n, int lookups, long hits, long scanned) {
+    printf("%-6s %8d %12.1f %12.1f %14.1f %10ld %10ld\n", name, height, (double)build / n,
+           (double)lookup / lookups, (double)range / RANGE_QUERIES, hits, scanned);
+}
+
+// --- Main Function ---
+int main(int argc, char *argv[]) {
+    int n = argc > 1 ? atoi(argv[1]) : 1000000;
+    int lookups = argc > 2 ? atoi(argv[2]) : 1000000;
+    if (n < 1) n = 1;
+    if (lookups < 1) lookups = 1;
+
+    int *keys = (int*)malloc((size_t)n * sizeof(int));
+    int *probes = (int*)malloc((size_t)lookups * sizeof(int));
+    if (!keys || !probes) {
+        printf("Memory allocation error!\n");
+        return 1;
+    }
+    uint64_t seed = 42;
+    for (int i = 0; i < n; i++) {
+        keys[i] = random_key(&seed, n);
+    }
+    for (int i = 0; i < lookups; i++) {
+        probes[i] = random_key(&seed, n);
+    }
+
+    printf("n = %d random keys, %d lookups, %d scans of width %d\n", n, lookups, RANGE_QUERIES, RANGE_WIDTH);
+    printf("%-6s %8s %12s %12s %14s %10s %10s\n", "tree", "height", "insert ns", "find ns",
+           "scan ns", "hits", "scanned");
+
+    // Plain and AVL binary search trees
+    for (int balanced = 0; balanced <= 1; balanced++) {
+        TreeNode *root = NULL;
+        uint64_t t0 = now_ns();
+        for (int i = 0; i < n; i++) {
+            root = balanced ? avl_insert(root, keys[i]) : insert(root, keys[i]);
+        }
+        uint64_t t1 = now_ns();
+        long hits = 0;
+        for (int i = 0; i < lookups; i++) {
+            hits += find(root, probes[i]) != NULL;
+        }
+        uint64_t t2 = now_ns();
+        long scanned = 0;
+        for (int i = 0; i < RANGE_QUERIES; i++) {
+            scanned += bst_range_count(root, probes[i], probes[i] + RANGE_WIDTH);
+        }
+        uint64_t t3 = now_ns();
+        print_row(balanced ? "avl" : "plain", tree_height(root), t1 - t0, t2 - t1, t3 - t2, n, lookups, hits, scanned);
+        slab_destroy(&node_pool);
+    }
+
+    // B+ tree
+    BPlusTree tree;
+    bpt_init(&tree);
+    uint64_t t0 = now_ns();
+    for (int i = 0; i < n; i++) {
+        bpt_insert(&tree, keys[i]);
+    }
+    uint64_t t1 = now_ns();
+    long hits = 0;
+    for (int i = 0; i < lookups; i++) {
+        hits += bpt_find(&tree, probes[i]);
+    }
+    uint64_t t2 = now_ns();
+    long scanned = 0;
+    for (int i = 0; i < RANGE_QUERIES; i++) {
+        scanned += bpt_range(&tree, probes[i], probes[i] + RANGE_WIDTH, NULL, NULL);
+    }
+    uint64_t t3 = now_ns();
+    print_row("bplus", bpt_height(&tree), t1 - t0, t2 - t1, t3 - t2, n, lookups, hits, scanned);
+    bpt_free(&tree);
+
+    free(keys);
+    free(probes);
+    return 0;
+}
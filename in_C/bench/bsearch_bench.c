@@ -0,0 +1,124 @@
+// This C program benchmarks the binary search variants from array/binary_search.c over
+// sorted arrays from 4 KiB (fits in L1) up to hundreds of MiB (far past the last-level cache).
+// Every variant answers the same random queries; about half of them are present.
+//
+// Build:  gcc -O2 bsearch_bench.c -o bsearch_bench
+// Usage:  ./bsearch_bench [max_log2_size] [queries]   (defaults: 24, 1048576)
+
+#define _POSIX_C_SOURCE 200809L
+#define DS_NO_MAIN
+
+// --- Includes Section ---
+#include "../array/binary_search.c"
+#include "../common/timer.h"
+
+// --- Benchmark ---
+
+// Sorted keys 0, 2, 4, ...: even queries hit, odd queries miss.
+static void bench_int(int size, const int *queries, int count) {
+    int *arr = (int*)malloc((size_t)size * sizeof(int));
+    if (!arr) {
+        printf("Memory allocation error!\n");
+        exit(1);
+    }
+    for (int i = 0; i < size; i++) {
+        arr[i] = 2 * i;
+    }
+    int *eyt = eytzinger_build_int(arr, size);
+    KaryTreeInt tree;
+    kary_build_int(&tree, arr, size);
+
+    long hits[4] = {0, 0, 0, 0};
+    uint64_t t[5];
+    t[0] = now_ns();
+    for (int i = 0; i < count; i++) hits[0] += binary_search_int(arr, size, queries[i]) >= 0;
+    t[1] = now_ns();
+    for (int i = 0; i < count; i++) hits[1] += branchless_search_int(arr, size, queries[i]) >= 0;
+    t[2] = now_ns();
+    for (int i = 0; i < count; i++) hits[2] += eytzinger_search_int(eyt, size, queries[i]) >= 0;
+    t[3] = now_ns();
+    for (int i = 0; i < count; i++) hits[3] += kary_search_int(&tree, queries[i]) >= 0;
+    t[4] = now_ns();
+
+    printf("%-7s %12d %10.1f %10.1f %10.1f %10.1f %10.1f %9ld\n", "int", size,
+           size * sizeof(int) / 1024.0, (double)(t[1] - t[0]) / count, (double)(t[2] - t[1]) / count,
+           (double)(t[3] - t[2]) / count, (double)(t[4] - t[3]) / count, hits[0]);
+    if (hits[1] != hits[0] || hits[2] != hits[0] || hits[3] != hits[0]) {
+        printf("Error: variants disagree (%ld %ld %ld %ld)\n", hits[0], hits[1], hits[2], hits[3]);
+    }
+    free(arr);
+    free(eyt);
+    kary_free_int(&tree);
+}
+
+static void bench_double(int size, const int *queries, int count) {
+    double *arr = (double*)malloc((size_t)size * sizeof(double));
+    double *probes = (double*)malloc((size_t)count * sizeof(double));
+    if (!arr || !probes) {
+        printf("Memory allocation error!\n");
+        exit(1);
+    }
+    for (int i = 0; i < size; i++) {
+        arr[i] = 2.0 * i;
+    }
+    for (int i = 0; i < count; i++) {
+        probes[i] = (double)queries[i];
+    }
+    double *eyt = eytzinger_build_double(arr, size);
+    KaryTreeDouble tree;
+    kary_build_double(&tree, arr, size);
+
+    long hits[4] = {0, 0, 0, 0};
+    uint64_t t[5];
+    t[0] = now_ns();
+    for (int i = 0; i < count; i++) hits[0] += binary_search_double(arr, size, probes[i]) >= 0;
+    t[1] = now_ns();
+    for (int i = 0; i < count; i++) hits[1] += branchless_search_double(arr, size, probes[i]) >= 0;
+    t[2] = now_ns();
+    for (int i = 0; i < count; i++) hits[2] += eytzinger_search_double(eyt, size, probes[i]) >= 0;
+    t[3] = now_ns();
+    for (int i = 0; i < count; i++) hits[3] += kary_search_double(&tree, probes[i]) >= 0;
+    t[4] = now_ns();
+
+    printf("%-7s %12d %10.1f %10.1f %10.1f %10.1f %10.1f %9ld\n", "double", size,
+           size * sizeof(double) / 1024.0, (double)(t[1] - t[0]) / count, (double)(t[2] - t[1]) / count,
+           (double)(t[3] - t[2]) / count, (double)(t[4] - t[3]) / count, hits[0]);
+    if (hits[1] != hits[0] || hits[2] != hits[0] || hits[3] != hits[0]) {
+        printf("Error: variants disagree (%ld %ld %ld %ld)\n", hits[0], hits[1], hits[2], hits[3]);
+    }
+    free(arr);
+    free(probes);
+    free(eyt);
+    kary_free_double(&tree);
+}
+
+// --- Main Function ---
+int main(int argc, char *argv[]) {
+    int max_log = argc > 1 ? atoi(argv[1]) : 24;
+    int count = argc > 2 ? atoi(argv[2]) : 1 << 20;
+    if (max_log < 10) max_log = 10;
+    if (max_log > 28) max_log = 28;
+    if (count < 1) count = 1;
+
+    int *queries = (int*)malloc((size_t)count * sizeof(int));
+    if (!queries) {
+        printf("Memory allocation error!\n");
+        return 1;
+    }
+
+    printf("%d random queries per size, times in ns per query\n", count);
+    printf("%-7s %12s %10s %10s %10s %10s %10s %9s\n", "type", "n", "KiB", "classic",
+           "branchless", "eytzinger", "k-ary", "hits");
+    for (int log = 10; log <= max_log; log += 2) {
+        int size = 1 << log;
+        uint64_t seed = 42 + (uint64_t)log;
+        for (int i = 0; i < count; i++) {
+            queries[i] = (int)(xorshift64(&seed) % (uint64_t)(2 * size));
+        }
+        bench_int(size, queries, count);
+        bench_double(size, queries, count);
+    }
+
+    free(queries);
+    return 0;
+}
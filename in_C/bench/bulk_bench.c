@@ -0,0 +1,158 @@
+// This C program measures startup time: filling the tree from TREE/simple.c with n sorted
+// keys (as loaded from a snapshot) by repeated insert versus build_from_sorted.
+//   insert (shuffled): plain insert of the keys in random order, the best case for insert
+//   insert (sorted):   plain insert in sorted order, O(n^2), so only run up to 20000 keys
+//   avl_insert:        balanced insert in sorted order, O(n log n)
+//   build_from_sorted: O(n) into one contiguous block
+//   load_tree:         open a snapshot file written by save_tree and load it, O(n) with no
+//                      comparisons (the file is in the page cache)
+//   snapshot (mmap):   open the snapshot only, O(1); the finds then run on the mapped file
+// Each tree then answers the same random finds, to show the effect of shape and layout.
+//
+// Build:  gcc -O2 bulk_bench.c -o bulk_bench
+// Usage:  ./bulk_bench [n] [finds] [file]   (defaults: n = 5000000, finds = 1000000, file = bulk.snap)
+
+#define _POSIX_C_SOURCE 200809L
+#define DS_NO_MAIN
+
+// --- Includes Section ---
+#include "../TREE/simple.c"
+#include "../common/timer.h"
+
+// Largest n for the O(n^2) sorted insert.
+#define SORTED_INSERT_MAX 20000
+
+enum { FILL_SHUFFLED, FILL_SORTED, FILL_AVL, FILL_BULK, FILL_LOAD };
+static const char *fill_names[] = { "insert (shuffled)", "insert (sorted)", "avl_insert", "build_from_sorted",
+                                    "load_tree" };
+static const char *snapshot_path = "bulk.snap";
+
+// --- Benchmark ---
+
+// Builds one tree, times the build and the finds, checks the contents, prints one row.
+static void bench_fill(int method, const int *keys, const int *shuffled, int n, const int *probes,
+                       int finds) {
+    TreeNode *root = NULL;
+    SnapshotView view;
+    uint64_t t0 = now_ns();
+    if (method == FILL_SHUFFLED) {
+        for (int i = 0; i < n; i++) root = insert(root, shuffled[i]);
+    } else if (method == FILL_SORTED) {
+        for (int i = 0; i < n; i++) root = insert(root, keys[i]);
+    } else if (method == FILL_AVL) {
+        for (int i = 0; i < n; i++) root = avl_insert(root, keys[i]);
+    } else if (method == FILL_BULK) {
+        root = build_from_sorted(keys, n);
+    } else if (open_tree_snapshot(&view, snapshot_path, 0) == 0) {
+        root = load_tree(&view);
+        snapshot_close(&view);
+    }
+    uint64_t t1 = now_ns();
+
+    long hits = 0;
+    for (int i = 0; i < finds; i++) {
+        hits += find(root, probes[i]) != NULL;
+    }
+    uint64_t t2 = now_ns();
+
+    // The in-order sequence must be exactly the input keys
+    TreeCursor cursor;
+    cursor_init(&cursor, root);
+    int count = 0, ok = 1;
+    for (TreeNode *node = cursor_next(&cursor); node != NULL; node = cursor_next(&cursor), count++) {
+        if (count >= n || node->data != keys[count]) ok = 0;
+    }
+    cursor_free(&cursor);
+
+    printf("%-18s %10d %10.1f %10.1f %7d %10.1f %9ld  %s\n", fill_names[method], n,
+           (double)(t1 - t0) / 1e6, (double)(t1 - t0) / n, tree_height(root),
+           (double)(t2 - t1) / finds, hits, ok && count == n ? "ok" : "WRONG CONTENTS");
+
+    free_tree(root);
+    slab_destroy(&node_pool);  // Start every method from an empty pool
+}
+
+// Same row for the snapshot used in place: open only, then tree_snapshot_find on the mapping.
+static void bench_mapped(const int *keys, int n, const int *probes, int finds) {
+    SnapshotView view;
+    uint64_t t0 = now_ns();
+    if (open_tree_snapshot(&view, snapshot_path, 0) != 0) {
+        return;
+    }
+    uint64_t t1 = now_ns();
+    long hits = 0;
+    for (int i = 0; i < finds; i++) {
+        hits += tree_snapshot_find(&view, probes[i]) != NULL;
+    }
+    uint64_t t2 = now_ns();
+
+    // Every key must be found in the file
+    int ok = view.header->count == (uint64_t)n;
+    for (int i = 0; i < n && ok; i++) {
+        ok = tree_snapshot_find(&view, keys[i]) != NULL;
+    }
+
+    printf("%-18s %10d %10.3f %10.4f %7s %10.1f %9ld  %s\n", "snapshot (mmap)", n,
+           (double)(t1 - t0) / 1e6, (double)(t1 - t0) / n, "-",
+           (double)(t2 - t1) / finds, hits, ok ? "ok" : "WRONG CONTENTS");
+    snapshot_close(&view);
+}
+
+// --- Main Function ---
+int main(int argc, char *argv[]) {
+    int n = argc > 1 ? atoi(argv[1]) : 5000000;
+    int finds = argc > 2 ? atoi(argv[2]) : 1000000;
+    if (argc > 3) snapshot_path = argv[3];
+    if (n < 1) n = 1;
+    if (finds < 1) finds = 1;
+
+    int *keys = (int*)malloc((size_t)n * sizeof(int));
+    int *shuffled = (int*)malloc((size_t)n * sizeof(int));
+    int *probes = (int*)malloc((size_t)finds * sizeof(int));
+    if (!keys || !shuffled || !probes) {
+        printf("Memory allocation error!\n");
+        return 1;
+    }
+    uint64_t seed = 42;
+    for (int i = 0; i < n; i++) {
+        keys[i] = 2 * i;  // Sorted snapshot keys; odd probes miss
+        shuffled[i] = keys[i];
+    }
+    for (int i = n - 1; i > 0; i--) {  // Fisher-Yates shuffle
+        int j = (int)(xorshift64(&seed) % (uint64_t)(i + 1));
+        int temp = shuffled[i];
+        shuffled[i] = shuffled[j];
+        shuffled[j] = temp;
+    }
+    for (int i = 0; i < finds; i++) {
+        probes[i] = (int)(xorshift64(&seed) % (uint64_t)(2 * n));
+    }
+
+    printf("%-18s %10s %10s %10s %7s %10s %9s\n", "method", "n", "build ms", "ns/key", "height",
+           "find ns", "hits");
+    bench_fill(FILL_SHUFFLED, keys, shuffled, n, probes, finds);
+    // The sorted plain tree is a chain, so it also gets fewer finds
+    bench_fill(FILL_SORTED, keys, shuffled, n < SORTED_INSERT_MAX ? n : SORTED_INSERT_MAX, probes,
+               finds < 10000 ? finds : 10000);
+    bench_fill(FILL_AVL, keys, shuffled, n, probes, finds);
+    bench_fill(FILL_BULK, keys, shuffled, n, probes, finds);
+
+    // Save the balanced tree once, then start from the file
+    TreeNode *saved = build_from_sorted(keys, n);
+    uint64_t t0 = now_ns();
+    int saved_ok = save_tree(saved, snapshot_path) == 0;
+    uint64_t t1 = now_ns();
+    free_tree(saved);
+    slab_destroy(&node_pool);
+    if (saved_ok) {
+        printf("(save_tree: %.1f ms)\n", (double)(t1 - t0) / 1e6);
+        bench_fill(FILL_LOAD, keys, shuffled, n, probes, finds);
+        bench_mapped(keys, n, probes, finds);
+        remove(snapshot_path);
+    }
+
+    free(keys);
+    free(shuffled);
+    free(probes);
+    return 0;
+}
@@ -0,0 +1,267 @@
+// This C program stress-tests the concurrent tree from TREE/concurrent.c and measures how
+// its throughput scales with threads, against simple.c's tree behind one global mutex.
+//
+// Stress test: the keys are split in four groups by key % 4.
+//   0: inserted before the threads start and never changed; every find must see them.
+//   2: never inserted; no find may ever see them.
+//   1: shared, every thread inserts and deletes them at random. Each thread counts its
+//      successful inserts and deletes per key; at the end a key must be present exactly
+//      when it was inserted once more than it was deleted.
+//   3: each key has one owner thread, which checks its own history after every call
+//      (after insert the key is found, after delete it is not).
+// Finally the tree must be a valid BST with no unlinked node still reachable.
+//
+// Benchmark: for 1, 2, 4, ... threads and 100%, 95% and 50% finds (the rest split between
+// insert and delete), every thread runs random operations for a fixed time.
+//
+// Build:  gcc -O2 -pthread ctree_bench.c -o ctree_bench
+// Usage:  ./ctree_bench [max_threads] [key_range] [ms_per_run]   (defaults: 8, 1000000, 300)
+
+#define _POSIX_C_SOURCE 200809L
+#define DS_NO_MAIN
+
+// --- Includes Section ---
+#include "../TREE/simple.c"
+#include "../TREE/concurrent.c"
+#include "../common/timer.h"
+#include <unistd.h>  // sysconf
+
+// --- Stress Test ---
+
+#define STRESS_KEYS 512
+#define STRESS_OPS 200000
+
+typedef struct StressArgs {
+    CTree *tree;
+    int id;
+    int threads;
+    long inserts[STRESS_KEYS];     // Successful inserts per shared key
+    long deletes[STRESS_KEYS];     // Successful deletes per shared key
+    long errors;                   // Finds that contradicted the rules above
+} StressArgs;
+
+static void* stress_worker(void *arg) {
+    StressArgs *args = (StressArgs*)arg;
+    EbrThread *self = ct_register(args->tree);
+    uint64_t seed = 777 + (uint64_t)args->id;
+    for (int i = 0; i < STRESS_OPS; i++) {
+        uint64_t r = xorshift64(&seed);
+        int key = (int)(r % STRESS_KEYS);
+        int op = (int)((r >> 32) % 3);
+        int group = key % 4;
+        int owned = group == 3 && (key / 4) % args->threads == args->id;
+        if (group == 0 || group == 2 || (group == 3 && !owned)) {
+            int found = ct_find(args->tree, self, key);
+            if ((group == 0 && !found) || (group == 2 && found)) args->errors++;
+        } else if (op == 0) {
+            int inserted = ct_insert(args->tree, self, key);
+            args->inserts[key] += inserted;
+            if (owned && !ct_find(args->tree, self, key)) args->errors++;
+        } else if (op == 1) {
+            int deleted = ct_delete(args->tree, self, key);
+            args->deletes[key] += deleted;
+            if (owned && ct_find(args->tree, self, key)) args->errors++;
+        } else {
+            ct_find(args->tree, self, key);
+        }
+    }
+    return NULL;
+}
+
+typedef struct CheckState {
+    int last;                      // Previous key in order
+    long problems;
+    int present[STRESS_KEYS];
+} CheckState;
+
+static void check_node(CTreeNode *node, void *ctx) {
+    CheckState *state = (CheckState*)ctx;
+    if (node->data <= state->last || atomic_load(&node->removed)) state->problems++;
+    if (!atomic_load(&node->deleted)) state->present[node->data] = 1;
+    state->last = node->data;
+}
+
+// Returns the number of problems found (0 means the run passed).
+static long run_stress(int threads) {
+    CTree *tree = (CTree*)aligned_alloc(64, sizeof(CTree));
+    StressArgs *args = (StressArgs*)calloc((size_t)threads, sizeof(StressArgs));
+    pthread_t *ids = (pthread_t*)malloc((size_t)threads * sizeof(pthread_t));
+    CheckState *state = (CheckState*)calloc(1, sizeof(CheckState));
+    if (!tree || !args || !ids || !state) {
+        printf("Memory allocation error!\n");
+        exit(1);
+    }
+    ct_init(tree);
+    EbrThread *self = ct_register(tree);
+    uint64_t seed = 5;
+    // Stable keys: mostly random order (so the tree is not a chain), then any left over
+    for (int i = 0; i < STRESS_KEYS / 4; i++) {
+        ct_insert(tree, self, (int)(xorshift64(&seed) % (STRESS_KEYS / 4)) * 4);
+    }
+    for (int key = 0; key < STRESS_KEYS; key += 4) {
+        ct_insert(tree, self, key);
+    }
+
+    for (int i = 0; i < threads; i++) {
+        args[i].tree = tree;
+        args[i].id = i;
+        args[i].threads = threads;
+        pthread_create(&ids[i], NULL, stress_worker, &args[i]);
+    }
+    for (int i = 0; i < threads; i++) {
+        pthread_join(ids[i], NULL);
+    }
+
+    long problems = 0;
+    for (int i = 0; i < threads; i++) {
+        problems += args[i].errors;
+    }
+    state->last = -1;
+    ct_walk(tree, check_node, state);
+    problems += state->problems;
+    for (int key = 0; key < STRESS_KEYS; key++) {
+        int expected;
+        if (key % 4 == 0) {
+            expected = 1;
+        } else if (key % 4 == 2) {
+            expected = 0;
+        } else {
+            long net = 0;
+            for (int i = 0; i < threads; i++) {
+                net += args[i].inserts[key] - args[i].deletes[key];
+            }
+            expected = (int)net;
+        }
+        if (state->present[key] != expected) problems++;
+    }
+
+    ct_destroy(tree);
+    free(tree);
+    free(args);
+    free(ids);
+    free(state);
+    return problems;
+}
+
+// --- Scaling Benchmark ---
+
+static TreeNode *locked_root = NULL;
+static pthread_mutex_t tree_lock = PTHREAD_MUTEX_INITIALIZER;
+
+typedef struct BenchArgs {
+    CTree *tree;                   // NULL runs simple.c's tree behind the global mutex
+    int id;
+    int key_range;
+    int find_percent;
+    atomic_int *stop;
+    long ops;
+} BenchArgs;
+
+static void* bench_worker(void *arg) {
+    BenchArgs *args = (BenchArgs*)arg;
+    EbrThread *self = args->tree != NULL ? ct_register(args->tree) : NULL;
+    uint64_t seed = 31 + (uint64_t)args->id;
+    int insert_below = args->find_percent + (100 - args->find_percent) / 2;
+    long ops = 0;
+    while (!atomic_load_explicit(args->stop, memory_order_relaxed)) {
+        for (int i = 0; i < 64; i++, ops++) {
+            uint64_t r = xorshift64(&seed);
+            int key = (int)(r % (uint64_t)args->key_range);
+            int roll = (int)((r >> 32) % 100);
+            if (args->tree != NULL) {
+                if (roll < args->find_percent) ct_find(args->tree, self, key);
+                else if (roll < insert_below) ct_insert(args->tree, self, key);
+                else ct_delete(args->tree, self, key);
+            } else {
+                pthread_mutex_lock(&tree_lock);
+                if (roll < args->find_percent) find(locked_root, key);
+                else if (roll < insert_below) locked_root = insert(locked_root, key);
+                else locked_root = delete(locked_root, key);
+                pthread_mutex_unlock(&tree_lock);
+            }
+        }
+    }
+    args->ops = ops;
+    return NULL;
+}
+
+// Fills half the key range in random order, runs the workers for `ms` ms, returns Mops/s.
+static double run_bench(int concurrent, int threads, int key_range, int find_percent, int ms) {
+    CTree *tree = NULL;
+    uint64_t seed = 11;
+    if (concurrent) {
+        tree = (CTree*)aligned_alloc(64, sizeof(CTree));
+        if (!tree) {
+            printf("Memory allocation error!\n");
+            exit(1);
+        }
+        ct_init(tree);
+        EbrThread *self = ct_register(tree);
+        for (int i = 0; i < key_range / 2; i++) {
+            ct_insert(tree, self, (int)(xorshift64(&seed) % (uint64_t)key_range));
+        }
+    } else {
+        for (int i = 0; i < key_range / 2; i++) {
+            locked_root = insert(locked_root, (int)(xorshift64(&seed) % (uint64_t)key_range));
+        }
+    }
+
+    atomic_int stop;
+    atomic_init(&stop, 0);
+    BenchArgs args[EBR_MAX_THREADS - 1];
+    pthread_t ids[EBR_MAX_THREADS - 1];
+    for (int i = 0; i < threads; i++) {
+        args[i] = (BenchArgs){tree, i, key_range, find_percent, &stop, 0};
+        pthread_create(&ids[i], NULL, bench_worker, &args[i]);
+    }
+    uint64_t t0 = now_ns();
+    struct timespec pause = {ms / 1000, (long)(ms % 1000) * 1000000L};
+    nanosleep(&pause, NULL);
+    atomic_store(&stop, 1);
+    long total = 0;
+    for (int i = 0; i < threads; i++) {
+        pthread_join(ids[i], NULL);
+        total += args[i].ops;
+    }
+    uint64_t elapsed = now_ns() - t0;
+
+    if (concurrent) {
+        ct_destroy(tree);
+        free(tree);
+    } else {
+        free_tree(locked_root);
+        locked_root = NULL;
+    }
+    return total * 1000.0 / (double)elapsed;
+}
+
+// --- Main Function ---
+int main(int argc, char *argv[]) {
+    int max_threads = argc > 1 ? atoi(argv[1]) : 8;
+    int key_range = argc > 2 ? atoi(argv[2]) : 1000000;
+    int ms = argc > 3 ? atoi(argv[3]) : 300;
+    if (max_threads < 1) max_threads = 1;
+    if (max_threads > EBR_MAX_THREADS - 1) max_threads = EBR_MAX_THREADS - 1;  // One slot for the filler
+    if (key_range < 2) key_range = 2;
+    if (ms < 1) ms = 1;
+
+    int stress_threads = max_threads < 4 ? 4 : max_threads;
+    long problems = run_stress(stress_threads);
+    printf("Stress test: %d threads x %d ops on %d keys: %s (%ld problems)\n", stress_threads,
+           STRESS_OPS, STRESS_KEYS, problems == 0 ? "passed" : "FAILED", problems);
+
+    static const int find_percents[] = {100, 95, 50};
+    printf("\n%d keys, %d ms per run, %ld online CPUs, Mops/s\n", key_range, ms,
+           sysconf(_SC_NPROCESSORS_ONLN));
+    printf("%8s %8s %12s %12s\n", "finds", "threads", "global lock", "concurrent");
+    for (int f = 0; f < 3; f++) {
+        for (int threads = 1; threads <= max_threads; threads *= 2) {
+            double locked = run_bench(0, threads, key_range, find_percents[f], ms);
+            double concurrent = run_bench(1, threads, key_range, find_percents[f], ms);
+            printf("%7d%% %8d %12.2f %12.2f\n", find_percents[f], threads, locked, concurrent);
+        }
+    }
+
+    slab_destroy(&node_pool);
+    return problems == 0 ? 0 : 1;
+}
@@ -0,0 +1,337 @@
+// This C program checks and benchmarks the buffered output writer (common/dump.h) on the
+// dynamic array (array/arrays.c) and the doubly linked list (DDL/DDL_first.c), or on the
+// binary tree (TREE/simple.c) when built with -DDUMP_BENCH_TREE: the tree and the list
+// programs cannot be included together, their node functions share names.
+//
+// Check: dump_itoa must agree with snprintf("%d") on edge and random values. The print_
+// functions must produce exactly the text the old printf loops produced, in order with
+// printf output around them. Text and binary dumps must read back (common/ingest.h) to
+// the same elements.
+//
+// Benchmark, for n elements, all output going to one file (page cache):
+//   printf per element: the old print_ loop, printf("%d -> ") per element
+//   print_:             the same text through the shared stdout writer
+//   dump text:          one int per line through a DumpWriter
+//   dump binary:        raw 32-bit ints through a DumpWriter
+//
+// Build:  gcc -O2 dump_bench.c -o dump_bench   (add -DDUMP_BENCH_TREE for the tree rows)
+// Usage:  ./dump_bench [n] [file]   (defaults: n = 10000000, file = bench.dump)
+
+#define _POSIX_C_SOURCE 200809L
+#define DS_NO_MAIN
+
+// --- Includes Section ---
+#ifdef DUMP_BENCH_TREE
+#include "../TREE/simple.c"
+#else
+#include "../DDL/DDL_first.c"
+#endif
+#include "../array/arrays.c"
+#include "../common/timer.h"
+
+// --- Stdout Redirection ---
+// The print_ functions write to stdout, so for the check and the timed runs stdout is
+// pointed at a file with dup2, and restored afterwards.
+
+static int redirect_stdout(const char *path) {
+    fflush(stdout);
+    int saved = dup(STDOUT_FILENO);
+    int fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (saved < 0 || fd < 0) {
+        printf("Error: Cannot redirect stdout to %s.\n", path);
+        exit(1);
+    }
+    dup2(fd, STDOUT_FILENO);
+    close(fd);
+    return saved;
+}
+
+static void restore_stdout(int saved) {
+    fflush(stdout);
+    dup2(saved, STDOUT_FILENO);
+    close(saved);
+}
+
+// Reads a whole file into a malloc'd, zero-terminated string; *bytes receives its length.
+static char* read_file(const char *path, long *bytes) {
+    FILE *file = fopen(path, "rb");
+    if (!file) {
+        printf("Error: Cannot open %s.\n", path);
+        exit(1);
+    }
+    fseek(file, 0, SEEK_END);
+    *bytes = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    char *text = (char*)malloc((size_t)*bytes + 1);
+    if (!text) {
+        printf("Memory allocation error!\n");
+        exit(1);
+    }
+    *bytes = (long)fread(text, 1, (size_t)*bytes, file);
+    text[*bytes] = '\0';
+    fclose(file);
+    return text;
+}
+
+// --- Old Print Loops ---
+// The print_ functions as they were, one printf per element.
+
+static void old_print_array(const Vector *vec) {
+    printf("[");
+    for (int i = 0; i < vec->size; i++) {
+        printf("%d", vec->data[i]);
+        if (i < vec->size - 1) {
+            printf(", ");
+        }
+    }
+    printf("]\n");
+}
+
+#ifdef DUMP_BENCH_TREE
+static void old_print_node(TreeNode *node, void *ctx) {
+    (void)ctx;
+    printf("%d -> ", node->data);
+}
+
+// The structure under test besides the array: build, print old and new, dump, free
+typedef TreeNode* Structure;
+
+static Structure build_structure(const int *sorted, int n) {
+    return build_from_sorted(sorted, n);
+}
+
+static void old_print_structure(Structure root) {
+    inorder_visit(root, old_print_node, NULL);
+}
+
+static void print_structure(Structure root) {
+    inorder_traversal(root);
+}
+
+static void dump_structure(Structure root, DumpWriter *out) {
+    dump_tree(root, out);
+}
+
+static void free_structure(Structure root) {
+    free_tree(root);
+    slab_destroy(&node_pool);
+}
+#define STRUCTURE_NAME "tree"
+#define PRINT_NAME "inorder_traversal"
+#else
+static void old_print_list_forward(const List *list) {
+    Node *temp = list->head;
+    while (temp != NULL) {
+        printf("%d -> ", temp->data);
+        temp = temp->next;
+    }
+    printf("NULL\n");
+}
+
+typedef List* Structure;
+
+static Structure build_structure(const int *values, int n) {
+    List *list = (List*)malloc(sizeof(List));
+    if (!list) {
+        printf("Memory allocation error!\n");
+        exit(1);
+    }
+    init_list(list);
+    append_many(list, values, n);
+    return list;
+}
+
+static void old_print_structure(Structure list) {
+    old_print_list_forward(list);
+}
+
+static void print_structure(Structure list) {
+    print_list_forward(list);
+}
+
+static void dump_structure(Structure list, DumpWriter *out) {
+    dump_list(list, out);
+}
+
+static void free_structure(Structure list) {
+    free_list(list);
+    free(list);
+    slab_destroy(&node_pool);
+}
+#define STRUCTURE_NAME "list"
+#define PRINT_NAME "print_list_forward"
+#endif
+
+// --- Check ---
+
+static long check_itoa(void) {
+    long problems = 0;
+    static const int edges[] = {0, 1, -1, 9, 10, -10, 99, 100, 101, 999999999, 1000000000,
+                                -1000000000, INT32_MAX, INT32_MIN, INT32_MIN + 1};
+    uint64_t seed = 13;
+    for (int i = 0; i < 1000000 + 15; i++) {
+        int value = i < 15 ? edges[i] : (int)(uint32_t)xorshift64(&seed) >> (i % 31);
+        char expected[16], got[16];
+        int length = snprintf(expected, sizeof(expected), "%d", value);
+        size_t written = dump_itoa(got, value);
+        if (written != (size_t)length || memcmp(got, expected, written) != 0) problems++;
+    }
+    return problems;
+}
+
+// Runs print (new) and old_print with stdout on path and returns 1 if the files differ.
+static int outputs_differ(const char *path, void (*print)(const void*), void (*old_print)(const void*),
+                          const void *structure) {
+    long new_bytes, old_bytes;
+    int saved = redirect_stdout(path);
+    printf("before ");          // printf text on both sides must stay in place
+    print(structure);
+    printf(" after\n");
+    restore_stdout(saved);
+    char *new_text = read_file(path, &new_bytes);
+    saved = redirect_stdout(path);
+    printf("before ");
+    old_print(structure);
+    printf(" after\n");
+    restore_stdout(saved);
+    char *old_text = read_file(path, &old_bytes);
+    int differ = new_bytes != old_bytes || memcmp(new_text, old_text, (size_t)new_bytes) != 0;
+    free(new_text);
+    free(old_text);
+    return differ;
+}
+
+static void print_array_any(const void *p) { print_array((const Vector*)p); }
+static void old_print_array_any(const void *p) { old_print_array((const Vector*)p); }
+static void print_structure_any(const void *p) { print_structure((Structure)p); }
+static void old_print_structure_any(const void *p) { old_print_structure((Structure)p); }
+
+static long run_check(const char *path) {
+    long problems = check_itoa();
+    uint64_t seed = 21;
+    static const int sizes[] = {0, 1, 2, 1000, 300000};  // 300000 elements > one 1 MiB buffer
+    for (int s = 0; s < 5; s++) {
+        int n = sizes[s];
+        int *values = (int*)malloc((size_t)(n + 1) * sizeof(int));
+        if (!values) {
+            printf("Memory allocation error!\n");
+            exit(1);
+        }
+        int key = INT32_MIN;
+        for (int i = 0; i < n; i++) {
+            key += 1 + (int)(xorshift64(&seed) % 10000);  // Sorted and distinct, for the tree
+            values[i] = key;
+        }
+        if (n > 1) values[n - 1] = INT32_MAX;
+        Vector vec;
+        vector_init(&vec);
+        vector_append_many(&vec, values, n);
+        Structure structure = build_structure(values, n);
+
+        if (outputs_differ(path, print_array_any, old_print_array_any, &vec)) problems++;
+        if (outputs_differ(path, print_structure_any, old_print_structure_any, structure)) problems++;
+
+        for (int format = DUMP_TEXT; format <= DUMP_BINARY; format++) {
+            DumpWriter out;
+            Vector back;
+            vector_init(&back);
+            dump_create(&out, path, format);
+            dump_array(&vec, &out);
+            dump_close(&out);
+            if (ingest_array(&back, path, format) != n ||
+                (n > 0 && memcmp(back.data, values, (size_t)n * sizeof(int)) != 0)) problems++;
+            vector_free(&back);
+            dump_create(&out, path, format);
+            dump_structure(structure, &out);
+            dump_close(&out);
+            if (ingest_array(&back, path, format) != n ||
+                (n > 0 && memcmp(back.data, values, (size_t)n * sizeof(int)) != 0)) problems++;
+            vector_free(&back);
+        }
+        free_structure(structure);
+        vector_free(&vec);
+        free(values);
+    }
+    remove(path);
+    return problems;
+}
+
+// --- Benchmark ---
+
+static void print_row(const char *structure, const char *method, uint64_t ns, const char *path, int n) {
+    struct stat st;
+    double bytes = stat(path, &st) == 0 ? (double)st.st_size : 0;
+    double seconds = (double)ns / 1e9;
+    printf("%-7s %-20s %10.1f %10.0f %10.1f %12.0f\n", structure, method, (double)ns / 1e6,
+           bytes / 1e6 / seconds, n / 1e6 / seconds, bytes);
+}
+
+static void bench_print(const char *structure, const char *method, const char *path, int n,
+                        void (*print)(const void*), const void *data) {
+    remove(path);  // Freeing the previous run's pages is not part of this run
+    int saved = redirect_stdout(path);
+    uint64_t t0 = now_ns();
+    print(data);
+    fflush(stdout);
+    uint64_t ns = now_ns() - t0;
+    restore_stdout(saved);
+    print_row(structure, method, ns, path, n);
+}
+
+static void bench_dump(const char *structure, const char *method, const char *path, int n,
+                       int format, const Vector *vec, Structure other) {
+    DumpWriter out;
+    remove(path);
+    uint64_t t0 = now_ns();
+    dump_create(&out, path, format);
+    if (vec != NULL) {
+        dump_array(vec, &out);
+    } else {
+        dump_structure(other, &out);
+    }
+    dump_close(&out);
+    print_row(structure, method, now_ns() - t0, path, n);
+}
+
+// --- Main Function ---
+int main(int argc, char *argv[]) {
+    int n = argc > 1 ? atoi(argv[1]) : 10000000;
+    const char *path = argc > 2 ? argv[2] : "bench.dump";
+    if (n < 1) n = 1;
+
+    long problems = run_check(path);
+    printf("Check: %s (%ld problems)\n", problems == 0 ? "passed" : "FAILED", problems);
+
+    // Sorted distinct keys spread over the whole int range (the tree needs them sorted),
+    // about 10 characters each as text
+    int *values = (int*)malloc((size_t)n * sizeof(int));
+    if (!values) {
+        printf("Memory allocation error!\n");
+        return 1;
+    }
+    uint32_t step = (uint32_t)(UINT32_MAX / (uint32_t)n);
+    for (int i = 0; i < n; i++) {
+        values[i] = (int)((uint32_t)INT32_MIN + (uint32_t)i * step);
+    }
+    Vector vec;
+    vector_init(&vec);
+    vector_append_many(&vec, values, n);
+    Structure structure = build_structure(values, n);
+
+    printf("\n%d elements, written to %s\n", n, path);
+    printf("%-7s %-20s %10s %10s %10s %12s\n", "struct", "method", "ms", "MB/s", "Melem/s", "bytes");
+    bench_print("array", "printf per element", path, n, old_print_array_any, &vec);
+    bench_print("array", "print_array", path, n, print_array_any, &vec);
+    bench_dump("array", "dump text", path, n, DUMP_TEXT, &vec, NULL);
+    bench_dump("array", "dump binary", path, n, DUMP_BINARY, &vec, NULL);
+    bench_print(STRUCTURE_NAME, "printf per element", path, n, old_print_structure_any, structure);
+    bench_print(STRUCTURE_NAME, PRINT_NAME, path, n, print_structure_any, structure);
+    bench_dump(STRUCTURE_NAME, "dump text", path, n, DUMP_TEXT, NULL, structure);
+    bench_dump(STRUCTURE_NAME, "dump binary", path, n, DUMP_BINARY, NULL, structure);
+
+    free_structure(structure);
+    vector_free(&vec);
+    free(values);
+    remove(path);
+    return problems == 0 ? 0 : 1;
+}
@@ -0,0 +1,237 @@
+// This C program checks and benchmarks the frozen (pointer-free) snapshots of TREE/simple.c
+// against the pointer-based trees they are frozen from.
+//   avl (random):  avl_insert of the keys in random order, nodes scattered over the pool
+//   build_sorted:  build_from_sorted, nodes in one block in preorder
+//   eytzinger:     freeze_tree(FROZEN_EYTZINGER), keys in BFS order
+//   veb:           freeze_tree(FROZEN_VEB), keys in van Emde Boas order
+// Each one answers the same random finds (about half miss) and short range scans, and the
+// program reports the bytes used per key.
+//
+// Check: for several sizes, the vEB array must equal a straightforward recursive vEB
+// layout, and both snapshots must agree with the tree on find, find_min and range scans.
+//
+// Build:  gcc -O2 frozen_bench.c -o frozen_bench
+// Usage:  ./frozen_bench [n] [finds] [width]   (defaults: n = 4000000, finds = 2000000, width = 64)
+
+#define _POSIX_C_SOURCE 200809L
+#define DS_NO_MAIN
+
+// --- Includes Section ---
+#include "../TREE/simple.c"
+#include "../common/timer.h"
+
+// --- Check ---
+
+// Textbook vEB layout of the BFS array bfs[1..]: top half first, then each bottom tree.
+static int reference_veb(const int *bfs, int *out, int next, unsigned root, int height) {
+    if (height == 1) {
+        out[next++] = bfs[root];
+        return next;
+    }
+    int top = height / 2;
+    int bottom = height - top;
+    next = reference_veb(bfs, out, next, root, top);
+    unsigned first = root << top;  // Leftmost node `top` levels below root
+    for (unsigned j = 0; j < (1u << top); j++) {
+        next = reference_veb(bfs, out, next, first + j, bottom);
+    }
+    return next;
+}
+
+static long check_size(int n, uint64_t *seed) {
+    long problems = 0;
+    int *keys = (int*)calloc((size_t)(n > 0 ? n : 1), sizeof(int));
+    if (!keys) {
+        printf("Memory allocation error!\n");
+        exit(1);
+    }
+    int key = -(int)(xorshift64(seed) % 50);
+    for (int i = 0; i < n; i++) {
+        key += 1 + (int)(xorshift64(seed) % 3);  // Strictly increasing with gaps
+        keys[i] = key;
+    }
+    TreeNode *root = build_from_sorted(keys, n);
+    FrozenTree eyt, veb;
+    freeze_tree(&eyt, root, FROZEN_EYTZINGER);
+    freeze_tree(&veb, root, FROZEN_VEB);
+
+    if (n > 0) {
+        int slots = (1 << eyt.levels) - 1;
+        int *bfs = (int*)malloc((size_t)(slots + 1) * sizeof(int));
+        int *expected = (int*)malloc((size_t)slots * sizeof(int));
+        if (!bfs || !expected) {
+            printf("Memory allocation error!\n");
+            exit(1);
+        }
+        for (int i = 0; i < slots; i++) bfs[i + 1] = eyt.keys[i];
+        reference_veb(bfs, expected, 0, 1, eyt.levels);
+        for (int i = 0; i < slots; i++) {
+            if (veb.keys[i] != expected[i]) problems++;
+        }
+        free(bfs);
+        free(expected);
+    }
+
+    FrozenTree *snapshots[2] = {&eyt, &veb};
+    for (int s = 0; s < 2; s++) {
+        FrozenTree *frozen = snapshots[s];
+        const int *min = frozen_find_min(frozen);
+        if ((n == 0) != (min == NULL) || (n > 0 && *min != keys[0])) problems++;
+        for (int probe = (n > 0 ? keys[0] : 0) - 2; probe <= key + 2; probe++) {
+            const int *found = frozen_find(frozen, probe);
+            if ((found != NULL) != (find(root, probe) != NULL)) problems++;
+            if (found != NULL && *found != probe) problems++;
+
+            // Scan [probe, probe + 5] and compare with the tree's cursor
+            FrozenCursor fc;
+            TreeCursor tc;
+            frozen_cursor_init_at(&fc, frozen, probe);
+            cursor_init_at(&tc, root, probe);
+            while (1) {
+                const int *a = frozen_cursor_next(&fc);
+                TreeNode *b = cursor_next(&tc);
+                if (a != NULL && *a > probe + 5) a = NULL;
+                if (b != NULL && b->data > probe + 5) b = NULL;
+                if ((a == NULL) != (b == NULL) || (a != NULL && *a != b->data)) {
+                    problems++;
+                    break;
+                }
+                if (a == NULL) break;
+            }
+            cursor_free(&tc);
+        }
+        // A full scan returns exactly the n keys
+        FrozenCursor fc;
+        frozen_cursor_init_at(&fc, frozen, INT_MIN);
+        int count = 0;
+        for (const int *k = frozen_cursor_next(&fc); k != NULL; k = frozen_cursor_next(&fc), count++) {
+            if (count >= n || *k != keys[count]) problems++;
+        }
+        if (count != n) problems++;
+    }
+
+    frozen_free(&eyt);
+    frozen_free(&veb);
+    free_tree(root);
+    free(keys);
+    return problems;
+}
+
+// --- Benchmark ---
+
+static void print_row(const char *name, size_t bytes, int n, uint64_t find_ns, int finds,
+                      long hits, uint64_t scan_ns, int scans, long scanned) {
+    printf("%-14s %10.1f %10.1f %9ld %12.1f %9ld\n", name, (double)bytes / n,
+           (double)find_ns / finds, hits, (double)scan_ns / scans, scanned);
+}
+
+static void bench_tree(const char *name, TreeNode *root, int n, const int *probes, int finds,
+                       int width) {
+    long hits = 0, scanned = 0;
+    uint64_t t0 = now_ns();
+    for (int i = 0; i < finds; i++) {
+        hits += find(root, probes[i]) != NULL;
+    }
+    uint64_t t1 = now_ns();
+    int scans = finds / 10;
+    for (int i = 0; i < scans; i++) {
+        TreeCursor cursor;
+        cursor_init_at(&cursor, root, probes[i]);
+        for (TreeNode *node = cursor_next(&cursor); node != NULL && node->data <= probes[i] + width;
+             node = cursor_next(&cursor)) {
+            scanned++;
+        }
+        cursor_free(&cursor);
+    }
+    uint64_t t2 = now_ns();
+    print_row(name, (size_t)n * sizeof(TreeNode), n, t1 - t0, finds, hits, t2 - t1, scans, scanned);
+}
+
+static void bench_frozen(const char *name, const FrozenTree *frozen, int n, const int *probes,
+                         int finds, int width) {
+    long hits = 0, scanned = 0;
+    uint64_t t0 = now_ns();
+    for (int i = 0; i < finds; i++) {
+        hits += frozen_find(frozen, probes[i]) != NULL;
+    }
+    uint64_t t1 = now_ns();
+    int scans = finds / 10;
+    for (int i = 0; i < scans; i++) {
+        FrozenCursor cursor;
+        frozen_cursor_init_at(&cursor, frozen, probes[i]);
+        for (const int *key = frozen_cursor_next(&cursor); key != NULL && *key <= probes[i] + width;
+             key = frozen_cursor_next(&cursor)) {
+            scanned++;
+        }
+    }
+    uint64_t t2 = now_ns();
+    size_t bytes = (((size_t)1 << frozen->levels) - 1) * sizeof(int);
+    print_row(name, bytes, n, t1 - t0, finds, hits, t2 - t1, scans, scanned);
+}
+
+// --- Main Function ---
+int main(int argc, char *argv[]) {
+    int n = argc > 1 ? atoi(argv[1]) : 4000000;
+    int finds = argc > 2 ? atoi(argv[2]) : 2000000;
+    int width = argc > 3 ? atoi(argv[3]) : 64;
+    if (n < 1) n = 1;
+    if (finds < 10) finds = 10;
+    if (width < 0) width = 0;
+
+    uint64_t seed = 21;
+    long problems = 0;
+    for (int size = 0; size <= 300; size++) {
+        problems += check_size(size, &seed);
+    }
+    problems += check_size(100000, &seed);
+    printf("Check: %s (%ld problems)\n", problems == 0 ? "passed" : "FAILED", problems);
+
+    // Even keys 0, 2, ..., 2n - 2; probes over [0, 2n) so about half of them miss
+    int *keys = (int*)malloc((size_t)n * sizeof(int));
+    int *shuffled = (int*)malloc((size_t)n * sizeof(int));
+    int *probes = (int*)malloc((size_t)finds * sizeof(int));
+    if (!keys || !shuffled || !probes) {
+        printf("Memory allocation error!\n");
+        return 1;
+    }
+    for (int i = 0; i < n; i++) {
+        keys[i] = 2 * i;
+        shuffled[i] = keys[i];
+    }
+    for (int i = n - 1; i > 0; i--) {  // Fisher-Yates shuffle
+        int j = (int)(xorshift64(&seed) % (uint64_t)(i + 1));
+        int temp = shuffled[i];
+        shuffled[i] = shuffled[j];
+        shuffled[j] = temp;
+    }
+    for (int i = 0; i < finds; i++) {
+        probes[i] = (int)(xorshift64(&seed) % (uint64_t)(2 * n));
+    }
+
+    printf("\n%d keys, %d finds, %d range scans of width %d\n", n, finds, finds / 10, width);
+    printf("%-14s %10s %10s %9s %12s %9s\n", "layout", "bytes/key", "find ns", "hits",
+           "scan ns", "scanned");
+    TreeNode *random_tree = NULL;
+    for (int i = 0; i < n; i++) {
+        random_tree = avl_insert(random_tree, shuffled[i]);
+    }
+    bench_tree("avl (random)", random_tree, n, probes, finds, width);
+    TreeNode *built = build_from_sorted(keys, n);
+    bench_tree("build_sorted", built, n, probes, finds, width);
+
+    FrozenTree frozen;
+    freeze_tree(&frozen, random_tree, FROZEN_EYTZINGER);
+    bench_frozen("eytzinger", &frozen, n, probes, finds, width);
+    frozen_free(&frozen);
+    freeze_tree(&frozen, random_tree, FROZEN_VEB);
+    bench_frozen("veb", &frozen, n, probes, finds, width);
+    frozen_free(&frozen);
+
+    free_tree(random_tree);
+    free_tree(built);
+    slab_destroy(&node_pool);
+    free(keys);
+    free(shuffled);
+    free(probes);
+    return problems == 0 ? 0 : 1;
+}
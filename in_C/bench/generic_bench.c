@@ -0,0 +1,659 @@
+// This C program checks and benchmarks the type-generic structures (array/vector_gen.h,
+// TREE/tree_gen.h, DDL/list_gen.h) against the hand-written int programs: the dynamic array
+// (array/arrays.c) and the AVL operations of the binary tree (TREE/simple.c), or the doubly
+// linked list (DDL/DDL_first.c) when built with -DGENERIC_BENCH_LIST: the tree and the list
+// programs cannot be included together, their node functions share names.
+//
+// Check: the int instantiations must have the node layout of the hand-written nodes and
+// must give the same contents as the hand-written int operations after random inserts and
+// deletes. Rank and select must agree, and inserting an existing key into a tree of pairs
+// must replace the value.
+//
+// Benchmark, ns per operation, best of the repetitions:
+//   hand-written int    the functions of the int programs
+//   int                 DEFINE_*(..., int, int, GEN_SELF, GEN_LESS): should cost the same
+//   int64               64-bit keys
+//   pair                {int64 key, int64 value} stored in the node, found by key
+//   record              a 64-byte record stored in the node, found by its id
+//   boxed pair (tree)   the void* way: each pair malloc'd on its own, the node holds the
+//                       pointer and keys are compared through a function pointer
+// The vector find row of the hand-written int vector uses the SIMD scan of arrays.c; the
+// generated find is a plain loop for any type, so that column is not like for like.
+//
+// Build:  gcc -O2 generic_bench.c -o generic_bench   (add -DGENERIC_BENCH_LIST for the list rows)
+// Usage:  ./generic_bench [n] [repetitions]   (defaults: n = 1000000, repetitions = 3)
+
+#define _POSIX_C_SOURCE 200809L
+#define DS_NO_MAIN
+
+// --- Includes Section ---
+#ifdef GENERIC_BENCH_LIST
+#include "../DDL/DDL_first.c"
+#include "../DDL/list_gen.h"
+#else
+#include "../TREE/simple.c"
+#include "../TREE/tree_gen.h"
+#endif
+#include "../array/arrays.c"
+#include "../array/vector_gen.h"
+#include "../common/timer.h"
+
+#define LINEAR_OPS 200  // Operations per row for the O(n) operations (find, insert, node_at)
+
+// --- Element Types ---
+typedef struct Pair {
+    int64_t key;
+    int64_t value;
+} Pair;
+
+typedef struct Record {
+    uint64_t id;
+    uint64_t payload[7];       // 64 bytes in all
+} Record;
+
+#define PAIR_KEY(p) ((p).key)
+#define RECORD_ID(r) ((r).id)
+
+// Element made from an int key, for each type
+#define MAKE_INT(k) (k)
+#define MAKE_I64(k) ((int64_t)(k) * 65537)
+#define MAKE_PAIR(k) ((Pair){(int64_t)(k), (int64_t)(k) * 3})
+#define MAKE_RECORD(k) ((Record){(uint64_t)(uint32_t)(k), {(uint64_t)(k), 1, 2, 3, 4, 5, 6}})
+
+// Key made from an int key, matching the MAKE_ above
+#define PROBE_INT(k) (k)
+#define PROBE_I64(k) ((int64_t)(k) * 65537)
+#define PROBE_PAIR(k) ((int64_t)(k))
+#define PROBE_RECORD(k) ((uint64_t)(uint32_t)(k))
+
+// --- Generated Structures ---
+DEFINE_VECTOR(IntVector, int, int, GEN_SELF, GEN_LESS)
+DEFINE_VECTOR(I64Vector, int64_t, int64_t, GEN_SELF, GEN_LESS)
+DEFINE_VECTOR(PairVector, Pair, int64_t, PAIR_KEY, GEN_LESS)
+DEFINE_VECTOR(RecordVector, Record, uint64_t, RECORD_ID, GEN_LESS)
+
+#ifdef GENERIC_BENCH_LIST
+DEFINE_LIST(IntList, int, int, GEN_SELF, GEN_LESS)
+DEFINE_LIST(I64List, int64_t, int64_t, GEN_SELF, GEN_LESS)
+DEFINE_LIST(PairList, Pair, int64_t, PAIR_KEY, GEN_LESS)
+DEFINE_LIST(RecordList, Record, uint64_t, RECORD_ID, GEN_LESS)
+#else
+DEFINE_TREE(IntTree, int, int, GEN_SELF, GEN_LESS)
+DEFINE_TREE(I64Tree, int64_t, int64_t, GEN_SELF, GEN_LESS)
+DEFINE_TREE(PairTree, Pair, int64_t, PAIR_KEY, GEN_LESS)
+DEFINE_TREE(RecordTree, Record, uint64_t, RECORD_ID, GEN_LESS)
+
+// The boxed baseline, built with the same generator: the element is a Pair* and LESS calls
+// a comparator through a pointer that is only set at run time, so it cannot be inlined.
+int (*boxed_compare)(const void *a, const void *b);
+
+static int compare_pairs(const void *a, const void *b) {
+    int64_t x = ((const Pair*)a)->key, y = ((const Pair*)b)->key;
+    return (x > y) - (x < y);
+}
+
+#define BOXED_LESS(a, b) (boxed_compare((a), (b)) < 0)
+DEFINE_TREE(BoxedTree, Pair*, const Pair*, GEN_SELF, BOXED_LESS)
+
+static Pair* box_pair(int k) {
+    Pair *pair = (Pair*)malloc(sizeof(Pair));
+    if (!pair) {
+        printf("Memory allocation error!\n");
+        exit(1);
+    }
+    *pair = MAKE_PAIR(k);
+    return pair;
+}
+#endif
+
+// --- Benchmark Rows ---
+// Each row times four operations and keeps a checksum so the work cannot be optimized away.
+typedef struct Row {
+    uint64_t ns[4];            // Total time of each operation
+    long ops[4];               // Operations timed in each column
+    long check;
+} Row;
+
+static void keep_best(Row *best, const Row *run, int first) {
+    for (int c = 0; c < 4; c++) {
+        if (first || run->ns[c] < best->ns[c]) best->ns[c] = run->ns[c];
+        best->ops[c] = run->ops[c];
+    }
+    best->check = run->check;
+}
+
+static void print_row(const char *name, size_t bytes, const Row *row) {
+    printf("%-20s %6zu", name, bytes);
+    for (int c = 0; c < 4; c++) {
+        printf(" %10.1f", (double)row->ns[c] / (double)row->ops[c]);
+    }
+    printf(" %14ld\n", row->check);
+}
+
+// Distinct keys in random order: multiplying by an odd constant is a bijection on 32 bits.
+static int key_of_index(int i) {
+    return (int)((uint32_t)i * 2654435761u);
+}
+
+// Vector rows: push_back, append_many (batches of 4096), find, insert + delete at random
+// indexes. The elements are made from keys[].
+#define DEFINE_VECTOR_BENCH(Name, T, MAKE, PROBE)                                               \
+static Row Name##_bench(const int *keys, int n) {                                               \
+    Row row = {{0}, {n, n, LINEAR_OPS, 2 * LINEAR_OPS}, 0};                                     \
+    Name vec;                                                                                   \
+    Name##_init(&vec);                                                                          \
+    uint64_t t0 = now_ns();                                                                     \
+    for (int i = 0; i < n; i++) {                                                               \
+        Name##_push_back(&vec, MAKE(keys[i]));                                                  \
+    }                                                                                           \
+    row.ns[0] = now_ns() - t0;                                                                  \
+                                                                                                \
+    T *batch = (T*)malloc(4096 * sizeof(T));                                                    \
+    if (!batch) {                                                                               \
+        printf("Memory allocation error!\n");                                                   \
+        exit(1);                                                                                \
+    }                                                                                           \
+    Name again;                                                                                 \
+    Name##_init(&again);                                                                        \
+    t0 = now_ns();                                                                              \
+    for (int i = 0; i < n; i += 4096) {                                                         \
+        int count = n - i < 4096 ? n - i : 4096;                                                \
+        for (int j = 0; j < count; j++) {                                                       \
+            batch[j] = MAKE(keys[i + j]);                                                       \
+        }                                                                                       \
+        Name##_append_many(&again, batch, count);                                               \
+    }                                                                                           \
+    row.ns[1] = now_ns() - t0;                                                                  \
+    free(batch);                                                                                \
+    Name##_free(&again);                                                                        \
+                                                                                                \
+    uint64_t seed = 3;                                                                          \
+    t0 = now_ns();                                                                              \
+    for (int i = 0; i < LINEAR_OPS; i++) {                                                      \
+        row.check += Name##_find(&vec, PROBE(keys[xorshift64(&seed) % (uint64_t)n]));           \
+    }                                                                                           \
+    row.ns[2] = now_ns() - t0;                                                                  \
+                                                                                                \
+    t0 = now_ns();                                                                              \
+    for (int i = 0; i < LINEAR_OPS; i++) {                                                      \
+        int index = (int)(xorshift64(&seed) % (uint64_t)vec.size);                              \
+        Name##_insert(&vec, index, MAKE(i));                                                    \
+        Name##_delete(&vec, (int)(xorshift64(&seed) % (uint64_t)vec.size));                     \
+    }                                                                                           \
+    row.ns[3] = now_ns() - t0;                                                                  \
+    row.check += vec.size;                                                                      \
+    Name##_free(&vec);                                                                          \
+    return row;                                                                                 \
+}
+
+static Row hand_vector_bench(const int *keys, int n) {
+    Row row = {{0}, {n, n, LINEAR_OPS, 2 * LINEAR_OPS}, 0};
+    Vector vec;
+    vector_init(&vec);
+    uint64_t t0 = now_ns();
+    for (int i = 0; i < n; i++) {
+        vector_push_back(&vec, keys[i]);
+    }
+    row.ns[0] = now_ns() - t0;
+
+    Vector again;
+    vector_init(&again);
+    t0 = now_ns();
+    for (int i = 0; i < n; i += 4096) {
+        vector_append_many(&again, &keys[i], n - i < 4096 ? n - i : 4096);
+    }
+    row.ns[1] = now_ns() - t0;
+    vector_free(&again);
+
+    uint64_t seed = 3;
+    t0 = now_ns();
+    for (int i = 0; i < LINEAR_OPS; i++) {
+        row.check += find_element(&vec, keys[xorshift64(&seed) % (uint64_t)n]);
+    }
+    row.ns[2] = now_ns() - t0;
+
+    t0 = now_ns();
+    for (int i = 0; i < LINEAR_OPS; i++) {
+        int index = (int)(xorshift64(&seed) % (uint64_t)vec.size);
+        insert_element(&vec, index, i);
+        delete_element(&vec, (int)(xorshift64(&seed) % (uint64_t)vec.size));
+    }
+    row.ns[3] = now_ns() - t0;
+    row.check += vec.size;
+    vector_free(&vec);
+    return row;
+}
+
+DEFINE_VECTOR_BENCH(IntVector, int, MAKE_INT, PROBE_INT)
+DEFINE_VECTOR_BENCH(I64Vector, int64_t, MAKE_I64, PROBE_I64)
+DEFINE_VECTOR_BENCH(PairVector, Pair, MAKE_PAIR, PROBE_PAIR)
+DEFINE_VECTOR_BENCH(RecordVector, Record, MAKE_RECORD, PROBE_RECORD)
+
+#ifdef GENERIC_BENCH_LIST
+// List rows: append, node_at, find, delete_at at random indexes.
+#define DEFINE_LIST_BENCH(Name, MAKE, PROBE)                                                    \
+static Row Name##_bench(const int *keys, int n) {                                               \
+    Row row = {{0}, {n, LINEAR_OPS, LINEAR_OPS, LINEAR_OPS}, 0};                                \
+    Name list;                                                                                  \
+    Name##_init(&list);                                                                         \
+    uint64_t t0 = now_ns();                                                                     \
+    for (int i = 0; i < n; i++) {                                                               \
+        Name##_append(&list, MAKE(keys[i]));                                                    \
+    }                                                                                           \
+    row.ns[0] = now_ns() - t0;                                                                  \
+                                                                                                \
+    uint64_t seed = 3;                                                                          \
+    t0 = now_ns();                                                                              \
+    for (int i = 0; i < LINEAR_OPS; i++) {                                                      \
+        row.check += Name##_node_at(&list, (int)(xorshift64(&seed) % (uint64_t)n)) != NULL;     \
+    }                                                                                           \
+    row.ns[1] = now_ns() - t0;                                                                  \
+                                                                                                \
+    t0 = now_ns();                                                                              \
+    for (int i = 0; i < LINEAR_OPS; i++) {                                                      \
+        row.check += Name##_find(&list, PROBE(keys[xorshift64(&seed) % (uint64_t)n])) != NULL;  \
+    }                                                                                           \
+    row.ns[2] = now_ns() - t0;                                                                  \
+                                                                                                \
+    t0 = now_ns();                                                                              \
+    for (int i = 0; i < LINEAR_OPS; i++) {                                                      \
+        Name##_delete_at(&list, (int)(xorshift64(&seed) % (uint64_t)list.length));              \
+    }                                                                                           \
+    row.ns[3] = now_ns() - t0;                                                                  \
+    row.check += list.length;                                                                   \
+    Name##_free(&list);                                                                         \
+    slab_destroy(&Name##_pool);                                                                 \
+    return row;                                                                                 \
+}
+
+static Row hand_list_bench(const int *keys, int n) {
+    Row row = {{0}, {n, LINEAR_OPS, LINEAR_OPS, LINEAR_OPS}, 0};
+    List list;
+    init_list(&list);
+    uint64_t t0 = now_ns();
+    for (int i = 0; i < n; i++) {
+        append(&list, keys[i]);
+    }
+    row.ns[0] = now_ns() - t0;
+
+    uint64_t seed = 3;
+    t0 = now_ns();
+    for (int i = 0; i < LINEAR_OPS; i++) {
+        row.check += node_at(&list, (int)(xorshift64(&seed) % (uint64_t)n)) != NULL;
+    }
+    row.ns[1] = now_ns() - t0;
+
+    t0 = now_ns();
+    for (int i = 0; i < LINEAR_OPS; i++) {
+        row.check += find(&list, keys[xorshift64(&seed) % (uint64_t)n]) != NULL;
+    }
+    row.ns[2] = now_ns() - t0;
+
+    t0 = now_ns();
+    for (int i = 0; i < LINEAR_OPS; i++) {
+        delete_at(&list, (int)(xorshift64(&seed) % (uint64_t)list.length));
+    }
+    row.ns[3] = now_ns() - t0;
+    row.check += list.length;
+    free_list(&list);
+    slab_destroy(&node_pool);
+    return row;
+}
+
+DEFINE_LIST_BENCH(IntList, MAKE_INT, PROBE_INT)
+DEFINE_LIST_BENCH(I64List, MAKE_I64, PROBE_I64)
+DEFINE_LIST_BENCH(PairList, MAKE_PAIR, PROBE_PAIR)
+DEFINE_LIST_BENCH(RecordList, MAKE_RECORD, PROBE_RECORD)
+#else
+// Tree rows: insert, find, in-order scan, delete, each over all n keys in random order.
+// RELEASE frees what MAKE allocated, after the timed deletes.
+#define DEFINE_TREE_BENCH(Name, T, MAKE, PROBE, KEY, RELEASE)                                   \
+static Row Name##_bench(const int *keys, int n) {                                               \
+    Row row = {{0}, {n, n, n, n}, 0};                                                           \
+    Name tree;                                                                                  \
+    Name##_init(&tree);                                                                         \
+    uint64_t t0 = now_ns();                                                                     \
+    for (int i = 0; i < n; i++) {                                                               \
+        Name##_insert(&tree, MAKE(keys[i]));                                                    \
+    }                                                                                           \
+    row.ns[0] = now_ns() - t0;                                                                  \
+                                                                                                \
+    t0 = now_ns();                                                                              \
+    for (int i = n - 1; i >= 0; i--) {                                                          \
+        T *found = Name##_find(&tree, PROBE(keys[i]));                                          \
+        row.check += (long)(KEY(*found) & 1);                                                   \
+    }                                                                                           \
+    row.ns[1] = now_ns() - t0;                                                                  \
+                                                                                                \
+    Name##Cursor cursor;                                                                        \
+    T *item;                                                                                    \
+    t0 = now_ns();                                                                              \
+    Name##_cursor_init(&cursor, &tree);                                                         \
+    while ((item = Name##_cursor_next(&cursor)) != NULL) {                                      \
+        row.check += (long)(KEY(*item) & 1);                                                    \
+    }                                                                                           \
+    row.ns[2] = now_ns() - t0;                                                                  \
+                                                                                                \
+    T *items = (T*)malloc((size_t)n * sizeof(T));  /* Kept for RELEASE, not timed */            \
+    if (!items) {                                                                               \
+        printf("Memory allocation error!\n");                                                   \
+        exit(1);                                                                                \
+    }                                                                                           \
+    Name##_cursor_init(&cursor, &tree);                                                         \
+    for (int i = 0; (item = Name##_cursor_next(&cursor)) != NULL; i++) {                        \
+        items[i] = *item;                                                                       \
+    }                                                                                           \
+    t0 = now_ns();                                                                              \
+    for (int i = 0; i < n; i++) {                                                               \
+        Name##_delete(&tree, PROBE(keys[i]));                                                   \
+    }                                                                                           \
+    row.ns[3] = now_ns() - t0;                                                                  \
+    row.check += Name##_size(&tree);                                                            \
+    for (int i = 0; i < n; i++) {                                                               \
+        RELEASE(items[i]);                                                                      \
+    }                                                                                           \
+    free(items);                                                                                \
+    slab_destroy(&Name##_pool);                                                                 \
+    return row;                                                                                 \
+}
+
+static Row hand_tree_bench(const int *keys, int n) {
+    Row row = {{0}, {n, n, n, n}, 0};
+    TreeNode *root = NULL;
+    uint64_t t0 = now_ns();
+    for (int i = 0; i < n; i++) {
+        root = avl_insert(root, keys[i]);
+    }
+    row.ns[0] = now_ns() - t0;
+
+    t0 = now_ns();
+    for (int i = n - 1; i >= 0; i--) {
+        row.check += find(root, keys[i])->data & 1;
+    }
+    row.ns[1] = now_ns() - t0;
+
+    TreeCursor cursor;
+    TreeNode *node;
+    t0 = now_ns();
+    cursor_init(&cursor, root);
+    while ((node = cursor_next(&cursor)) != NULL) {
+        row.check += node->data & 1;
+    }
+    cursor_free(&cursor);
+    row.ns[2] = now_ns() - t0;
+
+    t0 = now_ns();
+    for (int i = 0; i < n; i++) {
+        root = avl_delete(root, keys[i]);
+    }
+    row.ns[3] = now_ns() - t0;
+    row.check += node_size(root);
+    slab_destroy(&node_pool);
+    return row;
+}
+
+#define KEY_SELF(x) (x)
+#define KEY_FIELD(x) ((x).key)
+#define KEY_ID(x) ((x).id)
+#define KEY_BOXED(x) ((x)->key)
+#define PROBE_BOXED(k) (&(Pair){(int64_t)(k), 0})
+#define RELEASE_NONE(x) ((void)(x))
+DEFINE_TREE_BENCH(IntTree, int, MAKE_INT, PROBE_INT, KEY_SELF, RELEASE_NONE)
+DEFINE_TREE_BENCH(I64Tree, int64_t, MAKE_I64, PROBE_I64, KEY_SELF, RELEASE_NONE)
+DEFINE_TREE_BENCH(PairTree, Pair, MAKE_PAIR, PROBE_PAIR, KEY_FIELD, RELEASE_NONE)
+DEFINE_TREE_BENCH(RecordTree, Record, MAKE_RECORD, PROBE_RECORD, KEY_ID, RELEASE_NONE)
+DEFINE_TREE_BENCH(BoxedTree, Pair*, box_pair, PROBE_BOXED, KEY_BOXED, free)
+#endif
+
+// --- Check ---
+
+static long check_vector(uint64_t *seed) {
+    long problems = 0;
+    Vector vec;
+    IntVector gen;
+    vector_init(&vec);
+    IntVector_init(&gen);
+    for (int round = 0; round < 20000; round++) {
+        uint64_t r = xorshift64(seed);
+        int value = (int)(r >> 40) % 500;
+        int op = (int)(r % 4);
+        if (op == 0 || vec.size == 0) {
+            vector_push_back(&vec, value);
+            IntVector_push_back(&gen, value);
+        } else if (op == 1) {
+            int index = (int)((r >> 8) % (uint64_t)(vec.size + 1));
+            insert_element(&vec, index, value);
+            IntVector_insert(&gen, index, value);
+        } else if (op == 2) {
+            int index = (int)((r >> 8) % (uint64_t)vec.size);
+            delete_element(&vec, index);
+            IntVector_delete(&gen, index);
+        } else if (find_element(&vec, value) != IntVector_find(&gen, value)) {
+            problems++;
+        }
+    }
+    int values[100];
+    for (int i = 0; i < 100; i++) values[i] = i;
+    vector_append_many(&vec, values, 100);
+    IntVector_append_many(&gen, values, 100);
+    if (vec.size != gen.size || memcmp(vec.data, gen.data, (size_t)vec.size * sizeof(int)) != 0) {
+        problems++;
+    }
+    vector_free(&vec);
+    IntVector_free(&gen);
+
+    PairVector pairs;  // Elements of any size are stored by value and found by key
+    PairVector_init(&pairs);
+    for (int i = 0; i < 1000; i++) PairVector_push_back(&pairs, MAKE_PAIR(i * 7));
+    Pair *at = PairVector_at(&pairs, PairVector_find(&pairs, 700));
+    if (at == NULL || at->value != 2100 || PairVector_find(&pairs, 701) != -1) problems++;
+    PairVector_free(&pairs);
+    return problems;
+}
+
+#ifdef GENERIC_BENCH_LIST
+static long check_structure(uint64_t *seed) {
+    long problems = 0;
+    if (sizeof(IntListNode) != sizeof(Node)) problems++;
+    List list;
+    IntList gen;
+    init_list(&list);
+    IntList_init(&gen);
+    for (int round = 0; round < 20000; round++) {
+        uint64_t r = xorshift64(seed);
+        int value = (int)(r >> 40) % 500;
+        int op = (int)(r % 4);
+        if (op == 0 || list.length == 0) {
+            append(&list, value);
+            IntList_append(&gen, value);
+        } else if (op == 1) {
+            int index = (int)((r >> 8) % (uint64_t)(list.length + 1));
+            insert_at(&list, index, value);
+            IntList_insert_at(&gen, index, value);
+        } else if (op == 2) {
+            int index = (int)((r >> 8) % (uint64_t)list.length);
+            delete_at(&list, index);
+            IntList_delete_at(&gen, index);
+        } else {
+            Node *a = find(&list, value);
+            IntListNode *b = IntList_find(&gen, value);
+            if ((a == NULL) != (b == NULL) || (a != NULL && a->data != b->data)) problems++;
+        }
+    }
+    int values[100];
+    for (int i = 0; i < 100; i++) values[i] = i;
+    append_many(&list, values, 100);
+    IntList_append_many(&gen, values, 100);
+    if (list.length != gen.length) problems++;
+    Node *a = list.head;
+    IntListNode *b = gen.head, *prev = NULL;
+    for (; a != NULL && b != NULL; a = a->next, prev = b, b = b->next) {
+        if (a->data != b->data || b->prev != prev) problems++;
+    }
+    if (a != NULL || b != NULL || gen.tail != prev) problems++;
+    free_list(&list);
+    IntList_free(&gen);
+    slab_destroy(&node_pool);
+    slab_destroy(&IntList_pool);
+    return problems;
+}
+#else
+static void collect_key(TreeNode *node, void *ctx) {
+    Vector *out = (Vector*)ctx;
+    vector_push_back(out, node->data);
+}
+
+static long check_structure(uint64_t *seed) {
+    long problems = 0;
+    if (sizeof(IntTreeNode) != sizeof(TreeNode)) problems++;
+    TreeNode *root = NULL;
+    IntTree gen;
+    IntTree_init(&gen);
+    for (int round = 0; round < 50000; round++) {
+        uint64_t r = xorshift64(seed);
+        int value = (int)(r >> 40) % 3000;
+        if (r % 3 != 0) {
+            int added = find(root, value) == NULL;
+            root = avl_insert(root, value);
+            if (IntTree_insert(&gen, value) != added) problems++;
+        } else {
+            int removed = find(root, value) != NULL;
+            root = avl_delete(root, value);
+            if (IntTree_delete(&gen, value) != removed) problems++;
+        }
+    }
+    if (IntTree_size(&gen) != node_size(root) || tree_height(root) != gen.root->height) problems++;
+
+    // Same keys in the same order, and rank / select agree with the positions
+    Vector keys;
+    vector_init(&keys);
+    inorder_visit(root, collect_key, &keys);
+    IntTreeCursor cursor;
+    IntTree_cursor_init(&cursor, &gen);
+    for (int i = 0; i < keys.size; i++) {
+        int *item = IntTree_cursor_next(&cursor);
+        if (item == NULL || *item != keys.data[i] || *IntTree_select(&gen, i) != keys.data[i] ||
+            IntTree_rank(&gen, keys.data[i]) != i || tree_rank(root, keys.data[i]) != i) {
+            problems++;
+        }
+    }
+    if (IntTree_cursor_next(&cursor) != NULL || *IntTree_min(&gen) != keys.data[0]) problems++;
+    IntTree_cursor_init_at(&cursor, &gen, 1500);  // Starts at the first key >= 1500
+    if (*IntTree_cursor_next(&cursor) != keys.data[tree_rank(root, 1500)]) problems++;
+    vector_free(&keys);
+    free_tree(root);
+    IntTree_free(&gen);
+
+    // Pairs: an equal key replaces the value, find and delete go by key
+    PairTree pairs;
+    PairTree_init(&pairs);
+    for (int i = 0; i < 1000; i++) PairTree_insert(&pairs, MAKE_PAIR(i));
+    if (PairTree_insert(&pairs, (Pair){500, -1}) != 0 || PairTree_find(&pairs, 500)->value != -1) problems++;
+    if (PairTree_delete(&pairs, 500) != 1 || PairTree_find(&pairs, 500) != NULL ||
+        PairTree_delete(&pairs, 500) != 0 || PairTree_size(&pairs) != 999) problems++;
+    PairTree_free(&pairs);
+    slab_destroy(&node_pool);
+    slab_destroy(&IntTree_pool);
+    slab_destroy(&PairTree_pool);
+    return problems;
+}
+#endif
+
+static long run_check(void) {
+    uint64_t seed = 17;
+    long problems = check_vector(&seed) + check_structure(&seed);
+    printf("Bad index (2 errors expected):\n");
+    IntVector vec;
+    IntVector_init(&vec);
+    if (IntVector_at(&vec, 0) != NULL) problems++;
+#ifdef GENERIC_BENCH_LIST
+    IntList list;
+    IntList_init(&list);
+    IntList_insert_at(&list, 1, 5);
+    if (list.length != 0) problems++;
+#else
+    IntTree tree;
+    IntTree_init(&tree);
+    if (IntTree_select(&tree, 0) != NULL) problems++;
+#endif
+    return problems;
+}
+
+// --- Main Function ---
+int main(int argc, char *argv[]) {
+    int n = argc > 1 ? atoi(argv[1]) : 1000000;
+    int repetitions = argc > 2 ? atoi(argv[2]) : 3;
+    if (n < 1) n = 1;
+    if (repetitions < 1) repetitions = 1;
+
+    long problems = run_check();
+    printf("Check: %s (%ld problems)\n", problems == 0 ? "passed" : "FAILED", problems);
+
+    int *keys = (int*)malloc((size_t)n * sizeof(int));
+    if (!keys) {
+        printf("Memory allocation error!\n");
+        return 1;
+    }
+    for (int i = 0; i < n; i++) {
+        keys[i] = key_of_index(i);
+    }
+#ifndef GENERIC_BENCH_LIST
+    boxed_compare = compare_pairs;
+#endif
+
+    // Every structure runs once per repetition, interleaved, so drift hits all rows alike
+    enum { HAND_VECTOR, INT_VECTOR, I64_VECTOR, PAIR_VECTOR, RECORD_VECTOR,
+           HAND_OTHER, INT_OTHER, I64_OTHER, PAIR_OTHER, RECORD_OTHER, BOXED_OTHER, ROWS };
+    Row best[ROWS], run;
+    for (int rep = 0; rep < repetitions; rep++) {
+        run = hand_vector_bench(keys, n);      keep_best(&best[HAND_VECTOR], &run, rep == 0);
+        run = IntVector_bench(keys, n);        keep_best(&best[INT_VECTOR], &run, rep == 0);
+        run = I64Vector_bench(keys, n);        keep_best(&best[I64_VECTOR], &run, rep == 0);
+        run = PairVector_bench(keys, n);       keep_best(&best[PAIR_VECTOR], &run, rep == 0);
+        run = RecordVector_bench(keys, n);     keep_best(&best[RECORD_VECTOR], &run, rep == 0);
+#ifdef GENERIC_BENCH_LIST
+        run = hand_list_bench(keys, n);        keep_best(&best[HAND_OTHER], &run, rep == 0);
+        run = IntList_bench(keys, n);          keep_best(&best[INT_OTHER], &run, rep == 0);
+        run = I64List_bench(keys, n);          keep_best(&best[I64_OTHER], &run, rep == 0);
+        run = PairList_bench(keys, n);         keep_best(&best[PAIR_OTHER], &run, rep == 0);
+        run = RecordList_bench(keys, n);       keep_best(&best[RECORD_OTHER], &run, rep == 0);
+#else
+        run = hand_tree_bench(keys, n);        keep_best(&best[HAND_OTHER], &run, rep == 0);
+        run = IntTree_bench(keys, n);          keep_best(&best[INT_OTHER], &run, rep == 0);
+        run = I64Tree_bench(keys, n);          keep_best(&best[I64_OTHER], &run, rep == 0);
+        run = PairTree_bench(keys, n);         keep_best(&best[PAIR_OTHER], &run, rep == 0);
+        run = RecordTree_bench(keys, n);       keep_best(&best[RECORD_OTHER], &run, rep == 0);
+        run = BoxedTree_bench(keys, n);        keep_best(&best[BOXED_OTHER], &run, rep == 0);
+#endif
+    }
+
+    printf("\n%d elements, ns per operation, best of %d\n", n, repetitions);
+    printf("%-20s %6s %10s %10s %10s %10s %14s\n", "vector", "bytes", "push_back", "append_many",
+           "find", "ins+del", "check");
+    print_row("hand-written int", sizeof(int), &best[HAND_VECTOR]);
+    print_row("int", sizeof(int), &best[INT_VECTOR]);
+    print_row("int64", sizeof(int64_t), &best[I64_VECTOR]);
+    print_row("pair", sizeof(Pair), &best[PAIR_VECTOR]);
+    print_row("record", sizeof(Record), &best[RECORD_VECTOR]);
+#ifdef GENERIC_BENCH_LIST
+    printf("\n%-20s %6s %10s %10s %10s %10s %14s\n", "list", "node", "append", "node_at", "find",
+           "delete_at", "check");
+    print_row("hand-written int", sizeof(Node), &best[HAND_OTHER]);
+    print_row("int", sizeof(IntListNode), &best[INT_OTHER]);
+    print_row("int64", sizeof(I64ListNode), &best[I64_OTHER]);
+    print_row("pair", sizeof(PairListNode), &best[PAIR_OTHER]);
+    print_row("record", sizeof(RecordListNode), &best[RECORD_OTHER]);
+#else
+    printf("\n%-20s %6s %10s %10s %10s %10s %14s\n", "tree", "node", "insert", "find", "scan",
+           "delete", "check");
+    print_row("hand-written int", sizeof(TreeNode), &best[HAND_OTHER]);
+    print_row("int", sizeof(IntTreeNode), &best[INT_OTHER]);
+    print_row("int64", sizeof(I64TreeNode), &best[I64_OTHER]);
+    print_row("pair", sizeof(PairTreeNode), &best[PAIR_OTHER]);
+    print_row("record", sizeof(RecordTreeNode), &best[RECORD_OTHER]);
+    print_row("boxed pair", sizeof(BoxedTreeNode) + sizeof(Pair), &best[BOXED_OTHER]);
+#endif
+
+    free(keys);
+    return problems == 0 ? 0 : 1;
+}
@@ -0,0 +1,369 @@
+// This C program checks and benchmarks the hash index (common/hash_index.h) on the dynamic
+// array (array/arrays.c) and the doubly linked list (DDL/DDL_first.c), or on the singly
+// linked list (SLL/SLL_FIRTS.c) when built with -DHASH_BENCH_SLL: the two list programs
+// cannot be included together, their functions share names.
+//
+// Check: the table alone must agree with a plain count array through growth, erases and
+// in-place rehashes. Then random appends, inserts, deletes and updates, over few distinct
+// values (so most values are duplicated), go through the hashed_ functions; after every
+// step hashed find must return exactly what the plain O(n) find returns: the first match.
+//
+// Benchmark, for n distinct random values:
+//   find hit / miss:    hashed find against the plain find (the plain find on far fewer
+//                       lookups, it is O(n) each)
+//   attach:             building the index over the existing structure
+//   append:             hashed append / push_back against the plain one
+//   update:             hashed update at a random index against the plain one
+//   insert + delete:    at random indexes, hashed against plain
+//
+// Build:  gcc -O2 hash_bench.c -o hash_bench   (add -DHASH_BENCH_SLL for the singly linked list)
+// Usage:  ./hash_bench [n] [lookups]   (defaults: n = 1000000, lookups = 4000000)
+
+#define _POSIX_C_SOURCE 200809L
+#define DS_NO_MAIN
+
+// --- Includes Section ---
+#ifdef HASH_BENCH_SLL
+#include "../SLL/SLL_FIRTS.c"
+#define LIST_NAME "sll"
+#else
+#include "../DDL/DDL_first.c"
+#define LIST_NAME "dll"
+#endif
+#include "../array/arrays.c"
+#include "../common/timer.h"
+
+#define PLAIN_FINDS 200  // Lookups timed on the O(n) finds
+#define MIDDLE_OPS 200   // Inserts / deletes / updates at random indexes
+
+// Returns the node at index by walking from the head (both lists have head and next).
+static Node* walk_to(const List *list, int index) {
+    Node *node = list->head;
+    for (int i = 0; i < index; i++) {
+        node = node->next;
+    }
+    return node;
+}
+
+// --- Check ---
+
+static long check_table(uint64_t *seed) {
+    long problems = 0;
+    enum { KEYS = 5000 };
+    static int counts[KEYS];
+    HashIndex index;
+    hash_index_init(&index);
+    for (int round = 0; round < 400000; round++) {
+        uint64_t r = xorshift64(seed);
+        // Phases that fill and drain the table, so it grows and also fills with tombstones
+        int key = (int)((r >> 20) % (uint64_t)((round / 50000) % 2 == 0 ? KEYS : 300)) - KEYS / 2;
+        int slot = key + KEYS / 2;
+        if (r % 3 != 0) {
+            HashEntry *entry = hash_index_upsert(&index, key);
+            if (entry->count != counts[slot]) problems++;
+            entry->count++;
+            counts[slot]++;
+        } else {
+            HashEntry *entry = hash_index_lookup(&index, key);
+            if ((entry == NULL) != (counts[slot] == 0)) {
+                problems++;
+            } else if (entry != NULL) {
+                if (entry->count != counts[slot]) problems++;
+                hash_index_erase(&index, entry);
+                counts[slot] = 0;
+            }
+        }
+    }
+    size_t live = 0;
+    for (int k = 0; k < KEYS; k++) {
+        HashEntry *entry = hash_index_lookup(&index, k - KEYS / 2);
+        live += counts[k] != 0;
+        if ((entry == NULL) != (counts[k] == 0) || (entry != NULL && entry->count != counts[k])) problems++;
+    }
+    if (live != index.size) problems++;
+    hash_index_free(&index);
+    return problems;
+}
+
+static long compare_list(const HashedList *hl, int values) {
+    long problems = 0;
+    for (int v = 0; v < values; v++) {
+        if (hashed_find(hl, v) != find(&hl->list, v)) problems++;
+    }
+    return problems;
+}
+
+static long compare_vector(const HashedVector *hv, int values) {
+    long problems = 0;
+    for (int v = 0; v < values; v++) {
+        if (hashed_find_element(hv, v) != find_element(&hv->vec, v)) problems++;
+    }
+    return problems;
+}
+
+static long check_structures(uint64_t *seed) {
+    long problems = 0;
+    enum { VALUES = 40 };  // Few values, so nearly every one is duplicated
+    HashedList hl;
+    HashedVector hv;
+    List start;
+    Vector vstart;
+    init_list(&start);
+    vector_init(&vstart);
+    for (int i = 0; i < 100; i++) {
+        int value = (int)(xorshift64(seed) % VALUES);
+        append(&start, value);
+        vector_push_back(&vstart, value);
+    }
+    hashed_list_init(&hl);
+    hashed_vector_init(&hv);
+    hashed_list_attach(&hl, &start);
+    hashed_vector_attach(&hv, &vstart);
+    problems += compare_list(&hl, VALUES) + compare_vector(&hv, VALUES);
+
+    for (int round = 0; round < 20000; round++) {
+        uint64_t r = xorshift64(seed);
+        int value = (int)((r >> 32) % VALUES);
+        int op = (int)(r % 4);
+        int length = hl.list.length;
+        if (op == 0 || length == 0) {
+            hashed_append(&hl, value);
+            hashed_push_back(&hv, value);
+        } else if (op == 1 && length < 400) {
+            int index = (int)((r >> 8) % (uint64_t)(length + 1));
+            hashed_insert_at(&hl, index, value);
+            hashed_insert_element(&hv, index, value);
+        } else if (op == 2 || op == 1) {
+            int index = (int)((r >> 8) % (uint64_t)length);
+            hashed_delete_at(&hl, index);
+            hashed_delete_element(&hv, index);
+        } else {
+            int index = (int)((r >> 8) % (uint64_t)length);
+            hashed_update_at(&hl, index, value);
+            hashed_update_element(&hv, index, value);
+        }
+        // The same first match as the O(n) finds, for the touched value and one other
+        int other = (int)((r >> 48) % VALUES);
+        if (hashed_find(&hl, value) != find(&hl.list, value)) problems++;
+        if (hashed_find(&hl, other) != find(&hl.list, other)) problems++;
+        if (hashed_find_element(&hv, value) != find_element(&hv.vec, value)) problems++;
+        if (hashed_find_element(&hv, other) != find_element(&hv.vec, other)) problems++;
+    }
+    problems += compare_list(&hl, VALUES) + compare_vector(&hv, VALUES);
+
+    // The list and the vector went through the same operations
+    if (hl.list.length != hv.vec.size) problems++;
+    Node *node = hl.list.head;
+    for (int i = 0; i < hv.vec.size && node != NULL; i++, node = node->next) {
+        if (node->data != hv.vec.data[i]) problems++;
+    }
+    hashed_list_detach(&hl, &start);
+    hashed_vector_detach(&hv, &vstart);
+    free_list(&start);
+    vector_free(&vstart);
+    slab_destroy(&node_pool);
+    return problems;
+}
+
+static long run_check(void) {
+    uint64_t seed = 23;
+    long problems = check_table(&seed) + check_structures(&seed);
+    printf("Bad index (3 errors expected):\n");
+    HashedVector hv;
+    HashedList hl;
+    hashed_vector_init(&hv);
+    hashed_list_init(&hl);
+    hashed_insert_element(&hv, 1, 5);
+    hashed_update_at(&hl, 0, 5);
+    hashed_delete_at(&hl, 0);
+    if (hv.vec.size != 0 || hl.list.length != 0 || hv.index.size != 0 || hl.index.size != 0) problems++;
+    return problems;
+}
+
+// --- Benchmark ---
+
+static void print_row(const char *structure, const char *operation, const char *method,
+                      uint64_t ns, long ops, long check) {
+    printf("%-7s %-16s %-8s %12.1f %12.2f %14ld\n", structure, operation, method,
+           (double)ns / (double)ops, (double)ops / ((double)ns / 1e3), check);
+}
+
+// Lookup keys: present values in random order, or values that are absent (odd, where all
+// stored values are even).
+static int* make_probes(const int *values, int n, int count, int hit) {
+    int *probes = (int*)malloc((size_t)count * sizeof(int));
+    if (!probes) {
+        printf("Memory allocation error!\n");
+        exit(1);
+    }
+    uint64_t seed = hit ? 31 : 37;
+    for (int i = 0; i < count; i++) {
+        int value = values[xorshift64(&seed) % (uint64_t)n];
+        probes[i] = hit ? value : value + 1;
+    }
+    return probes;
+}
+
+static void bench_vector(const int *values, int n, const int *hits, const int *misses, int lookups) {
+    Vector vec;
+    HashedVector hv;
+    vector_init(&vec);
+    hashed_vector_init(&hv);
+
+    uint64_t t0 = now_ns();
+    for (int i = 0; i < n; i++) vector_push_back(&vec, values[i]);
+    print_row("array", "push_back", "plain", now_ns() - t0, n, vec.size);
+    t0 = now_ns();
+    for (int i = 0; i < n; i++) hashed_push_back(&hv, values[i]);
+    print_row("array", "push_back", "hashed", now_ns() - t0, n, (long)hv.index.size);
+
+    Vector copy;
+    vector_init(&copy);
+    vector_append_many(&copy, vec.data, vec.size);
+    HashedVector attached;
+    hashed_vector_init(&attached);
+    t0 = now_ns();
+    hashed_vector_attach(&attached, &copy);
+    print_row("array", "attach", "hashed", now_ns() - t0, n, (long)attached.index.size);
+    hashed_vector_free(&attached);
+
+    const int *probes[2] = {hits, misses};
+    const char *names[2] = {"find hit", "find miss"};
+    for (int p = 0; p < 2; p++) {
+        long check = 0;
+        t0 = now_ns();
+        for (int i = 0; i < PLAIN_FINDS; i++) check += find_element(&vec, probes[p][i]);
+        print_row("array", names[p], "plain", now_ns() - t0, PLAIN_FINDS, check);
+        check = 0;
+        t0 = now_ns();
+        for (int i = 0; i < lookups; i++) check += hashed_find_element(&hv, probes[p][i]);
+        print_row("array", names[p], "hashed", now_ns() - t0, lookups, check);
+    }
+
+    uint64_t seed = 41;
+    t0 = now_ns();
+    for (int i = 0; i < MIDDLE_OPS; i++) update_element(&vec, (int)(xorshift64(&seed) % (uint64_t)n), values[i] + 2);
+    print_row("array", "update", "plain", now_ns() - t0, MIDDLE_OPS, vec.size);
+    seed = 41;
+    t0 = now_ns();
+    for (int i = 0; i < MIDDLE_OPS; i++) hashed_update_element(&hv, (int)(xorshift64(&seed) % (uint64_t)n), values[i] + 2);
+    print_row("array", "update", "hashed", now_ns() - t0, MIDDLE_OPS, (long)hv.index.size);
+
+    seed = 43;
+    t0 = now_ns();
+    for (int i = 0; i < MIDDLE_OPS; i++) {
+        insert_element(&vec, (int)(xorshift64(&seed) % (uint64_t)n), i * 2);
+        delete_element(&vec, (int)(xorshift64(&seed) % (uint64_t)n));
+    }
+    print_row("array", "insert + delete", "plain", now_ns() - t0, 2 * MIDDLE_OPS, vec.size);
+    seed = 43;
+    t0 = now_ns();
+    for (int i = 0; i < MIDDLE_OPS; i++) {
+        hashed_insert_element(&hv, (int)(xorshift64(&seed) % (uint64_t)n), i * 2);
+        hashed_delete_element(&hv, (int)(xorshift64(&seed) % (uint64_t)n));
+    }
+    print_row("array", "insert + delete", "hashed", now_ns() - t0, 2 * MIDDLE_OPS, (long)hv.index.size);
+    vector_free(&vec);
+    hashed_vector_free(&hv);
+}
+
+static void bench_list(const int *values, int n, const int *hits, const int *misses, int lookups) {
+    List list;
+    HashedList hl;
+    init_list(&list);
+    hashed_list_init(&hl);
+
+    uint64_t t0 = now_ns();
+    for (int i = 0; i < n; i++) append(&list, values[i]);
+    print_row(LIST_NAME, "append", "plain", now_ns() - t0, n, list.length);
+    t0 = now_ns();
+    for (int i = 0; i < n; i++) hashed_append(&hl, values[i]);
+    print_row(LIST_NAME, "append", "hashed", now_ns() - t0, n, (long)hl.index.size);
+
+    List copy;
+    init_list(&copy);
+    append_many(&copy, values, n);
+    HashedList attached;
+    hashed_list_init(&attached);
+    t0 = now_ns();
+    hashed_list_attach(&attached, &copy);
+    print_row(LIST_NAME, "attach", "hashed", now_ns() - t0, n, (long)attached.index.size);
+    hashed_list_free(&attached);
+
+    const int *probes[2] = {hits, misses};
+    const char *names[2] = {"find hit", "find miss"};
+    for (int p = 0; p < 2; p++) {
+        long check = 0;
+        t0 = now_ns();
+        for (int i = 0; i < PLAIN_FINDS; i++) check += find(&list, probes[p][i]) != NULL;
+        print_row(LIST_NAME, names[p], "plain", now_ns() - t0, PLAIN_FINDS, check);
+        check = 0;
+        t0 = now_ns();
+        for (int i = 0; i < lookups; i++) check += hashed_find(&hl, probes[p][i]) != NULL;
+        print_row(LIST_NAME, names[p], "hashed", now_ns() - t0, lookups, check);
+    }
+
+    uint64_t seed = 41;
+    t0 = now_ns();
+    for (int i = 0; i < MIDDLE_OPS; i++) update_at(&list, (int)(xorshift64(&seed) % (uint64_t)n), values[i] + 2);
+    print_row(LIST_NAME, "update", "plain", now_ns() - t0, MIDDLE_OPS, list.length);
+    seed = 41;
+    t0 = now_ns();
+    for (int i = 0; i < MIDDLE_OPS; i++) hashed_update_at(&hl, (int)(xorshift64(&seed) % (uint64_t)n), values[i] + 2);
+    print_row(LIST_NAME, "update", "hashed", now_ns() - t0, MIDDLE_OPS, (long)hl.index.size);
+
+    seed = 43;
+    t0 = now_ns();
+    for (int i = 0; i < MIDDLE_OPS; i++) {
+        insert_at(&list, (int)(xorshift64(&seed) % (uint64_t)n), i * 2);
+        delete_at(&list, (int)(xorshift64(&seed) % (uint64_t)n));
+    }
+    print_row(LIST_NAME, "insert + delete", "plain", now_ns() - t0, 2 * MIDDLE_OPS, list.length);
+    seed = 43;
+    t0 = now_ns();
+    for (int i = 0; i < MIDDLE_OPS; i++) {
+        hashed_insert_at(&hl, (int)(xorshift64(&seed) % (uint64_t)n), i * 2);
+        hashed_delete_at(&hl, (int)(xorshift64(&seed) % (uint64_t)n));
+    }
+    print_row(LIST_NAME, "insert + delete", "hashed", now_ns() - t0, 2 * MIDDLE_OPS, (long)hl.index.size);
+    if (walk_to(&hl.list, n / 2)->data != walk_to(&list, n / 2)->data) {
+        printf("Error: The hashed and the plain list differ.\n");
+    }
+    free_list(&list);
+    hashed_list_free(&hl);
+    slab_destroy(&node_pool);
+}
+
+// --- Main Function ---
+int main(int argc, char *argv[]) {
+    int n = argc > 1 ? atoi(argv[1]) : 1000000;
+    int lookups = argc > 2 ? atoi(argv[2]) : 4000000;
+    if (n < 1) n = 1;
+    if (lookups < PLAIN_FINDS) lookups = PLAIN_FINDS;
+
+    long problems = run_check();
+    printf("Check: %s (%ld problems)\n", problems == 0 ? "passed" : "FAILED", problems);
+
+    // Distinct even values in random order (an odd multiplier is a bijection on 31 bits):
+    // an odd probe always misses
+    int *values = (int*)malloc((size_t)n * sizeof(int));
+    if (!values) {
+        printf("Memory allocation error!\n");
+        return 1;
+    }
+    for (int i = 0; i < n; i++) {
+        values[i] = (int)((((uint32_t)i * 2654435761u) & 0x7FFFFFFFu) << 1);
+    }
+    int *hits = make_probes(values, n, lookups, 1);
+    int *misses = make_probes(values, n, lookups, 0);
+
+    printf("\n%d distinct values, %d hashed lookups (check = sum of results or index size)\n", n, lookups);
+    printf("%-7s %-16s %-8s %12s %12s %14s\n", "struct", "operation", "method", "ns/op", "Mops/s", "check");
+    bench_vector(values, n, hits, misses, lookups);
+    bench_list(values, n, hits, misses, lookups);
+
+    free(values);
+    free(hits);
+    free(misses);
+    return problems == 0 ? 0 : 1;
+}
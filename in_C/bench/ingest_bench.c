@@ -0,0 +1,297 @@
+// This C program checks and benchmarks the streaming loader (common/ingest.h) and the
+// batched inserts of the dynamic array (array/arrays.c) and the doubly linked list
+// (DDL/DDL_first.c).
+//
+// Check: a file of random ints (INT_MIN and INT_MAX included) written with mixed separators,
+// CRLF line ends, '+' signs, leading zeros and no final newline must load back exactly,
+// as text and as binary, into the vector and the list. The file is several times the
+// 1 MiB read buffer, so numbers are split across reads. Bad input (letters, out of range
+// values, a lone sign, a truncated binary file, a missing file) must fail. Random
+// append_many / insert_many / insert_elements calls must match element-by-element inserts.
+//
+// Benchmark, for a file of n ints (in the page cache, so the "read only" row is the
+// bandwidth of the copy out of the kernel; a cold disk caps every row at the disk's speed):
+//   read only:          read(2) of the whole file into the 1 MiB buffer, no parsing
+//   fscanf + push_back: the old way, one fscanf("%d") and one push per element
+//   parse only:         ingest_read into a reused batch, nothing stored
+//   ingest_array:       parse straight into the vector's buffer
+//   ingest_list:        parse into batches, append_many into the list
+//
+// Build:  gcc -O2 ingest_bench.c -o ingest_bench
+// Usage:  ./ingest_bench [n] [file]   (defaults: n = 20000000, file = bench.ints)
+
+#define _POSIX_C_SOURCE 200809L
+#define DS_NO_MAIN
+
+// --- Includes Section ---
+#include "../DDL/DDL_first.c"
+#include "../array/arrays.c"
+#include "../common/timer.h"
+
+// --- File Generation ---
+
+// Writes values[0..n) to path, as text with the separator style picked by `messy`
+// (0: one number per line; 1: mixed separators, CRLF, '+' signs, leading zeros), or as
+// raw binary. Not timed.
+static void write_file(const char *path, const int *values, int n, int format, int messy) {
+    FILE *file = fopen(path, "wb");
+    if (!file) {
+        printf("Error: Cannot create %s.\n", path);
+        exit(1);
+    }
+    if (format == INGEST_BINARY) {
+        fwrite(values, sizeof(int), (size_t)n, file);
+        fclose(file);
+        return;
+    }
+    static const char *separators[] = {" ", "\n", ", ", "\t", "\r\n", "  ,\n"};
+    uint64_t seed = 5;
+    for (int i = 0; i < n; i++) {
+        uint64_t r = xorshift64(&seed);
+        if (!messy) {
+            fprintf(file, "%d\n", values[i]);
+            continue;
+        }
+        if (values[i] >= 0 && r % 7 == 0) {
+            fputc('+', file);
+        }
+        if (values[i] >= 0 && values[i] < 1000 && r % 5 == 0) {
+            fprintf(file, "%04d", values[i]);  // Leading zeros, still at most 10 digits
+        } else {
+            fprintf(file, "%d", values[i]);
+        }
+        if (i < n - 1) {
+            fputs(separators[(r >> 8) % 6], file);  // No separator after the last one
+        }
+    }
+    fclose(file);
+}
+
+static void write_text(const char *path, const char *text) {
+    FILE *file = fopen(path, "wb");
+    if (!file) {
+        printf("Error: Cannot create %s.\n", path);
+        exit(1);
+    }
+    fputs(text, file);
+    fclose(file);
+}
+
+// --- Check ---
+
+static int list_matches(const List *list, const int *values, int n) {
+    if (list->length != n) return 0;
+    Node *prev = NULL;
+    int i = 0;
+    for (Node *node = list->head; node != NULL; prev = node, node = node->next, i++) {
+        if (i >= n || node->data != values[i] || node->prev != prev) return 0;
+    }
+    return i == n && list->tail == prev;
+}
+
+static int vector_matches(const Vector *vec, const int *values, int n) {
+    return vec->size == n && (n == 0 || memcmp(vec->data, values, (size_t)n * sizeof(int)) == 0);
+}
+
+static long check_load(const char *path, const int *values, int n, int format, int messy) {
+    long problems = 0;
+    write_file(path, values, n, format, messy);
+    Vector vec;
+    List list;
+    vector_init(&vec);
+    init_list(&list);
+    if (ingest_array(&vec, path, format) != n || !vector_matches(&vec, values, n)) problems++;
+    if (ingest_list(&list, path, format) != n || !list_matches(&list, values, n)) problems++;
+    vector_free(&vec);
+    free_list(&list);
+    return problems;
+}
+
+static long run_check(const char *path) {
+    long problems = 0;
+    uint64_t seed = 11;
+    int n = 500000;  // About 5 MB of text, five times the read buffer
+    int *values = (int*)malloc((size_t)n * sizeof(int));
+    if (!values) {
+        printf("Memory allocation error!\n");
+        exit(1);
+    }
+    for (int i = 0; i < n; i++) {
+        uint64_t r = xorshift64(&seed);
+        values[i] = r % 3 == 0 ? (int)(r >> 40) % 1000 : (int)(uint32_t)(r >> 16);
+    }
+    values[0] = INT32_MIN;
+    values[1] = INT32_MAX;
+    values[n - 1] = INT32_MIN;  // The last number runs into the end of the file
+    static const int sizes[] = {0, 1, 2, 1000};
+    for (int s = 0; s < 4; s++) {
+        for (int format = INGEST_TEXT; format <= INGEST_BINARY; format++) {
+            problems += check_load(path, values, sizes[s], format, 1);
+        }
+    }
+    problems += check_load(path, values, n, INGEST_TEXT, 0);
+    problems += check_load(path, values, n, INGEST_TEXT, 1);
+    problems += check_load(path, values, n, INGEST_BINARY, 0);
+
+    // Bad input: each load must fail with an error message
+    static const char *bad[] = {"1 2 x3", "1 2.5", "2147483648", "-2147483649", "1 - 2",
+                                "00000000001", "12,a"};
+    printf("Bad input (9 errors expected):\n");
+    for (int b = 0; b < 7; b++) {
+        write_text(path, bad[b]);
+        Vector vec;
+        vector_init(&vec);
+        if (ingest_array(&vec, path, INGEST_TEXT) != -1) problems++;
+        vector_free(&vec);
+    }
+    write_text(path, "12345");  // 5 bytes: one int and a fragment
+    Vector vec;
+    vector_init(&vec);
+    if (ingest_array(&vec, path, INGEST_BINARY) != -1) problems++;
+    remove(path);
+    if (ingest_array(&vec, path, INGEST_TEXT) != -1) problems++;  // Missing file
+    vector_free(&vec);
+
+    // Batched inserts against one insert per element
+    List batched, single;
+    Vector vbatched, vsingle;
+    init_list(&batched);
+    init_list(&single);
+    vector_init(&vbatched);
+    vector_init(&vsingle);
+    for (int round = 0; round < 300; round++) {
+        int count = (int)(xorshift64(&seed) % 20);
+        int index = (int)(xorshift64(&seed) % (uint64_t)(single.length + 1));
+        const int *batch = &values[xorshift64(&seed) % (uint64_t)(n - 20)];
+        if (round % 3 == 0) {
+            append_many(&batched, batch, count);
+            vector_append_many(&vbatched, batch, count);
+            index = single.length;
+        } else {
+            insert_many(&batched, index, batch, count);
+            insert_elements(&vbatched, index, batch, count);
+        }
+        for (int i = 0; i < count; i++) {
+            insert_at(&single, index + i, batch[i]);
+            insert_element(&vsingle, index + i, batch[i]);
+        }
+    }
+    if (!vector_matches(&vbatched, vsingle.data, vsingle.size)) problems++;
+    if (!list_matches(&batched, vsingle.data, vsingle.size)) problems++;
+    if (!list_matches(&single, vsingle.data, vsingle.size)) problems++;
+    free_list(&batched);
+    free_list(&single);
+    vector_free(&vbatched);
+    vector_free(&vsingle);
+    free(values);
+    slab_destroy(&node_pool);
+    return problems;
+}
+
+// --- Benchmark ---
+
+static void print_row(const char *format, const char *method, uint64_t ns, uint64_t bytes,
+                      long count, long check) {
+    double seconds = (double)ns / 1e9;
+    printf("%-7s %-20s %10.1f %10.0f %10.1f %10ld %14ld\n", format, method, (double)ns / 1e6,
+           (double)bytes / 1e6 / seconds, (double)count / 1e6 / seconds, count, check);
+}
+
+static uint64_t file_bytes(const char *path) {
+    struct stat st;
+    return stat(path, &st) == 0 ? (uint64_t)st.st_size : 0;
+}
+
+static void bench_format(const char *path, const char *name, int format) {
+    uint64_t bytes = file_bytes(path);
+
+    // Read only: the bandwidth the parser is compared against
+    IntReader reader;
+    uint64_t t0 = now_ns();
+    ingest_open(&reader, path, format);
+    long total = 0;
+    do {
+        reader.start = reader.end;  // Drop what was read
+        ingest_refill(&reader);
+        total += (long)reader.end;
+    } while (!reader.eof);
+    ingest_close(&reader);
+    print_row(name, "read only", now_ns() - t0, bytes, 0, total);
+
+    // The old way
+    if (format == INGEST_TEXT) {
+        Vector vec;
+        vector_init(&vec);
+        t0 = now_ns();
+        FILE *file = fopen(path, "r");
+        int value;
+        while (fscanf(file, "%d", &value) == 1) {
+            vector_push_back(&vec, value);
+        }
+        fclose(file);
+        print_row(name, "fscanf + push_back", now_ns() - t0, bytes, vec.size, (long)vec.data[vec.size - 1]);
+        vector_free(&vec);
+    }
+
+    // Parse only
+    static int batch[INGEST_BATCH];
+    t0 = now_ns();
+    ingest_open(&reader, path, format);
+    long count = 0, sum = 0;
+    int got;
+    while ((got = ingest_read(&reader, batch, INGEST_BATCH)) > 0) {
+        count += got;
+        sum += batch[got - 1];
+    }
+    ingest_close(&reader);
+    print_row(name, "parse only", now_ns() - t0, bytes, count, sum);
+
+    // Into the structures
+    Vector vec;
+    vector_init(&vec);
+    t0 = now_ns();
+    ingest_array(&vec, path, format);
+    print_row(name, "ingest_array", now_ns() - t0, bytes, vec.size, (long)vec.data[vec.size - 1]);
+    vector_free(&vec);
+
+    List list;
+    init_list(&list);
+    t0 = now_ns();
+    ingest_list(&list, path, format);
+    print_row(name, "ingest_list", now_ns() - t0, bytes, list.length, (long)list.tail->data);
+    free_list(&list);
+    slab_destroy(&node_pool);
+}
+
+// --- Main Function ---
+int main(int argc, char *argv[]) {
+    int n = argc > 1 ? atoi(argv[1]) : 20000000;
+    const char *path = argc > 2 ? argv[2] : "bench.ints";
+    if (n < 1) n = 1;
+
+    long problems = run_check(path);
+    printf("Check: %s (%ld problems)\n", problems == 0 ? "passed" : "FAILED", problems);
+
+    // Random ints over the whole range, about 11 bytes each as text
+    int *values = (int*)malloc((size_t)n * sizeof(int));
+    if (!values) {
+        printf("Memory allocation error!\n");
+        return 1;
+    }
+    uint64_t seed = 8;
+    for (int i = 0; i < n; i++) {
+        values[i] = (int)(uint32_t)xorshift64(&seed);
+    }
+
+    printf("\n%d ints (check = bytes read, or sum / last element)\n", n);
+    printf("%-7s %-20s %10s %10s %10s %10s %14s\n", "format", "method", "ms", "MB/s", "Mints/s",
+           "count", "check");
+    write_file(path, values, n, INGEST_TEXT, 0);
+    bench_format(path, "text", INGEST_TEXT);
+    write_file(path, values, n, INGEST_BINARY, 0);
+    bench_format(path, "binary", INGEST_BINARY);
+
+    remove(path);
+    free(values);
+    return problems == 0 ? 0 : 1;
+}
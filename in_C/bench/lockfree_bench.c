@@ -0,0 +1,327 @@
+// This C program stress-tests the lock-free list from SLL/SLL_lockfree.c and compares its
+// throughput with the list from SLL/SLL_FIRTS.c guarded by one global mutex.
+//
+// Stress test: threads hammer a small key range with random insert / remove / contains.
+// Every thread counts its successful inserts and removes per key, and at the end a key
+// must be in the list exactly when it was inserted once more than it was removed. Keys
+// owned by one thread are also checked after every operation (insert -> present,
+// remove -> absent). The final list must be sorted with no marked nodes left.
+//
+// Benchmark: for 1, 2, 4, ... threads, each thread runs a random mix for a fixed time
+// (default 10% insert, 10% remove, 80% contains) and the total Mops/s are reported.
+//
+// Build:  gcc -O2 -pthread lockfree_bench.c -o lockfree_bench
+// Usage:  ./lockfree_bench [max_threads] [key_range] [update_percent] [ms_per_run]
+//         (defaults: 8, 1024, 20, 300)
+
+#define _POSIX_C_SOURCE 200809L
+#define DS_NO_MAIN
+
+// --- Includes Section ---
+#include "../SLL/SLL_FIRTS.c"
+#include "../SLL/SLL_lockfree.c"
+#include "../common/timer.h"
+#include <unistd.h>  // sysconf
+
+// --- Mutex-Guarded List ---
+// The current singly linked list kept sorted, with one lock around every operation.
+
+static List locked_list;
+static pthread_mutex_t list_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static int locked_insert(int key) {
+    pthread_mutex_lock(&list_lock);
+    Node *prev = NULL;
+    Node *curr = locked_list.head;
+    while (curr != NULL && curr->data < key) {
+        prev = curr;
+        curr = curr->next;
+    }
+    int inserted = curr == NULL || curr->data != key;
+    if (inserted) {
+        Node *node = create_node(key);
+        node->next = curr;
+        if (prev == NULL) {
+            locked_list.head = node;
+        } else {
+            prev->next = node;
+        }
+        if (curr == NULL) {
+            locked_list.tail = node;
+        }
+        locked_list.length++;
+    }
+    pthread_mutex_unlock(&list_lock);
+    return inserted;
+}
+
+static int locked_remove(int key) {
+    pthread_mutex_lock(&list_lock);
+    Node *prev = NULL;
+    Node *curr = locked_list.head;
+    while (curr != NULL && curr->data < key) {
+        prev = curr;
+        curr = curr->next;
+    }
+    int removed = curr != NULL && curr->data == key;
+    if (removed) {
+        if (prev == NULL) {
+            locked_list.head = curr->next;
+        } else {
+            prev->next = curr->next;
+        }
+        if (locked_list.tail == curr) {
+            locked_list.tail = prev;
+        }
+        slab_free(&node_pool, curr);
+        locked_list.length--;
+    }
+    pthread_mutex_unlock(&list_lock);
+    return removed;
+}
+
+static int locked_contains(int key) {
+    pthread_mutex_lock(&list_lock);
+    Node *curr = locked_list.head;
+    while (curr != NULL && curr->data < key) {
+        curr = curr->next;
+    }
+    int found = curr != NULL && curr->data == key;
+    pthread_mutex_unlock(&list_lock);
+    return found;
+}
+
+// --- Stress Test ---
+
+#define STRESS_KEYS 64
+#define STRESS_OPS 200000
+
+typedef struct StressArgs {
+    LfList *list;
+    int id;
+    int threads;
+    long inserts[STRESS_KEYS];     // Successful inserts per key
+    long removes[STRESS_KEYS];     // Successful removes per key
+    long errors;                   // Owned-key checks that failed
+} StressArgs;
+
+static void* stress_worker(void *arg) {
+    StressArgs *args = (StressArgs*)arg;
+    LfThread *self = lf_register(args->list);
+    uint64_t seed = 1234 + (uint64_t)args->id;
+    for (int i = 0; i < STRESS_OPS; i++) {
+        uint64_t r = xorshift64(&seed);
+        int key = (int)(r % STRESS_KEYS);
+        int op = (int)((r >> 32) % 3);
+        // Keys below STRESS_KEYS / 2 are shared; above, key % threads picks the owner
+        int owned = key >= STRESS_KEYS / 2 && key % args->threads == args->id;
+        if (key >= STRESS_KEYS / 2 && !owned) {
+            op = 2;  // Only look at other threads' keys
+        }
+        if (op == 0) {
+            args->inserts[key] += lf_insert(args->list, self, key);
+            if (owned && !lf_contains(args->list, self, key)) {
+                args->errors++;
+            }
+        } else if (op == 1) {
+            args->removes[key] += lf_remove(args->list, self, key);
+            if (owned && lf_contains(args->list, self, key)) {
+                args->errors++;
+            }
+        } else {
+            lf_contains(args->list, self, key);
+        }
+    }
+    return NULL;
+}
+
+// Returns the number of problems found (0 means the run passed).
+static long run_stress(int threads) {
+    LfList *list = (LfList*)aligned_alloc(64, sizeof(LfList));
+    StressArgs *args = (StressArgs*)calloc((size_t)threads, sizeof(StressArgs));
+    pthread_t *ids = (pthread_t*)malloc((size_t)threads * sizeof(pthread_t));
+    if (!list || !args || !ids) {
+        printf("Memory allocation error!\n");
+        exit(1);
+    }
+    lf_init(list);
+    for (int i = 0; i < threads; i++) {
+        args[i].list = list;
+        args[i].id = i;
+        args[i].threads = threads;
+        pthread_create(&ids[i], NULL, stress_worker, &args[i]);
+    }
+    for (int i = 0; i < threads; i++) {
+        pthread_join(ids[i], NULL);
+    }
+
+    long problems = 0;
+    for (int i = 0; i < threads; i++) {
+        problems += args[i].errors;
+    }
+
+    // Final contents: sorted, no marks, and matching the success counts
+    int present[STRESS_KEYS] = {0};
+    int last = -1;
+    for (LfNode *curr = lf_ptr(atomic_load(&list->head.next)); curr != NULL;
+         curr = lf_ptr(atomic_load(&curr->next))) {
+        if (lf_marked(atomic_load(&curr->next)) || curr->key <= last) {
+            problems++;
+        }
+        if (curr->key >= 0 && curr->key < STRESS_KEYS) {
+            present[curr->key] = 1;
+        }
+        last = curr->key;
+    }
+    for (int key = 0; key < STRESS_KEYS; key++) {
+        long net = 0;
+        for (int i = 0; i < threads; i++) {
+            net += args[i].inserts[key] - args[i].removes[key];
+        }
+        if (net != present[key]) {
+            problems++;
+        }
+    }
+
+    lf_destroy(list);
+    free(list);
+    free(args);
+    free(ids);
+    return problems;
+}
+
+// --- Throughput Benchmark ---
+
+typedef struct BenchArgs {
+    LfList *list;                  // NULL runs the mutex-guarded list
+    int id;
+    int key_range;
+    int update_percent;
+    atomic_int *stop;
+    long ops;
+} BenchArgs;
+
+static void* bench_worker(void *arg) {
+    BenchArgs *args = (BenchArgs*)arg;
+    LfThread *self = args->list != NULL ? lf_register(args->list) : NULL;
+    uint64_t seed = 99 + (uint64_t)args->id;
+    long ops = 0;
+    while (!atomic_load_explicit(args->stop, memory_order_relaxed)) {
+        for (int i = 0; i < 64; i++, ops++) {
+            uint64_t r = xorshift64(&seed);
+            int key = (int)(r % (uint64_t)args->key_range);
+            int roll = (int)((r >> 32) % 100);
+            if (args->list != NULL) {
+                if (roll < args->update_percent / 2) {
+                    lf_insert(args->list, self, key);
+                } else if (roll < args->update_percent) {
+                    lf_remove(args->list, self, key);
+                } else {
+                    lf_contains(args->list, self, key);
+                }
+            } else {
+                if (roll < args->update_percent / 2) {
+                    locked_insert(key);
+                } else if (roll < args->update_percent) {
+                    locked_remove(key);
+                } else {
+                    locked_contains(key);
+                }
+            }
+        }
+    }
+    args->ops = ops;
+    return NULL;
+}
+
+// Fills half the key range, runs `threads` workers for `ms` milliseconds, returns Mops/s.
+static double run_bench(int lock_free, int threads, int key_range, int update_percent, int ms) {
+    LfList *list = NULL;
+    if (lock_free) {
+        list = (LfList*)aligned_alloc(64, sizeof(LfList));
+        if (!list) {
+            printf("Memory allocation error!\n");
+            exit(1);
+        }
+        lf_init(list);
+        LfThread *self = lf_register(list);
+        for (int key = 0; key < key_range; key += 2) {
+            lf_insert(list, self, key);
+        }
+    } else {
+        init_list(&locked_list);
+        for (int key = 0; key < key_range; key += 2) {
+            append(&locked_list, key);
+        }
+    }
+
+    atomic_int stop;
+    atomic_init(&stop, 0);
+    BenchArgs args[EBR_MAX_THREADS - 1];
+    pthread_t ids[EBR_MAX_THREADS - 1];
+    for (int i = 0; i < threads; i++) {
+        args[i] = (BenchArgs){list, i, key_range, update_percent, &stop, 0};
+        pthread_create(&ids[i], NULL, bench_worker, &args[i]);
+    }
+    uint64_t t0 = now_ns();
+    struct timespec pause = {ms / 1000, (long)(ms % 1000) * 1000000L};
+    nanosleep(&pause, NULL);
+    atomic_store(&stop, 1);
+    long total = 0;
+    for (int i = 0; i < threads; i++) {
+        pthread_join(ids[i], NULL);
+        total += args[i].ops;
+    }
+    uint64_t elapsed = now_ns() - t0;
+
+    if (lock_free) {
+        lf_destroy(list);
+        free(list);
+    } else {
+        free_list(&locked_list);
+    }
+    return total * 1000.0 / (double)elapsed;
+}
+
+// --- Main Function ---
+int main(int argc, char *argv[]) {
+    int max_threads = argc > 1 ? atoi(argv[1]) : 8;
+    int key_range = argc > 2 ? atoi(argv[2]) : 1024;
+    int update_percent = argc > 3 ? atoi(argv[3]) : 20;
+    int ms = argc > 4 ? atoi(argv[4]) : 300;
+    if (max_threads < 1) {
+        max_threads = 1;
+    }
+    if (max_threads > EBR_MAX_THREADS - 1) {
+        max_threads = EBR_MAX_THREADS - 1;  // One slot for the filler
+    }
+    if (key_range < 2) {
+        key_range = 2;
+    }
+    if (update_percent < 0) {
+        update_percent = 0;
+    }
+    if (update_percent > 100) {
+        update_percent = 100;
+    }
+    if (ms < 1) {
+        ms = 1;
+    }
+
+    int stress_threads = max_threads < 4 ? 4 : max_threads;
+    long problems = run_stress(stress_threads);
+    printf("Stress test: %d threads x %d ops on %d keys: %s (%ld problems)\n", stress_threads,
+           STRESS_OPS, STRESS_KEYS, problems == 0 ? "passed" : "FAILED", problems);
+
+    printf("\n%d keys, %d%% updates, %d ms per run, %ld online CPUs, Mops/s\n", key_range,
+           update_percent, ms, sysconf(_SC_NPROCESSORS_ONLN));
+    printf("%8s %12s %12s\n", "threads", "mutex", "lock-free");
+    for (int threads = 1; threads <= max_threads; threads *= 2) {
+        double locked = run_bench(0, threads, key_range, update_percent, ms);
+        double lock_free = run_bench(1, threads, key_range, update_percent, ms);
+        printf("%8d %12.2f %12.2f\n", threads, locked, lock_free);
+    }
+
+    slab_destroy(&node_pool);
+    return problems == 0 ? 0 : 1;
+}
@@ -0,0 +1,240 @@
+// This C program checks and benchmarks the order statistics of TREE/simple.c: tree_rank,
+// tree_select, range_count and range_visit against the old way of answering the same
+// questions, one full in-order walk per query.
+//
+// Check: random insert / delete / avl_insert / avl_delete on a small tree, mirrored in a
+// sorted array. After every batch each node's size must match its subtree, and rank,
+// select and the range functions must agree with the array.
+//
+// Benchmark: an AVL tree of n random keys answers random "count of keys < x", "k-th
+// smallest" and "keys in [lo, lo + width]" queries both ways.
+//
+// Build:  gcc -O2 rank_bench.c -o rank_bench
+// Usage:  ./rank_bench [n] [queries] [width]   (defaults: n = 1000000, queries = 200, width = 100)
+
+#define _POSIX_C_SOURCE 200809L
+#define DS_NO_MAIN
+
+// --- Includes Section ---
+#include "../TREE/simple.c"
+#include "../common/timer.h"
+
+// --- Full-Walk Baselines ---
+// What the reporting path did before: visit every node and filter.
+
+typedef struct WalkState {
+    int lo;
+    int hi;
+    int k;                         // Position still to skip for select
+    int count;                     // Keys seen in [lo, hi]
+    long sum;                      // Sum of those keys, so the walk cannot be skipped
+    TreeNode *picked;              // Result of select
+} WalkState;
+
+static void walk_range(TreeNode *node, void *ctx) {
+    WalkState *state = (WalkState*)ctx;
+    if (node->data >= state->lo && node->data <= state->hi) {
+        state->count++;
+        state->sum += node->data;
+    }
+}
+
+static void walk_select(TreeNode *node, void *ctx) {
+    WalkState *state = (WalkState*)ctx;
+    if (state->k-- == 0) {
+        state->picked = node;
+    }
+}
+
+static void sum_node(TreeNode *node, void *ctx) {
+    WalkState *state = (WalkState*)ctx;
+    state->count++;
+    state->sum += node->data;
+}
+
+// --- Check ---
+
+// Returns the real size of the subtree, counting every node whose stored size is wrong.
+static int check_sizes(TreeNode *node, long *problems) {
+    if (node == NULL) {
+        return 0;
+    }
+    int size = 1 + check_sizes(node->left, problems) + check_sizes(node->right, problems);
+    if (node->size != size) (*problems)++;
+    return size;
+}
+
+// Index of the first element >= key in the sorted array.
+static int lower_bound(const int *array, int n, int key) {
+    int lo = 0, hi = n;
+    while (lo < hi) {
+        int mid = lo + (hi - lo) / 2;
+        if (array[mid] < key) lo = mid + 1;
+        else hi = mid;
+    }
+    return lo;
+}
+
+static long run_check(void) {
+    enum { KEYS = 2000, ROUNDS = 200, BATCH = 50 };
+    int *sorted = (int*)malloc(KEYS * sizeof(int));
+    if (!sorted) {
+        printf("Memory allocation error!\n");
+        exit(1);
+    }
+    int n = 0;
+    long problems = 0;
+    uint64_t seed = 3;
+    TreeNode *plain = NULL;        // Plain insert / delete
+    TreeNode *balanced = NULL;     // AVL insert / delete
+    for (int round = 0; round < ROUNDS; round++) {
+        for (int i = 0; i < BATCH; i++) {
+            uint64_t r = xorshift64(&seed);
+            int key = (int)(r % KEYS);
+            int pos = lower_bound(sorted, n, key);
+            int present = pos < n && sorted[pos] == key;
+            if ((r >> 32) % 5 < 3) {  // Insert more often than delete so the trees grow
+                plain = insert(plain, key);
+                balanced = avl_insert(balanced, key);
+                if (!present) {
+                    for (int j = n; j > pos; j--) sorted[j] = sorted[j - 1];
+                    sorted[pos] = key;
+                    n++;
+                }
+            } else {
+                plain = delete(plain, key);
+                balanced = avl_delete(balanced, key);
+                if (present) {
+                    for (int j = pos; j < n - 1; j++) sorted[j] = sorted[j + 1];
+                    n--;
+                }
+            }
+        }
+
+        TreeNode *trees[2] = {plain, balanced};
+        for (int t = 0; t < 2; t++) {
+            TreeNode *root = trees[t];
+            if (check_sizes(root, &problems) != n) problems++;
+            for (int q = 0; q < 20; q++) {
+                int x = (int)(xorshift64(&seed) % (KEYS + 2)) - 1;
+                int width = (int)(xorshift64(&seed) % 100);
+                if (tree_rank(root, x) != lower_bound(sorted, n, x)) problems++;
+                int expected = lower_bound(sorted, n, x + width + 1) - lower_bound(sorted, n, x);
+                if (range_count(root, x, x + width) != expected) problems++;
+                WalkState state = {x, x + width, 0, 0, 0, NULL};
+                if (range_visit(root, x, x + width, walk_range, &state) != expected ||
+                    state.count != expected) problems++;
+                if (n > 0) {
+                    int k = (int)(xorshift64(&seed) % (uint64_t)n);
+                    if (tree_select(root, k)->data != sorted[k]) problems++;
+                }
+            }
+            if (range_count(root, INT_MIN, INT_MAX) != n) problems++;
+        }
+    }
+
+    // build_from_sorted must set the sizes as well
+    TreeNode *built = build_from_sorted(sorted, n);
+    if (check_sizes(built, &problems) != n) problems++;
+    for (int k = 0; k < n; k++) {
+        if (tree_select(built, k)->data != sorted[k]) problems++;
+    }
+
+    free_tree(plain);
+    free_tree(balanced);
+    free_tree(built);
+    free(sorted);
+    return problems;
+}
+
+// --- Main Function ---
+int main(int argc, char *argv[]) {
+    int n = argc > 1 ? atoi(argv[1]) : 1000000;
+    int queries = argc > 2 ? atoi(argv[2]) : 200;
+    int width = argc > 3 ? atoi(argv[3]) : 100;
+    if (n < 1) n = 1;
+    if (queries < 1) queries = 1;
+    if (width < 0) width = 0;
+
+    long problems = run_check();
+    printf("Check: %s (%ld problems)\n", problems == 0 ? "passed" : "FAILED", problems);
+
+    // Keys are spread over [0, 4n), so a range of `width` holds about width / 4 keys
+    uint64_t seed = 17;
+    TreeNode *root = NULL;
+    for (int i = 0; i < n; i++) {
+        root = avl_insert(root, (int)(xorshift64(&seed) % (uint64_t)(4 * n)));
+    }
+    int size = node_size(root);
+    int *xs = (int*)malloc((size_t)queries * sizeof(int));
+    if (!xs) {
+        printf("Memory allocation error!\n");
+        return 1;
+    }
+    for (int i = 0; i < queries; i++) {
+        xs[i] = (int)(xorshift64(&seed) % (uint64_t)(4 * n));
+    }
+
+    printf("\n%d distinct keys, %d queries, range width %d\n", size, queries, width);
+    printf("%-14s %14s %14s %10s\n", "query", "full walk us", "augmented us", "speedup");
+
+    // Count of keys < x
+    long walk_check = 0, fast_check = 0;
+    uint64_t t0 = now_ns();
+    for (int i = 0; i < queries; i++) {
+        WalkState state = {INT_MIN, xs[i] - 1, 0, 0, 0, NULL};
+        inorder_visit(root, walk_range, &state);
+        walk_check += state.count;
+    }
+    uint64_t t1 = now_ns();
+    for (int i = 0; i < queries; i++) {
+        fast_check += tree_rank(root, xs[i]);
+    }
+    uint64_t t2 = now_ns();
+    printf("%-14s %14.2f %14.3f %9.0fx%s\n", "rank", (double)(t1 - t0) / queries / 1e3,
+           (double)(t2 - t1) / queries / 1e3, (double)(t1 - t0) / (double)(t2 - t1 + 1),
+           walk_check == fast_check ? "" : "  MISMATCH");
+
+    // k-th smallest
+    walk_check = fast_check = 0;
+    t0 = now_ns();
+    for (int i = 0; i < queries; i++) {
+        WalkState state = {0, 0, xs[i] % size, 0, 0, NULL};
+        inorder_visit(root, walk_select, &state);
+        walk_check += state.picked->data;
+    }
+    t1 = now_ns();
+    for (int i = 0; i < queries; i++) {
+        fast_check += tree_select(root, xs[i] % size)->data;
+    }
+    t2 = now_ns();
+    printf("%-14s %14.2f %14.3f %9.0fx%s\n", "select", (double)(t1 - t0) / queries / 1e3,
+           (double)(t2 - t1) / queries / 1e3, (double)(t1 - t0) / (double)(t2 - t1 + 1),
+           walk_check == fast_check ? "" : "  MISMATCH");
+
+    // All keys in [lo, lo + width]
+    walk_check = fast_check = 0;
+    long keys_seen = 0;
+    t0 = now_ns();
+    for (int i = 0; i < queries; i++) {
+        WalkState state = {xs[i], xs[i] + width, 0, 0, 0, NULL};
+        inorder_visit(root, walk_range, &state);
+        walk_check += state.sum;
+    }
+    t1 = now_ns();
+    for (int i = 0; i < queries; i++) {
+        WalkState state = {0, 0, 0, 0, 0, NULL};
+        keys_seen += range_visit(root, xs[i], xs[i] + width, sum_node, &state);
+        fast_check += state.sum;
+    }
+    t2 = now_ns();
+    printf("%-14s %14.2f %14.3f %9.0fx%s\n", "range_visit", (double)(t1 - t0) / queries / 1e3,
+           (double)(t2 - t1) / queries / 1e3, (double)(t1 - t0) / (double)(t2 - t1 + 1),
+           walk_check == fast_check ? "" : "  MISMATCH");
+    printf("(%.1f keys per range on average)\n", (double)keys_seen / queries);
+
+    free(xs);
+    free_tree(root);
+    slab_destroy(&node_pool);
+    return problems == 0 ? 0 : 1;
+}
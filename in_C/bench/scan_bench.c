@@ -0,0 +1,117 @@
+// This C program benchmarks the SIMD scans from common/simd_scan.h against the plain loops
+// the array program used before (find_element's early-exit loop and the exercise's max loop).
+// Every scan runs over the whole array: find looks for a value that is not present.
+//
+// Build:  gcc -O2 scan_bench.c -o scan_bench
+// Usage:  ./scan_bench [n] [repeats]   (defaults: n = 4000000, repeats = 50)
+
+#define _POSIX_C_SOURCE 200809L
+
+// --- Includes Section ---
+#include <stdio.h>
+#include <stdlib.h>
+#include "../common/simd_scan.h"
+#include "../common/timer.h"
+
+// --- Old Loop Versions ---
+
+static int loop_find(const int *arr, int size, int value) {
+    for (int i = 0; i < size; i++) {
+        if (arr[i] == value) {
+            return i;  // Return index if element is found
+        }
+    }
+    return -1;
+}
+
+static int loop_max(const int *arr, int size) {
+    int max = arr[0];
+    for (int i = 1; i < size; i++) {
+        if (arr[i] > max) {
+            max = arr[i];  // Update max if a larger element is found
+        }
+    }
+    return max;
+}
+
+// --- Benchmark Helpers ---
+
+// Prints time per element and throughput in GB/s for one kernel.
+static void report(const char *op, const char *kernel, uint64_t ns, int n, int repeats, long check) {
+    double elements = (double)n * repeats;
+    printf("%-6s %-10s %10.3f %10.2f   (check %ld)\n", op, kernel, (double)ns / elements,
+           elements * sizeof(int) / (double)ns, check);
+}
+
+// Kernels are called through a volatile function pointer, so the compiler cannot hoist
+// the (pure) scan out of the repeat loop.
+#define RUN_FIND(name, fn) do {                                   \
+        ScanFindFn volatile kernel = fn;                          \
+        long check = 0;                                           \
+        uint64_t t0 = now_ns();                                   \
+        for (int r = 0; r < repeats; r++) check += kernel(arr, n, -1); \
+        report("find", name, now_ns() - t0, n, repeats, check);   \
+    } while (0)
+
+#define RUN_COUNT(name, fn) do {                                  \
+        ScanFindFn volatile kernel = fn;                          \
+        long check = 0;                                           \
+        uint64_t t0 = now_ns();                                   \
+        for (int r = 0; r < repeats; r++) check += kernel(arr, n, 7); \
+        report("count", name, now_ns() - t0, n, repeats, check);  \
+    } while (0)
+
+#define RUN_REDUCE(op, name, fn) do {                             \
+        ScanReduceFn volatile kernel = fn;                        \
+        long check = 0;                                           \
+        uint64_t t0 = now_ns();                                   \
+        for (int r = 0; r < repeats; r++) check += kernel(arr, n); \
+        report(op, name, now_ns() - t0, n, repeats, check);       \
+    } while (0)
+
+// --- Main Function ---
+int main(int argc, char *argv[]) {
+    int n = argc > 1 ? atoi(argv[1]) : 4000000;
+    int repeats = argc > 2 ? atoi(argv[2]) : 50;
+    if (n < 1) n = 1;
+    if (repeats < 1) repeats = 1;
+
+    int *arr = (int*)malloc((size_t)n * sizeof(int));
+    if (!arr) {
+        printf("Memory allocation error!\n");
+        return 1;
+    }
+    uint64_t seed = 42;
+    for (int i = 0; i < n; i++) {
+        arr[i] = (int)(xorshift64(&seed) % 1000000);  // Never negative, so find(-1) scans everything
+    }
+
+    printf("n = %d ints (%.1f MiB), %d repeats, CPU level %d (2 = AVX2, 1 = SSE4.1)\n", n,
+           n * sizeof(int) / 1048576.0, repeats, scan_cpu_level());
+    printf("%-6s %-10s %10s %10s\n", "op", "kernel", "ns/elem", "GB/s");
+
+    RUN_FIND("loop", loop_find);
+    RUN_FIND("scalar", scan_find_scalar);
+#ifdef SIMD_SCAN_X86
+    if (scan_cpu_level() >= 1) RUN_FIND("sse4.1", scan_find_sse41);
+    if (scan_cpu_level() >= 2) RUN_FIND("avx2", scan_find_avx2);
+#endif
+    RUN_FIND("dispatch", scan_find_int);
+
+    RUN_REDUCE("max", "loop", loop_max);
+    RUN_REDUCE("max", "scalar", scan_max_scalar);
+#ifdef SIMD_SCAN_X86
+    if (scan_cpu_level() >= 1) RUN_REDUCE("max", "sse4.1", scan_max_sse41);
+    if (scan_cpu_level() >= 2) RUN_REDUCE("max", "avx2", scan_max_avx2);
+#endif
+    RUN_REDUCE("max", "dispatch", scan_max_int);
+
+    RUN_REDUCE("min", "scalar", scan_min_scalar);
+    RUN_REDUCE("min", "dispatch", scan_min_int);
+
+    RUN_COUNT("scalar", scan_count_scalar);
+    RUN_COUNT("dispatch", scan_count_int);
+
+    free(arr);
+    return 0;
+}
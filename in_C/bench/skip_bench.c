@@ -0,0 +1,101 @@
+// This C program compares the plain doubly linked list from DDL/DDL_first.c with its indexed
+// (skip list) mode: random access by index, insert_at + delete_at at random positions, and
+// search by value in a sorted list. It also reports the cost of attaching the index.
+//
+// Build:  gcc -O2 skip_bench.c -o skip_bench
+// Usage:  ./skip_bench [max_exponent] [ops]   (sizes 10^3 .. 10^max_exponent, default 6; ops 1000)
+
+#define _POSIX_C_SOURCE 200809L
+#define DS_NO_MAIN
+
+// --- Includes Section ---
+#include "../DDL/DDL_first.c"
+#include "../common/timer.h"
+
+// --- Benchmark ---
+
+// Indexed operations are so much faster that they run this many times more often,
+// to get a measurable time.
+#define INDEXED_FACTOR 100
+
+// Runs one size: every operation is timed in ns per call for both modes.
+static void bench_size(int n, int ops) {
+    uint64_t seed = 42 + (uint64_t)n;
+    int indexed_ops = ops * INDEXED_FACTOR;
+    int *positions = (int*)malloc((size_t)indexed_ops * sizeof(int));
+    if (!positions) {
+        printf("Memory allocation error!\n");
+        exit(1);
+    }
+    for (int i = 0; i < indexed_ops; i++) {
+        positions[i] = (int)(xorshift64(&seed) % (uint64_t)n);
+    }
+
+    // Sorted keys 0, 2, 4, ...: searching for an odd key misses
+    List list;
+    init_list(&list);
+    for (int i = 0; i < n; i++) {
+        append(&list, 2 * i);
+    }
+    long check = 0;
+
+    // Plain mode
+    uint64_t t0 = now_ns();
+    for (int i = 0; i < ops; i++) check += node_at(&list, positions[i])->data;
+    uint64_t t1 = now_ns();
+    for (int i = 0; i < ops; i++) insert_at(&list, positions[i], -1);
+    for (int i = ops - 1; i >= 0; i--) delete_at(&list, positions[i]);
+    uint64_t t2 = now_ns();
+    for (int i = 0; i < ops; i++) check += find(&list, positions[i]) != NULL;
+    uint64_t t3 = now_ns();
+    double plain_at = (double)(t1 - t0) / ops;
+    double plain_edit = (double)(t2 - t1) / (2.0 * ops);
+    double plain_find = (double)(t3 - t2) / ops;
+
+    // Indexed mode
+    IndexedList il;
+    indexed_init(&il);
+    t0 = now_ns();
+    indexed_attach(&il, &list);
+    t1 = now_ns();
+    double attach = (double)(t1 - t0) / n;
+    t0 = now_ns();
+    for (int i = 0; i < indexed_ops; i++) check += indexed_node_at(&il, positions[i])->data;
+    t1 = now_ns();
+    for (int i = 0; i < indexed_ops; i++) indexed_insert_at(&il, positions[i], -1);
+    for (int i = indexed_ops - 1; i >= 0; i--) indexed_delete_at(&il, positions[i]);
+    t2 = now_ns();
+    for (int i = 0; i < indexed_ops; i++) check += indexed_find_sorted(&il, positions[i]) != NULL;
+    t3 = now_ns();
+    double indexed_at = (double)(t1 - t0) / indexed_ops;
+    double indexed_edit = (double)(t2 - t1) / (2.0 * indexed_ops);
+    double indexed_find = (double)(t3 - t2) / indexed_ops;
+
+    printf("%10d %10.1f %10.1f %12.1f %12.1f %10.1f %10.1f %9.1f  %ld\n", n, plain_at, indexed_at,
+           plain_edit, indexed_edit, plain_find, indexed_find, attach, check);
+
+    indexed_free(&il);
+    free(positions);
+}
+
+// --- Main Function ---
+int main(int argc, char *argv[]) {
+    int max_exp = argc > 1 ? atoi(argv[1]) : 6;
+    int ops = argc > 2 ? atoi(argv[2]) : 1000;
+    if (max_exp < 3) max_exp = 3;
+    if (max_exp > 7) max_exp = 7;
+    if (ops < 1) ops = 1;
+
+    printf("times in ns per operation (attach: ns per node), %d plain / %d indexed ops\n",
+           ops, ops * INDEXED_FACTOR);
+    printf("%10s %10s %10s %12s %12s %10s %10s %9s  %s\n", "n", "at", "idx at", "edit",
+           "idx edit", "find", "idx find", "attach", "check");
+    int n = 1000;
+    for (int e = 3; e <= max_exp; e++, n *= 10) {
+        bench_size(n, ops);
+    }
+
+    slab_destroy(&node_pool);
+    slab_destroy(&lane_pool);
+    return 0;
+}
@@ -0,0 +1,164 @@
+// This C program benchmarks the slab node allocator (common/slab.h) against plain malloc.
+// For each size it builds a chain of list-shaped (16 byte) and tree-shaped (24 byte) nodes,
+// walks the chain once, and tears it down, timing each phase separately.
+//
+// Build:  gcc -O2 slab_bench.c -o slab_bench
+// Usage:  ./slab_bench [max_exponent]   (sizes 10^6 .. 10^max_exponent, default 7, max 8)
+
+#define _POSIX_C_SOURCE 200809L
+
+// --- Includes Section ---
+#include <stdio.h>
+#include <stdlib.h>
+#include "../common/slab.h"
+#include "../common/timer.h"
+
+// --- Struct Definitions ---
+// Same layout as the SLL Node (16 bytes).
+typedef struct ListNode {
+    int data;
+    struct ListNode *next;
+} ListNode;
+
+// Same layout as the DLL Node (24 bytes).
+typedef struct WideNode {
+    int data;
+    struct WideNode *next;
+    struct WideNode *other;
+} WideNode;
+
+// --- Benchmark Helpers ---
+
+// Time per node in nanoseconds.
+static double per_node(uint64_t ns, long n) {
+    return (double)ns / (double)n;
+}
+
+// 1. List-shaped nodes with malloc: O(n)
+static void bench_list_malloc(long n) {
+    uint64_t t0 = now_ns();
+    ListNode *head = NULL;
+    for (long i = 0; i < n; i++) {
+        ListNode *node = (ListNode*)malloc(sizeof(ListNode));
+        if (!node) {
+            printf("Memory allocation error!\n");
+            exit(1);
+        }
+        node->data = (int)i;
+        node->next = head;
+        head = node;
+    }
+    uint64_t t1 = now_ns();
+    long long sum = 0;
+    for (ListNode *temp = head; temp != NULL; temp = temp->next) {
+        sum += temp->data;
+    }
+    uint64_t t2 = now_ns();
+    while (head != NULL) {
+        ListNode *temp = head;
+        head = head->next;
+        free(temp);
+    }
+    uint64_t t3 = now_ns();
+    printf("%-10ld %-8s %-7s %10.2f %10.2f %10.2f   (sum %lld)\n", n, "16B", "malloc",
+           per_node(t1 - t0, n), per_node(t2 - t1, n), per_node(t3 - t2, n), sum);
+}
+
+// 2. List-shaped nodes with the slab pool: O(n) build and walk, O(blocks) teardown
+static void bench_list_slab(long n) {
+    SlabPool pool = SLAB_POOL_INIT(sizeof(ListNode));
+    uint64_t t0 = now_ns();
+    ListNode *head = NULL;
+    for (long i = 0; i < n; i++) {
+        ListNode *node = (ListNode*)slab_alloc(&pool);
+        node->data = (int)i;
+        node->next = head;
+        head = node;
+    }
+    uint64_t t1 = now_ns();
+    long long sum = 0;
+    for (ListNode *temp = head; temp != NULL; temp = temp->next) {
+        sum += temp->data;
+    }
+    uint64_t t2 = now_ns();
+    slab_destroy(&pool);
+    uint64_t t3 = now_ns();
+    printf("%-10ld %-8s %-7s %10.2f %10.2f %10.2f   (sum %lld)\n", n, "16B", "slab",
+           per_node(t1 - t0, n), per_node(t2 - t1, n), per_node(t3 - t2, n), sum);
+}
+
+// 3. Tree-shaped nodes with malloc: O(n)
+static void bench_wide_malloc(long n) {
+    uint64_t t0 = now_ns();
+    WideNode *head = NULL;
+    for (long i = 0; i < n; i++) {
+        WideNode *node = (WideNode*)malloc(sizeof(WideNode));
+        if (!node) {
+            printf("Memory allocation error!\n");
+            exit(1);
+        }
+        node->data = (int)i;
+        node->next = head;
+        node->other = NULL;
+        head = node;
+    }
+    uint64_t t1 = now_ns();
+    long long sum = 0;
+    for (WideNode *temp = head; temp != NULL; temp = temp->next) {
+        sum += temp->data;
+    }
+    uint64_t t2 = now_ns();
+    while (head != NULL) {
+        WideNode *temp = head;
+        head = head->next;
+        free(temp);
+    }
+    uint64_t t3 = now_ns();
+    printf("%-10ld %-8s %-7s %10.2f %10.2f %10.2f   (sum %lld)\n", n, "24B", "malloc",
+           per_node(t1 - t0, n), per_node(t2 - t1, n), per_node(t3 - t2, n), sum);
+}
+
+// 4. Tree-shaped nodes with the slab pool: O(n) build and walk, O(blocks) teardown
+static void bench_wide_slab(long n) {
+    SlabPool pool = SLAB_POOL_INIT(sizeof(WideNode));
+    uint64_t t0 = now_ns();
+    WideNode *head = NULL;
+    for (long i = 0; i < n; i++) {
+        WideNode *node = (WideNode*)slab_alloc(&pool);
+        node->data = (int)i;
+        node->next = head;
+        node->other = NULL;
+        head = node;
+    }
+    uint64_t t1 = now_ns();
+    long long sum = 0;
+    for (WideNode *temp = head; temp != NULL; temp = temp->next) {
+        sum += temp->data;
+    }
+    uint64_t t2 = now_ns();
+    slab_destroy(&pool);
+    uint64_t t3 = now_ns();
+    printf("%-10ld %-8s %-7s %10.2f %10.2f %10.2f   (sum %lld)\n", n, "24B", "slab",
+           per_node(t1 - t0, n), per_node(t2 - t1, n), per_node(t3 - t2, n), sum);
+}
+
+// --- Main Function ---
+int main(int argc, char *argv[]) {
+    int max_exp = 7;
+    if (argc > 1) {
+        max_exp = atoi(argv[1]);
+    }
+    if (max_exp < 6) max_exp = 6;
+    if (max_exp > 8) max_exp = 8;
+
+    printf("%-10s %-8s %-7s %10s %10s %10s\n", "nodes", "node", "alloc",
+           "build ns", "walk ns", "free ns");
+    long n = 1000000;
+    for (int e = 6; e <= max_exp; e++, n *= 10) {
+        bench_list_malloc(n);
+        bench_list_slab(n);
+        bench_wide_malloc(n);
+        bench_wide_slab(n);
+    }
+    return 0;
+}
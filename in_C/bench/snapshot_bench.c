@@ -0,0 +1,274 @@
+// This C program checks the snapshot files of the doubly linked list (DDL/DDL_first.c) and
+// the dynamic array (array/arrays.c), and measures startup time: rebuilding the structure
+// with append / push_back calls against opening its snapshot.
+//
+// Check: random lists and arrays (including empty ones) must come back identical after
+// save -> open -> load. A flipped byte must fail the checksum, a truncated file or a
+// file of the wrong kind must be refused, and a link index bent into a cycle or out of
+// range must be refused by load_list and list_snapshot_find even without verify.
+//
+// Benchmark, for n elements (the snapshot is in the page cache, as after a restart of the
+// process; a cold disk adds its read time to every row that touches the data):
+//   rebuild:      append / push_back of every element, what main does today
+//   open:         mmap and header check only, O(1)
+//   open+verify:  also checks the checksum, one sequential read
+//   open+scan:    open, then read every element through the mapping
+//   load:         open, then copy into a live structure that can be changed
+//
+// Build:  gcc -O2 snapshot_bench.c -o snapshot_bench
+// Usage:  ./snapshot_bench [n] [file]   (defaults: n = 10000000, file = bench.snap)
+
+#define _POSIX_C_SOURCE 200809L
+#define DS_NO_MAIN
+
+// --- Includes Section ---
+#include "../DDL/DDL_first.c"
+#include "../array/arrays.c"
+#include "../common/timer.h"
+
+// --- Check ---
+
+// Returns 1 if the list holds exactly values[0..n) with consistent prev links.
+static int list_matches(const List *list, const int *values, int n) {
+    if (list->length != n) return 0;
+    Node *prev = NULL;
+    int i = 0;
+    for (Node *node = list->head; node != NULL; prev = node, node = node->next, i++) {
+        if (i >= n || node->data != values[i] || node->prev != prev) return 0;
+    }
+    return i == n && list->tail == prev;
+}
+
+// Overwrites one byte of a file.
+static void poke_byte(const char *path, long offset, unsigned char value) {
+    FILE *file = fopen(path, "r+b");
+    if (file != NULL) {
+        fseek(file, offset, SEEK_SET);
+        fputc(value, file);
+        fclose(file);
+    }
+}
+
+static long run_check(const char *path) {
+    long problems = 0;
+    uint64_t seed = 9;
+    static const int sizes[] = {0, 1, 2, 7, 1000, 100000};
+    for (int s = 0; s < 6; s++) {
+        int n = sizes[s];
+        int *values = (int*)malloc((size_t)(n + 1) * sizeof(int));
+        if (!values) {
+            printf("Memory allocation error!\n");
+            exit(1);
+        }
+        List list;
+        Vector vec;
+        init_list(&list);
+        vector_init(&vec);
+        for (int i = 0; i < n; i++) {
+            values[i] = (int)xorshift64(&seed);
+            append(&list, values[i]);
+            vector_push_back(&vec, values[i]);
+        }
+
+        // List round trip, read in place and loaded
+        SnapshotView view;
+        if (save_list(&list, path) != 0 || open_list_snapshot(&view, path, 1) != 0) {
+            problems++;
+        } else {
+            for (int i = 0; i < n; i++) {
+                if (list_snapshot_at(&view, i)->data != values[i]) problems++;
+            }
+            if (n > 0 && list_snapshot_find(&view, values[n - 1]) < 0) problems++;
+            List loaded;
+            load_list(&loaded, &view);
+            if (!list_matches(&loaded, values, n)) problems++;
+            free_list(&loaded);
+            snapshot_close(&view);
+        }
+
+        // Array round trip
+        Vector mapped, loaded_vec;
+        if (save_array(&vec, path) != 0 || open_array_snapshot(&view, path, 1, &mapped) != 0) {
+            problems++;
+        } else {
+            if (mapped.size != n || (n > 0 && memcmp(mapped.data, values, (size_t)n * sizeof(int)) != 0)) {
+                problems++;
+            }
+            load_array(&loaded_vec, &view);
+            if (loaded_vec.size != n || (n > 0 && memcmp(loaded_vec.data, values, (size_t)n * sizeof(int)) != 0)) {
+                problems++;
+            }
+            vector_free(&loaded_vec);
+            snapshot_close(&view);
+        }
+
+        free_list(&list);
+        vector_free(&vec);
+        free(values);
+    }
+
+    // Damaged files: each of these opens or loads must fail with an error message
+    printf("Damaged files (8 errors expected):\n");
+    List list;
+    init_list(&list);
+    for (int i = 0; i < 1000; i++) append(&list, i);
+    SnapshotView view;
+    Vector mapped;
+    save_list(&list, path);
+    if (open_array_snapshot(&view, path, 0, &mapped) == 0) {  // Wrong kind
+        problems++;
+        snapshot_close(&view);
+    }
+    // Damaged links in a file opened without verify: load_list and list_snapshot_find must
+    // refuse them instead of reading out of bounds or looping
+    poke_byte(path, 64 + 12 * 500 + 8, 0x0A);  // Record 500's next becomes 266: a cycle
+    if (open_list_snapshot(&view, path, 0) != 0) {
+        problems++;
+    } else {
+        List loaded;
+        load_list(&loaded, &view);
+        problems += loaded.length != 0 || list_snapshot_find(&view, -1) != -1;
+        snapshot_close(&view);
+    }
+    poke_byte(path, 64 + 12 * 500 + 11, 0x7F);  // Record 500's next is now far out of range
+    if (open_list_snapshot(&view, path, 0) != 0) {
+        problems++;
+    } else {
+        List loaded;
+        load_list(&loaded, &view);
+        problems += loaded.length != 0 || list_snapshot_find(&view, -1) != -1;
+        snapshot_close(&view);
+    }
+    save_list(&list, path);
+
+    poke_byte(path, 64 + 12 * 500, 0xFF);  // Change one element's data
+    if (open_list_snapshot(&view, path, 0) != 0) {
+        problems++;  // Without verify the header is still fine
+    } else {
+        snapshot_close(&view);
+    }
+    if (open_list_snapshot(&view, path, 1) == 0) {  // With verify the checksum catches it
+        problems++;
+        snapshot_close(&view);
+    }
+    if (truncate(path, 64 + 12 * 999) != 0 || open_list_snapshot(&view, path, 0) == 0) {
+        problems++;  // Truncated
+        snapshot_close(&view);
+    }
+    poke_byte(path, 0, 'X');  // Bad magic
+    if (open_list_snapshot(&view, path, 0) == 0) {
+        problems++;
+        snapshot_close(&view);
+    }
+    free_list(&list);
+    remove(path);
+    return problems;
+}
+
+// --- Benchmark ---
+
+static double ms_since(uint64_t t0) {
+    return (double)(now_ns() - t0) / 1e6;
+}
+
+static void print_row(const char *structure, const char *method, double ms, long check) {
+    printf("%-8s %-14s %12.2f %22ld\n", structure, method, ms, check);
+}
+
+// --- Main Function ---
+int main(int argc, char *argv[]) {
+    int n = argc > 1 ? atoi(argv[1]) : 10000000;
+    const char *path = argc > 2 ? argv[2] : "bench.snap";
+    if (n < 1) n = 1;
+
+    long problems = run_check(path);
+    printf("Check: %s (%ld problems)\n", problems == 0 ? "passed" : "FAILED", problems);
+
+    int *values = (int*)malloc((size_t)n * sizeof(int));
+    if (!values) {
+        printf("Memory allocation error!\n");
+        return 1;
+    }
+    uint64_t seed = 4;
+    for (int i = 0; i < n; i++) {
+        values[i] = (int)(xorshift64(&seed) % 1000000);
+    }
+
+    printf("\n%d elements, times in ms (check = sum of the elements, or the count)\n", n);
+    printf("%-8s %-14s %12s %22s\n", "struct", "method", "ms", "check");
+
+    // Doubly linked list
+    List list;
+    init_list(&list);
+    uint64_t t0 = now_ns();
+    for (int i = 0; i < n; i++) append(&list, values[i]);
+    print_row("list", "rebuild", ms_since(t0), list.length);
+    t0 = now_ns();
+    save_list(&list, path);
+    print_row("list", "save", ms_since(t0), list.length);
+    free_list(&list);
+    slab_destroy(&node_pool);  // Load starts from an empty pool, like rebuild did
+
+    SnapshotView view;
+    t0 = now_ns();
+    open_list_snapshot(&view, path, 0);
+    print_row("list", "open", ms_since(t0), (long)view.header->count);
+    snapshot_close(&view);
+    t0 = now_ns();
+    open_list_snapshot(&view, path, 1);
+    print_row("list", "open+verify", ms_since(t0), (long)view.header->count);
+    snapshot_close(&view);
+    t0 = now_ns();
+    open_list_snapshot(&view, path, 0);
+    long sum = 0;
+    const ListRecord *records = (const ListRecord*)view.records;
+    for (uint64_t index = view.header->root; index != SNAPSHOT_NIL; index = records[index].next) {
+        sum += records[index].data;
+    }
+    print_row("list", "open+scan", ms_since(t0), sum);
+    snapshot_close(&view);
+    t0 = now_ns();
+    open_list_snapshot(&view, path, 0);
+    load_list(&list, &view);
+    snapshot_close(&view);
+    print_row("list", "load", ms_since(t0), list.length);
+    free_list(&list);
+    slab_destroy(&node_pool);
+
+    // Dynamic array
+    Vector vec;
+    vector_init(&vec);
+    t0 = now_ns();
+    for (int i = 0; i < n; i++) vector_push_back(&vec, values[i]);
+    print_row("array", "rebuild", ms_since(t0), vec.size);
+    t0 = now_ns();
+    save_array(&vec, path);
+    print_row("array", "save", ms_since(t0), vec.size);
+    vector_free(&vec);
+
+    Vector mapped;
+    t0 = now_ns();
+    open_array_snapshot(&view, path, 0, &mapped);
+    print_row("array", "open", ms_since(t0), mapped.size);
+    snapshot_close(&view);
+    t0 = now_ns();
+    open_array_snapshot(&view, path, 1, &mapped);
+    print_row("array", "open+verify", ms_since(t0), mapped.size);
+    snapshot_close(&view);
+    t0 = now_ns();
+    open_array_snapshot(&view, path, 0, &mapped);
+    sum = 0;
+    for (int i = 0; i < mapped.size; i++) sum += mapped.data[i];
+    print_row("array", "open+scan", ms_since(t0), sum);
+    snapshot_close(&view);
+    t0 = now_ns();
+    open_array_snapshot(&view, path, 0, &mapped);
+    load_array(&vec, &view);
+    snapshot_close(&view);
+    print_row("array", "load", ms_since(t0), vec.size);
+    vector_free(&vec);
+
+    remove(path);
+    free(values);
+    return problems == 0 ? 0 : 1;
+}
@@ -0,0 +1,396 @@
+// This C program checks and benchmarks the sorts: the merge sorts of array/merge_sort.c, the
+// radix sorts of array/radix_sort.c and sort_list of the doubly linked list
+// (DDL/DDL_first.c), or of the singly linked list when built with -DSORT_BENCH_SLL.
+//
+// Check: for sizes around the network block (64) and the parallel thresholds, and for
+// random, sorted, reversed and few-unique keys (INT_MIN and INT_MAX included), every sort
+// must give exactly what qsort gives, on 1 .. 4 threads (at most max_threads). The radix
+// sorts of pairs must match qsort of (key, position) pairs, which proves them stable.
+// Sorted lists must hold the qsort order with a correct length and tail (and prev links
+// for the DLL).
+//
+// Benchmark: n keys per distribution, sorted by qsort, merge_sort_int, radix_sort_int
+// (11-bit digits at these sizes), radix_sort_with 8-bit digits, and the parallel merge and
+// radix sorts on 1, 2, 4, ... max_threads threads (one pool per thread count, started
+// outside the timing). Then n random (key, position) pairs: qsort of a pair array against
+// radix_sort_pairs and parallel_radix_sort_pairs. Then list_n nodes sorted by sort_list
+// against qsort on the same values in an array. Mkeys/s and the speedup over qsort are
+// reported.
+//
+// Build:  gcc -O2 -pthread sort_bench.c -o sort_bench   (add -DSORT_BENCH_SLL for the SLL)
+// Usage:  ./sort_bench [n] [max_threads] [list_n]   (defaults: 10000000, 8, 1000000)
+
+#define _POSIX_C_SOURCE 200809L
+#define DS_NO_MAIN
+
+// --- Includes Section ---
+#ifdef SORT_BENCH_SLL
+#include "../SLL/SLL_FIRTS.c"
+#define LIST_NAME "sll"
+#else
+#include "../DDL/DDL_first.c"
+#define LIST_NAME "dll"
+#endif
+#include "../array/merge_sort.c"
+#include "../array/radix_sort.c"
+#include "../common/timer.h"
+
+// --- Struct Definitions ---
+typedef enum Distribution {
+    DIST_RANDOM,
+    DIST_SORTED,
+    DIST_REVERSED,
+    DIST_FEW_UNIQUE,           // 100 distinct values
+    DIST_COUNT
+} Distribution;
+
+static const char *dist_names[] = { "random", "sorted", "reversed", "few_unique" };
+
+// Array sorts timed by time_array.
+typedef enum Method {
+    METHOD_QSORT,
+    METHOD_MERGE,
+    METHOD_RADIX,
+    METHOD_RADIX8,
+    METHOD_PARALLEL_MERGE,
+    METHOD_PARALLEL_RADIX
+} Method;
+
+// A key with its payload, for qsort of pairs.
+typedef struct Pair {
+    int key;
+    int value;
+} Pair;
+
+// --- Helpers ---
+
+static int compare_int(const void *a, const void *b) {
+    int x = *(const int*)a;
+    int y = *(const int*)b;
+    return (x > y) - (x < y);
+}
+
+static int* alloc_ints(int n) {
+    int *arr = (int*)malloc((size_t)(n > 0 ? n : 1) * sizeof(int));
+    if (!arr) {
+        printf("Memory allocation error!\n");
+        exit(1);
+    }
+    return arr;
+}
+
+// Orders pairs by key, then by value: with position payloads, the stable order.
+static int compare_pair(const void *a, const void *b) {
+    const Pair *x = (const Pair*)a;
+    const Pair *y = (const Pair*)b;
+    if (x->key != y->key) {
+        return (x->key > y->key) - (x->key < y->key);
+    }
+    return (x->value > y->value) - (x->value < y->value);
+}
+
+// Fills arr with n keys of the distribution; random keys cover the whole int range.
+static void fill(int *arr, int n, Distribution dist, uint64_t seed) {
+    for (int i = 0; i < n; i++) {
+        uint64_t r = xorshift64(&seed);
+        switch (dist) {
+        case DIST_RANDOM:     arr[i] = (int)(uint32_t)r; break;
+        case DIST_SORTED:     arr[i] = i - n / 2; break;
+        case DIST_REVERSED:   arr[i] = n / 2 - i; break;
+        default:              arr[i] = (int)(r % 100) * 1000 - 50000; break;
+        }
+    }
+    if (n > 2 && dist != DIST_SORTED && dist != DIST_REVERSED) {
+        arr[0] = INT_MAX;
+        arr[n - 1] = INT_MIN;
+    }
+}
+
+// Builds a list of the n values in order.
+static void build_list(List *list, const int *values, int n) {
+    init_list(list);
+    append_many(list, values, n);
+}
+
+// 1 if the list holds exactly expected[0..n) and its handle is consistent.
+static int list_matches(const List *list, const int *expected, int n) {
+    if (list->length != n || (n == 0) != (list->head == NULL)) {
+        return 0;
+    }
+    const Node *prev = NULL;
+    const Node *node = list->head;
+    for (int i = 0; i < n; i++, prev = node, node = node->next) {
+        if (node == NULL || node->data != expected[i]) {
+            return 0;
+        }
+#ifndef SORT_BENCH_SLL
+        if (node->prev != prev) {
+            return 0;
+        }
+#endif
+    }
+    return node == NULL && list->tail == prev;
+}
+
+// --- Check ---
+
+static long run_check(int max_threads) {
+    static const int sizes[] = { 0, 1, 2, 7, 8, 63, 64, 65, 127, 129, 1000, 4099,
+                                 SORT_PARALLEL_MIN - 1, SORT_PARALLEL_MIN, SORT_PARALLEL_MIN + 777,
+                                 RADIX_PARALLEL_MIN - 1, RADIX_PARALLEL_MIN, 300001 };
+    int max_n = 300001;
+    int *keys = alloc_ints(max_n);
+    int *expected = alloc_ints(max_n);
+    int *work = alloc_ints(max_n);
+    int *scratch = alloc_ints(max_n);
+    int *values = alloc_ints(max_n);
+    Pair *pairs = (Pair*)malloc((size_t)max_n * sizeof(Pair));
+    if (!pairs) {
+        printf("Memory allocation error!\n");
+        exit(1);
+    }
+    long problems = 0;
+    WorkPool pool;
+    for (int threads = 1; threads <= max_threads; threads++) {
+        pool_init(&pool, threads);
+        for (int s = 0; s < (int)(sizeof(sizes) / sizeof(sizes[0])); s++) {
+            int n = sizes[s];
+            for (int d = 0; d < DIST_COUNT; d++) {
+                fill(keys, n, (Distribution)d, 12345u + (uint64_t)n * 31u + (uint64_t)d);
+                memcpy(expected, keys, (size_t)n * sizeof(int));
+                qsort(expected, (size_t)n, sizeof(int), compare_int);
+                memcpy(work, keys, (size_t)n * sizeof(int));
+                parallel_merge_sort(&pool, work, n);
+                problems += memcmp(work, expected, (size_t)n * sizeof(int)) != 0;
+                memcpy(work, keys, (size_t)n * sizeof(int));
+                parallel_radix_sort(&pool, work, n);
+                problems += memcmp(work, expected, (size_t)n * sizeof(int)) != 0;
+
+                // Pairs: the payload is the position, so qsort of (key, position) is the stable order
+                for (int i = 0; i < n; i++) {
+                    pairs[i].key = keys[i];
+                    pairs[i].value = i;
+                    values[i] = i;
+                }
+                qsort(pairs, (size_t)n, sizeof(Pair), compare_pair);
+                memcpy(work, keys, (size_t)n * sizeof(int));
+                if (threads == 1) {
+                    radix_sort_pairs(work, values, n);
+                } else {
+                    parallel_radix_sort_pairs(&pool, work, values, n);
+                }
+                for (int i = 0; i < n; i++) {
+                    problems += work[i] != pairs[i].key || values[i] != pairs[i].value;
+                }
+                if (threads > 1) {
+                    continue;  // The sequential sorts do not depend on the pool
+                }
+                memcpy(work, keys, (size_t)n * sizeof(int));
+                merge_sort_int(work, n);
+                problems += memcmp(work, expected, (size_t)n * sizeof(int)) != 0;
+                memcpy(work, keys, (size_t)n * sizeof(int));
+                radix_sort_int(work, n);
+                problems += memcmp(work, expected, (size_t)n * sizeof(int)) != 0;
+                for (int bits = 8; bits <= 11; bits += 3) {
+                    memcpy(work, keys, (size_t)n * sizeof(int));
+                    radix_sort_with(work, scratch, n, bits);
+                    problems += memcmp(work, expected, (size_t)n * sizeof(int)) != 0;
+                }
+                List list;
+                build_list(&list, keys, n);
+                sort_list(&list);
+                problems += !list_matches(&list, expected, n);
+                free_list(&list);
+            }
+        }
+        pool_free(&pool);
+    }
+    free(keys);
+    free(expected);
+    free(work);
+    free(scratch);
+    free(values);
+    free(pairs);
+    slab_destroy(&node_pool);
+    return problems;
+}
+
+// --- Benchmark ---
+
+static void print_row(const char *dist, const char *method, int n, uint64_t ns, uint64_t base_ns) {
+    printf("%-11s %-22s %10.1f %10.1f %8.2fx\n", dist, method, (double)ns / 1e6,
+           (double)n / 1e6 / ((double)ns / 1e9), (double)base_ns / (double)ns);
+}
+
+// Times one array sort of a fresh copy of keys and checks it against expected.
+// The 8-bit radix sort allocates its scratch buffer inside the timing, like the others.
+static uint64_t time_array(const int *keys, const int *expected, int *work, int n, Method method,
+                           WorkPool *pool) {
+    memcpy(work, keys, (size_t)n * sizeof(int));
+    uint64_t t0 = now_ns();
+    switch (method) {
+    case METHOD_QSORT:
+        qsort(work, (size_t)n, sizeof(int), compare_int);
+        break;
+    case METHOD_MERGE:
+        merge_sort_int(work, n);
+        break;
+    case METHOD_RADIX:
+        radix_sort_int(work, n);
+        break;
+    case METHOD_RADIX8: {
+        int *scratch = alloc_ints(n);
+        radix_sort_with(work, scratch, n, 8);
+        free(scratch);
+        break;
+    }
+    case METHOD_PARALLEL_MERGE:
+        parallel_merge_sort(pool, work, n);
+        break;
+    default:
+        parallel_radix_sort(pool, work, n);
+        break;
+    }
+    uint64_t ns = now_ns() - t0;
+    if (memcmp(work, expected, (size_t)n * sizeof(int)) != 0) {
+        printf("Error: method %d gave a wrong order.\n", (int)method);
+        exit(1);
+    }
+    return ns;
+}
+
+static void bench_arrays(int n, int max_threads) {
+    int *keys = alloc_ints(n);
+    int *expected = alloc_ints(n);
+    int *work = alloc_ints(n);
+    for (int d = 0; d < DIST_COUNT; d++) {
+        fill(keys, n, (Distribution)d, 42u + (uint64_t)d);
+        memcpy(expected, keys, (size_t)n * sizeof(int));
+        qsort(expected, (size_t)n, sizeof(int), compare_int);
+        uint64_t base = time_array(keys, expected, work, n, METHOD_QSORT, NULL);
+        print_row(dist_names[d], "qsort", n, base, base);
+        print_row(dist_names[d], "merge_sort_int", n, time_array(keys, expected, work, n, METHOD_MERGE, NULL), base);
+        print_row(dist_names[d], "radix_sort_int", n, time_array(keys, expected, work, n, METHOD_RADIX, NULL), base);
+        print_row(dist_names[d], "radix, 8-bit digits", n, time_array(keys, expected, work, n, METHOD_RADIX8, NULL), base);
+        for (int threads = 1; threads <= max_threads; threads *= 2) {
+            WorkPool pool;
+            pool_init(&pool, threads);
+            char name[32];
+            snprintf(name, sizeof(name), "merge, %d thread%s", threads, threads == 1 ? "" : "s");
+            print_row(dist_names[d], name, n, time_array(keys, expected, work, n, METHOD_PARALLEL_MERGE, &pool), base);
+            snprintf(name, sizeof(name), "radix, %d thread%s", threads, threads == 1 ? "" : "s");
+            print_row(dist_names[d], name, n, time_array(keys, expected, work, n, METHOD_PARALLEL_RADIX, &pool), base);
+            pool_free(&pool);
+        }
+    }
+    free(keys);
+    free(expected);
+    free(work);
+}
+
+// Random keys with their positions as payloads.
+static void bench_pairs(int n, int max_threads) {
+    int *keys = alloc_ints(n);
+    int *work = alloc_ints(n);
+    int *values = alloc_ints(n);
+    Pair *pairs = (Pair*)malloc((size_t)n * sizeof(Pair));
+    if (!pairs) {
+        printf("Memory allocation error!\n");
+        exit(1);
+    }
+    fill(keys, n, DIST_RANDOM, 9);
+    for (int i = 0; i < n; i++) {
+        pairs[i].key = keys[i];
+        pairs[i].value = i;
+    }
+    uint64_t t0 = now_ns();
+    qsort(pairs, (size_t)n, sizeof(Pair), compare_pair);
+    uint64_t base = now_ns() - t0;
+    print_row("random", "qsort (pairs)", n, base, base);
+
+    for (int threads = 1; threads <= max_threads; threads *= 2) {
+        WorkPool pool;
+        pool_init(&pool, threads);
+        memcpy(work, keys, (size_t)n * sizeof(int));
+        for (int i = 0; i < n; i++) {
+            values[i] = i;
+        }
+        t0 = now_ns();
+        if (threads == 1) {
+            radix_sort_pairs(work, values, n);
+        } else {
+            parallel_radix_sort_pairs(&pool, work, values, n);
+        }
+        uint64_t ns = now_ns() - t0;
+        pool_free(&pool);
+        char name[32];
+        snprintf(name, sizeof(name), "radix pairs, %d thread%s", threads, threads == 1 ? "" : "s");
+        print_row("random", name, n, ns, base);
+        for (int i = 0; i < n; i++) {
+            if (work[i] != pairs[i].key || values[i] != pairs[i].value) {
+                printf("Error: %s gave a wrong order.\n", name);
+                exit(1);
+            }
+        }
+    }
+    free(keys);
+    free(work);
+    free(values);
+    free(pairs);
+}
+
+static void bench_list(int n) {
+    int *keys = alloc_ints(n);
+    int *expected = alloc_ints(n);
+    fill(keys, n, DIST_RANDOM, 7);
+    memcpy(expected, keys, (size_t)n * sizeof(int));
+    uint64_t t0 = now_ns();
+    qsort(expected, (size_t)n, sizeof(int), compare_int);
+    uint64_t base = now_ns() - t0;
+    print_row("random", "qsort (array)", n, base, base);
+
+    List list;
+    build_list(&list, keys, n);
+    t0 = now_ns();
+    sort_list(&list);
+    print_row("random", "sort_list (" LIST_NAME ")", n, now_ns() - t0, base);
+    if (!list_matches(&list, expected, n)) {
+        printf("Error: sort_list gave a wrong order.\n");
+        exit(1);
+    }
+    // Sorting the sorted list again: every merge joins two chains with one link.
+    t0 = now_ns();
+    sort_list(&list);
+    print_row("sorted", "sort_list (" LIST_NAME ")", n, now_ns() - t0, base);
+    free_list(&list);
+    slab_destroy(&node_pool);
+    free(keys);
+    free(expected);
+}
+
+// --- Main Function ---
+int main(int argc, char *argv[]) {
+    int n = argc > 1 ? atoi(argv[1]) : 10000000;
+    int max_threads = argc > 2 ? atoi(argv[2]) : 8;
+    int list_n = argc > 3 ? atoi(argv[3]) : 1000000;
+    if (n < 1 || list_n < 1 || max_threads < 1 || max_threads > POOL_MAX_THREADS) {
+        printf("Error: Bad arguments.\n");
+        return 1;
+    }
+
+    long problems = run_check(max_threads < 4 ? max_threads : 4);
+    printf("Check: %s (%ld problems)\n", problems == 0 ? "passed" : "FAILED", problems);
+
+    printf("\n%d ints, %s\n", n, scan_cpu_level() >= 2 ? "AVX2 network" : "scalar network");
+    printf("%-11s %-22s %10s %10s %9s\n", "keys", "method", "ms", "Mkeys/s", "vs qsort");
+    bench_arrays(n, max_threads);
+
+    printf("\n%d (key, position) pairs\n", n);
+    printf("%-11s %-22s %10s %10s %9s\n", "keys", "method", "ms", "Mkeys/s", "vs qsort");
+    bench_pairs(n, max_threads);
+
+    printf("\n%d list nodes\n", list_n);
+    printf("%-11s %-22s %10s %10s %9s\n", "keys", "method", "ms", "Mkeys/s", "vs qsort");
+    bench_list(list_n);
+    return problems == 0 ? 0 : 1;
+}
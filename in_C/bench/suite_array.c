@@ -0,0 +1,168 @@
+// This C program is the benchmark suite of the array operations in array/arrays.c. It runs
+// every operation below at sizes 10^2 .. 10^max_exp, for the sorted, random and zipfian
+// workloads, and prints percentiles of the time per operation (see common/harness.h).
+//
+// Build:  gcc -O2 suite_array.c -o suite_array -lm   (or: make -C .. suite)
+// Usage:  ./suite_array [-f table|csv|json] [-m min_exp] [-M max_exp] [-r reps] [-b batches] [-s seed] [-w workloads] [-o operation] [-u budget] [-p prefix]
+
+#define _POSIX_C_SOURCE 200809L
+#define DS_NO_MAIN
+
+// --- Includes Section ---
+#include "../array/arrays.c"
+#include "../common/harness.h"
+
+// --- Struct Definitions ---
+typedef struct ArrayState {
+    Vector vec;
+    int *saved;                // Values removed by a delete batch, for its undo
+} ArrayState;
+
+// --- Cases ---
+
+// Builds a vector of the n keys in insertion order.
+static void* array_build(const BenchInput *in) {
+    ArrayState *state = (ArrayState*)malloc(sizeof(ArrayState));
+    if (!state) {
+        printf("Memory allocation error!\n");
+        exit(1);
+    }
+    vector_init(&state->vec);
+    vector_append_many(&state->vec, in->keys, in->n);
+    state->saved = (int*)malloc((size_t)in->ops * sizeof(int));
+    if (!state->saved) {
+        printf("Memory allocation error!\n");
+        exit(1);
+    }
+    return state;
+}
+
+static void array_destroy(void *state) {
+    ArrayState *s = (ArrayState*)state;
+    vector_free(&s->vec);
+    free(s->saved);
+    free(s);
+}
+
+static long array_push_back(void *state, const BenchInput *in, int first, int count) {
+    Vector *vec = &((ArrayState*)state)->vec;
+    for (int i = first; i < first + count; i++) {
+        vector_push_back(vec, 2 * in->ranks[i] + 1);
+    }
+    return vec->size;
+}
+
+static void array_pop_back(void *state, const BenchInput *in, int first, int count) {
+    (void)in;
+    (void)first;
+    ((ArrayState*)state)->vec.size -= count;
+}
+
+// Inserts at ranks[i] mod the length; the undo deletes at the same indexes, last first.
+static long array_insert(void *state, const BenchInput *in, int first, int count) {
+    Vector *vec = &((ArrayState*)state)->vec;
+    for (int i = first; i < first + count; i++) {
+        insert_element(vec, in->ranks[i] % (vec->size + 1), 2 * in->ranks[i] + 1);
+    }
+    return vec->size;
+}
+
+static void array_insert_undo(void *state, const BenchInput *in, int first, int count) {
+    Vector *vec = &((ArrayState*)state)->vec;
+    for (int i = first + count - 1; i >= first; i--) {
+        delete_element(vec, in->ranks[i] % vec->size);
+    }
+}
+
+static long array_delete(void *state, const BenchInput *in, int first, int count) {
+    ArrayState *s = (ArrayState*)state;
+    for (int i = first; i < first + count; i++) {
+        int index = in->ranks[i] % s->vec.size;
+        s->saved[i] = s->vec.data[index];
+        delete_element(&s->vec, index);
+    }
+    return s->vec.size;
+}
+
+static void array_delete_undo(void *state, const BenchInput *in, int first, int count) {
+    ArrayState *s = (ArrayState*)state;
+    for (int i = first + count - 1; i >= first; i--) {
+        insert_element(&s->vec, in->ranks[i] % (s->vec.size + 1), s->saved[i]);
+    }
+}
+
+static long array_find_hit(void *state, const BenchInput *in, int first, int count) {
+    const Vector *vec = &((ArrayState*)state)->vec;
+    long check = 0;
+    for (int i = first; i < first + count; i++) {
+        check += find_element(vec, 2 * in->ranks[i]);
+    }
+    return check;
+}
+
+static long array_find_miss(void *state, const BenchInput *in, int first, int count) {
+    const Vector *vec = &((ArrayState*)state)->vec;
+    long check = 0;
+    for (int i = first; i < first + count; i++) {
+        check += find_element(vec, 2 * in->ranks[i] + 1);
+    }
+    return check;
+}
+
+// Writes the value that is already there, so no undo is needed.
+static long array_update(void *state, const BenchInput *in, int first, int count) {
+    Vector *vec = &((ArrayState*)state)->vec;
+    for (int i = first; i < first + count; i++) {
+        int index = in->ranks[i] % vec->size;
+        update_element(vec, index, vec->data[index]);
+    }
+    return vec->size;
+}
+
+static long array_count(void *state, const BenchInput *in, int first, int count) {
+    const Vector *vec = &((ArrayState*)state)->vec;
+    long check = 0;
+    for (int i = first; i < first + count; i++) {
+        check += count_element(vec, 2 * in->ranks[i]);
+    }
+    return check;
+}
+
+static long array_min(void *state, const BenchInput *in, int first, int count) {
+    (void)in;
+    (void)first;
+    const Vector *vec = &((ArrayState*)state)->vec;
+    long check = 0;
+    for (int i = 0; i < count; i++) {
+        check += min_element(vec);
+    }
+    return check;
+}
+
+static long array_max(void *state, const BenchInput *in, int first, int count) {
+    (void)in;
+    (void)first;
+    const Vector *vec = &((ArrayState*)state)->vec;
+    long check = 0;
+    for (int i = 0; i < count; i++) {
+        check += max_element(vec);
+    }
+    return check;
+}
+
+static const BenchCase array_cases[] = {
+    { "push_back",      COST_CONSTANT, 0, array_build, array_push_back, array_pop_back,    array_destroy },
+    { "insert_element", COST_LINEAR,   0, array_build, array_insert,    array_insert_undo, array_destroy },
+    { "delete_element", COST_LINEAR,   0, array_build, array_delete,    array_delete_undo, array_destroy },
+    { "find_hit",       COST_LINEAR,   0, array_build, array_find_hit,  NULL,              array_destroy },
+    { "find_miss",      COST_LINEAR,   0, array_build, array_find_miss, NULL,              array_destroy },
+    { "update_element", COST_CONSTANT, 0, array_build, array_update,    NULL,              array_destroy },
+    { "count_element",  COST_LINEAR,   0, array_build, array_count,     NULL,              array_destroy },
+    { "min_element",    COST_LINEAR,   0, array_build, array_min,       NULL,              array_destroy },
+    { "max_element",    COST_LINEAR,   0, array_build, array_max,       NULL,              array_destroy },
+};
+
+// --- Main Function ---
+int main(int argc, char *argv[]) {
+    return harness_main(argc, argv, "array", array_cases, (int)(sizeof(array_cases) / sizeof(array_cases[0])));
+}
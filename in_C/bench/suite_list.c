@@ -0,0 +1,161 @@
+// This C program is the benchmark suite of the linked list operations: the doubly linked
+// list in DDL/DDL_first.c, or with -DSUITE_LIST_SLL the singly linked list in
+// SLL/SLL_FIRTS.c (the two programs share their function names, so one build holds one).
+// It runs every operation below at sizes 10^2 .. 10^max_exp, for the sorted, random and
+// zipfian workloads, and prints percentiles of the time per operation (see common/harness.h).
+//
+// Build:  gcc -O2 suite_list.c -o suite_list -lm   (add -DSUITE_LIST_SLL for suite_list_sll; or: make -C .. suite)
+// Usage:  ./suite_list [-f table|csv|json] [-m min_exp] [-M max_exp] [-r reps] [-b batches] [-s seed] [-w workloads] [-o operation] [-u budget] [-p prefix]
+
+#define _POSIX_C_SOURCE 200809L
+#define DS_NO_MAIN
+
+// --- Includes Section ---
+#ifdef SUITE_LIST_SLL
+#include "../SLL/SLL_FIRTS.c"
+#define LIST_NAME "sll"
+#else
+#include "../DDL/DDL_first.c"
+#define LIST_NAME "dll"
+#endif
+#include "../common/harness.h"
+
+// --- Struct Definitions ---
+typedef struct ListState {
+    List list;
+    Node *mark;                // Tail before an append batch, for its undo
+} ListState;
+
+// --- Cases ---
+
+// Builds a list of the n keys in insertion order.
+static void* list_build(const BenchInput *in) {
+    ListState *state = (ListState*)malloc(sizeof(ListState));
+    if (!state) {
+        printf("Memory allocation error!\n");
+        exit(1);
+    }
+    init_list(&state->list);
+    append_many(&state->list, in->keys, in->n);
+    return state;
+}
+
+static void list_destroy(void *state) {
+    ListState *s = (ListState*)state;
+    free_list(&s->list);
+    free(s);
+}
+
+static long list_append(void *state, const BenchInput *in, int first, int count) {
+    ListState *s = (ListState*)state;
+    s->mark = s->list.tail;
+    for (int i = first; i < first + count; i++) {
+        append(&s->list, 2 * in->ranks[i] + 1);
+    }
+    return s->list.length;
+}
+
+// Cuts the appended nodes off after the old tail; for the singly linked list, delete_at on
+// the last index would walk the whole list each time.
+static void list_append_undo(void *state, const BenchInput *in, int first, int count) {
+    (void)in;
+    (void)first;
+    ListState *s = (ListState*)state;
+    Node *node = s->mark->next;
+    while (node != NULL) {
+        Node *next = node->next;
+        slab_free(&node_pool, node);
+        node = next;
+    }
+    s->mark->next = NULL;
+    s->list.tail = s->mark;
+    s->list.length -= count;
+}
+
+// Inserts at ranks[i] mod the length; the undo deletes at the same indexes, last first.
+static long list_insert(void *state, const BenchInput *in, int first, int count) {
+    List *list = &((ListState*)state)->list;
+    for (int i = first; i < first + count; i++) {
+        insert_at(list, in->ranks[i] % (list->length + 1), 2 * in->ranks[i] + 1);
+    }
+    return list->length;
+}
+
+static void list_insert_undo(void *state, const BenchInput *in, int first, int count) {
+    List *list = &((ListState*)state)->list;
+    for (int i = first + count - 1; i >= first; i--) {
+        delete_at(list, in->ranks[i] % list->length);
+    }
+}
+
+// Deletes at ranks[i] mod the length. The undo puts a node back at each index; its value
+// differs from the deleted one, which no later batch of this case can notice.
+static long list_delete(void *state, const BenchInput *in, int first, int count) {
+    List *list = &((ListState*)state)->list;
+    for (int i = first; i < first + count; i++) {
+        delete_at(list, in->ranks[i] % list->length);
+    }
+    return list->length;
+}
+
+static void list_delete_undo(void *state, const BenchInput *in, int first, int count) {
+    List *list = &((ListState*)state)->list;
+    for (int i = first + count - 1; i >= first; i--) {
+        insert_at(list, in->ranks[i] % (list->length + 1), 2 * in->ranks[i]);
+    }
+}
+
+static long list_find_hit(void *state, const BenchInput *in, int first, int count) {
+    const List *list = &((ListState*)state)->list;
+    long check = 0;
+    for (int i = first; i < first + count; i++) {
+        check += find(list, 2 * in->ranks[i]) != NULL;
+    }
+    return check;
+}
+
+static long list_find_miss(void *state, const BenchInput *in, int first, int count) {
+    const List *list = &((ListState*)state)->list;
+    long check = 0;
+    for (int i = first; i < first + count; i++) {
+        check += find(list, 2 * in->ranks[i] + 1) != NULL;
+    }
+    return check;
+}
+
+// Overwrites the element at ranks[i] mod the length; no other case reads the values.
+static long list_update(void *state, const BenchInput *in, int first, int count) {
+    List *list = &((ListState*)state)->list;
+    for (int i = first; i < first + count; i++) {
+        update_at(list, in->ranks[i] % list->length, 2 * in->ranks[i]);
+    }
+    return list->length;
+}
+
+#ifndef SUITE_LIST_SLL
+static long list_node_at(void *state, const BenchInput *in, int first, int count) {
+    const List *list = &((ListState*)state)->list;
+    long check = 0;
+    for (int i = first; i < first + count; i++) {
+        check += node_at(list, in->ranks[i] % list->length)->data;
+    }
+    return check;
+}
+#endif
+
+static const BenchCase list_cases[] = {
+    { "append",    COST_CONSTANT, 0, list_build, list_append,    list_append_undo, list_destroy },
+    { "insert_at", COST_LINEAR,   0, list_build, list_insert,    list_insert_undo, list_destroy },
+    { "delete_at", COST_LINEAR,   0, list_build, list_delete,    list_delete_undo, list_destroy },
+    { "find_hit",  COST_LINEAR,   0, list_build, list_find_hit,  NULL,             list_destroy },
+    { "find_miss", COST_LINEAR,   0, list_build, list_find_miss, NULL,             list_destroy },
+    { "update_at", COST_LINEAR,   0, list_build, list_update,    NULL,             list_destroy },
+#ifndef SUITE_LIST_SLL
+    { "node_at",   COST_LINEAR,   0, list_build, list_node_at,   NULL,             list_destroy },
+#endif
+};
+
+// --- Main Function ---
+int main(int argc, char *argv[]) {
+    return harness_main(argc, argv, LIST_NAME, list_cases, (int)(sizeof(list_cases) / sizeof(list_cases[0])));
+}
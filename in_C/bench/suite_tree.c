@@ -0,0 +1,215 @@
+// This C program is the benchmark suite of the tree operations in TREE/simple.c: the AVL
+// operations, the order statistics and the in-order cursor, plus the plain (unbalanced)
+// binary search tree. It runs every operation below at sizes 10^2 .. 10^max_exp, for the
+// sorted, random and zipfian workloads, and prints percentiles of the time per operation
+// (see common/harness.h). The plain tree degenerates into a chain on sorted keys, so its
+// sorted rows stop at n = 10^3.
+//
+// Build:  gcc -O2 suite_tree.c -o suite_tree -lm   (or: make -C .. suite)
+// Usage:  ./suite_tree [-f table|csv|json] [-m min_exp] [-M max_exp] [-r reps] [-b batches] [-s seed] [-w workloads] [-o operation] [-u budget] [-p prefix]
+
+#define _POSIX_C_SOURCE 200809L
+#define DS_NO_MAIN
+
+// --- Includes Section ---
+#include "../TREE/simple.c"
+#include "../common/harness.h"
+
+#define PLAIN_SORTED_MAX 1000   // Sorted keys make every plain operation O(n), not O(log n)
+#define RANGE_WIDTH 128         // Keys spanned by one range_count
+
+// --- Struct Definitions ---
+typedef struct TreeState {
+    TreeNode *root;
+} TreeState;
+
+// --- Cases ---
+
+// Builds an AVL tree of the n keys, inserted in the workload's order.
+static void* avl_build(const BenchInput *in) {
+    TreeState *state = (TreeState*)malloc(sizeof(TreeState));
+    if (!state) {
+        printf("Memory allocation error!\n");
+        exit(1);
+    }
+    state->root = NULL;
+    for (int i = 0; i < in->n; i++) {
+        state->root = avl_insert(state->root, in->keys[i]);
+    }
+    return state;
+}
+
+// Builds the plain binary search tree the same way.
+static void* plain_build(const BenchInput *in) {
+    TreeState *state = (TreeState*)malloc(sizeof(TreeState));
+    if (!state) {
+        printf("Memory allocation error!\n");
+        exit(1);
+    }
+    state->root = NULL;
+    for (int i = 0; i < in->n; i++) {
+        state->root = insert(state->root, in->keys[i]);
+    }
+    return state;
+}
+
+static void tree_destroy(void *state) {
+    free_tree(((TreeState*)state)->root);
+    free(state);
+}
+
+// Inserts absent (odd) keys; the undo deletes them again.
+static long tree_avl_insert(void *state, const BenchInput *in, int first, int count) {
+    TreeState *s = (TreeState*)state;
+    for (int i = first; i < first + count; i++) {
+        s->root = avl_insert(s->root, 2 * in->ranks[i] + 1);
+    }
+    return node_size(s->root);
+}
+
+static void tree_avl_insert_undo(void *state, const BenchInput *in, int first, int count) {
+    TreeState *s = (TreeState*)state;
+    for (int i = first; i < first + count; i++) {
+        s->root = avl_delete(s->root, 2 * in->ranks[i] + 1);
+    }
+}
+
+// Deletes present (even) keys; the undo puts them back. A rank drawn twice is deleted once.
+static long tree_avl_delete(void *state, const BenchInput *in, int first, int count) {
+    TreeState *s = (TreeState*)state;
+    for (int i = first; i < first + count; i++) {
+        s->root = avl_delete(s->root, 2 * in->ranks[i]);
+    }
+    return node_size(s->root);
+}
+
+static void tree_avl_delete_undo(void *state, const BenchInput *in, int first, int count) {
+    TreeState *s = (TreeState*)state;
+    for (int i = first; i < first + count; i++) {
+        s->root = avl_insert(s->root, 2 * in->ranks[i]);
+    }
+}
+
+static long tree_plain_insert(void *state, const BenchInput *in, int first, int count) {
+    TreeState *s = (TreeState*)state;
+    for (int i = first; i < first + count; i++) {
+        s->root = insert(s->root, 2 * in->ranks[i] + 1);
+    }
+    return node_size(s->root);
+}
+
+static void tree_plain_insert_undo(void *state, const BenchInput *in, int first, int count) {
+    TreeState *s = (TreeState*)state;
+    for (int i = first; i < first + count; i++) {
+        s->root = delete(s->root, 2 * in->ranks[i] + 1);
+    }
+}
+
+static long tree_plain_delete(void *state, const BenchInput *in, int first, int count) {
+    TreeState *s = (TreeState*)state;
+    for (int i = first; i < first + count; i++) {
+        s->root = delete(s->root, 2 * in->ranks[i]);
+    }
+    return node_size(s->root);
+}
+
+static void tree_plain_delete_undo(void *state, const BenchInput *in, int first, int count) {
+    TreeState *s = (TreeState*)state;
+    for (int i = first; i < first + count; i++) {
+        s->root = insert(s->root, 2 * in->ranks[i]);
+    }
+}
+
+static long tree_find_hit(void *state, const BenchInput *in, int first, int count) {
+    TreeNode *root = ((TreeState*)state)->root;
+    long check = 0;
+    for (int i = first; i < first + count; i++) {
+        check += find(root, 2 * in->ranks[i]) != NULL;
+    }
+    return check;
+}
+
+static long tree_find_miss(void *state, const BenchInput *in, int first, int count) {
+    TreeNode *root = ((TreeState*)state)->root;
+    long check = 0;
+    for (int i = first; i < first + count; i++) {
+        check += find(root, 2 * in->ranks[i] + 1) != NULL;
+    }
+    return check;
+}
+
+static long tree_find_min(void *state, const BenchInput *in, int first, int count) {
+    (void)in;
+    (void)first;
+    TreeNode *root = ((TreeState*)state)->root;
+    long check = 0;
+    for (int i = 0; i < count; i++) {
+        check += find_min(root)->data;
+    }
+    return check;
+}
+
+static long tree_rank_case(void *state, const BenchInput *in, int first, int count) {
+    TreeNode *root = ((TreeState*)state)->root;
+    long check = 0;
+    for (int i = first; i < first + count; i++) {
+        check += tree_rank(root, 2 * in->ranks[i]);
+    }
+    return check;
+}
+
+static long tree_select_case(void *state, const BenchInput *in, int first, int count) {
+    TreeNode *root = ((TreeState*)state)->root;
+    long check = 0;
+    for (int i = first; i < first + count; i++) {
+        check += tree_select(root, in->ranks[i])->data;
+    }
+    return check;
+}
+
+static long tree_range_count(void *state, const BenchInput *in, int first, int count) {
+    TreeNode *root = ((TreeState*)state)->root;
+    long check = 0;
+    for (int i = first; i < first + count; i++) {
+        check += range_count(root, 2 * in->ranks[i], 2 * in->ranks[i] + RANGE_WIDTH);
+    }
+    return check;
+}
+
+// One full in-order walk with the cursor per operation.
+static long tree_walk(void *state, const BenchInput *in, int first, int count) {
+    (void)in;
+    (void)first;
+    TreeNode *root = ((TreeState*)state)->root;
+    long check = 0;
+    for (int i = 0; i < count; i++) {
+        TreeCursor cursor;
+        cursor_init(&cursor, root);
+        for (TreeNode *node = cursor_next(&cursor); node != NULL; node = cursor_next(&cursor)) {
+            check += node->data;
+        }
+        cursor_free(&cursor);
+    }
+    return check;
+}
+
+static const BenchCase tree_cases[] = {
+    { "avl_insert",   COST_LOG,    0, avl_build, tree_avl_insert,  tree_avl_insert_undo, tree_destroy },
+    { "avl_delete",   COST_LOG,    0, avl_build, tree_avl_delete,  tree_avl_delete_undo, tree_destroy },
+    { "find_hit",     COST_LOG,    0, avl_build, tree_find_hit,    NULL,                 tree_destroy },
+    { "find_miss",    COST_LOG,    0, avl_build, tree_find_miss,   NULL,                 tree_destroy },
+    { "find_min",     COST_LOG,    0, avl_build, tree_find_min,    NULL,                 tree_destroy },
+    { "rank",         COST_LOG,    0, avl_build, tree_rank_case,   NULL,                 tree_destroy },
+    { "select",       COST_LOG,    0, avl_build, tree_select_case, NULL,                 tree_destroy },
+    { "range_count",  COST_LOG,    0, avl_build, tree_range_count, NULL,                 tree_destroy },
+    { "inorder_walk", COST_LINEAR, 0, avl_build, tree_walk,        NULL,                 tree_destroy },
+    // Logarithmic on random keys, linear on sorted ones: the rows show the difference
+    { "plain_insert", COST_LOG, PLAIN_SORTED_MAX, plain_build, tree_plain_insert, tree_plain_insert_undo, tree_destroy },
+    { "plain_delete", COST_LOG, PLAIN_SORTED_MAX, plain_build, tree_plain_delete, tree_plain_delete_undo, tree_destroy },
+    { "plain_find",   COST_LOG, PLAIN_SORTED_MAX, plain_build, tree_find_hit,     NULL,                   tree_destroy },
+};
+
+// --- Main Function ---
+int main(int argc, char *argv[]) {
+    return harness_main(argc, argv, "tree", tree_cases, (int)(sizeof(tree_cases) / sizeof(tree_cases[0])));
+}
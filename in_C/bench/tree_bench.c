@@ -0,0 +1,91 @@
+// This C program benchmarks the plain binary search tree against the AVL tree from
+// TREE/simple.c. Both trees get the same sorted, reverse-sorted and random key streams,
+// and the program reports the final height and the average time of insert, find and delete.
+//
+// Build:  gcc -O2 tree_bench.c -o tree_bench
+// Usage:  ./tree_bench [n]   (default n = 20000; the plain tree is O(n^2) on sorted input)
+
+#define _POSIX_C_SOURCE 200809L
+#define DS_NO_MAIN
+
+// --- Includes Section ---
+#include "../TREE/simple.c"
+#include "../common/timer.h"
+
+// --- Key Streams ---
+enum { STREAM_SORTED, STREAM_REVERSE, STREAM_RANDOM };
+static const char *stream_names[] = { "sorted", "reverse", "random" };
+
+// Fills keys with 0..n-1 in the requested order.
+static void make_keys(int *keys, int n, int stream, uint64_t seed) {
+    for (int i = 0; i < n; i++) {
+        keys[i] = stream == STREAM_REVERSE ? n - 1 - i : i;
+    }
+    if (stream == STREAM_RANDOM) {
+        for (int i = n - 1; i > 0; i--) {  // Fisher-Yates shuffle
+            int j = (int)(xorshift64(&seed) % (uint64_t)(i + 1));
+            int temp = keys[i];
+            keys[i] = keys[j];
+            keys[j] = temp;
+        }
+    }
+}
+
+// --- Benchmark ---
+// Runs insert, find and delete for one tree type and prints one result row.
+static void bench_tree(const char *name, int balanced, const int *keys, const int *probes, int n,
+                       const char *stream) {
+    TreeNode *root = NULL;
+
+    uint64_t t0 = now_ns();
+    for (int i = 0; i < n; i++) {
+        root = balanced ? avl_insert(root, keys[i]) : insert(root, keys[i]);
+    }
+    uint64_t t1 = now_ns();
+    int height = tree_height(root);
+
+    long found = 0;
+    uint64_t t2 = now_ns();
+    for (int i = 0; i < n; i++) {
+        found += find(root, probes[i]) != NULL;
+    }
+    uint64_t t3 = now_ns();
+
+    for (int i = 0; i < n; i++) {
+        root = balanced ? avl_delete(root, keys[i]) : delete(root, keys[i]);
+    }
+    uint64_t t4 = now_ns();
+
+    printf("%-8s %-6s %10d %8d %12.1f %12.1f %12.1f %8ld\n", stream, name, n, height,
+           (double)(t1 - t0) / n, (double)(t3 - t2) / n, (double)(t4 - t3) / n, found);
+    slab_destroy(&node_pool);
+}
+
+// --- Main Function ---
+int main(int argc, char *argv[]) {
+    int n = 20000;
+    if (argc > 1) {
+        n = atoi(argv[1]);
+    }
+    if (n < 1) n = 1;
+
+    int *keys = (int*)malloc((size_t)n * sizeof(int));
+    int *probes = (int*)malloc((size_t)n * sizeof(int));
+    if (!keys || !probes) {
+        printf("Memory allocation error!\n");
+        return 1;
+    }
+    make_keys(probes, n, STREAM_RANDOM, 42);  // Lookups always come in random order
+
+    printf("%-8s %-6s %10s %8s %12s %12s %12s %8s\n", "stream", "tree", "n", "height",
+           "insert ns", "find ns", "delete ns", "found");
+    for (int stream = STREAM_SORTED; stream <= STREAM_RANDOM; stream++) {
+        make_keys(keys, n, stream, 7);
+        bench_tree("plain", 0, keys, probes, n, stream_names[stream]);
+        bench_tree("avl", 1, keys, probes, n, stream_names[stream]);
+    }
+
+    free(keys);
+    free(probes);
+    return 0;
+}
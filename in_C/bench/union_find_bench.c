@@ -0,0 +1,344 @@
+// This C program checks and benchmarks the union-find of array/union_find.c against a port
+// of the UnionFind of tricks.py (no union by size, the first root linked under the second,
+// full path compression). The port compresses in two loops instead of recursing, since a
+// recursion as deep as the chains it builds would overflow the stack.
+//
+// Edge streams over n vertices:
+//   random     m random edges: finds jump around the whole array, so this measures how
+//              many cache lines a find touches
+//   path       (i, i + 1) for i = 0, 1, ...: the tricks.py port links every old root under
+//              the new vertex and builds one chain of length n, the case a recursive find
+//              cannot survive; with iterative compression the port walks it once
+//   path_rev   (i + 1, i) for i = n - 2 .. 0, the same chain built from the other end
+//   binomial   (i, i + k) for i = 0, 2k, 4k, ... and k = 1, 2, 4, ...: the classical
+//              worst case of linking without sizes, trees of depth log2 n everywhere
+// On the chain streams every union of the port finds two roots at once, so they show the
+// fixed cost of each union (union by size, or the CAS of the concurrent version).
+//
+// Check: for small n and every stream (and a random stream that leaves many sets), the
+// sequential union-find and the concurrent one on 1 .. 4 threads (at most max_threads) must
+// give the same sets as the port: same count, same set sizes, and the same smallest vertex
+// for every set. The unions that report a join must add up to n - sets.
+//
+// Benchmark: per stream, the edges are ingested by the port, by uf_union and by
+// parallel_union_edges on 1, 2, 4, ... max_threads threads (pools started outside the
+// timing); then m random connected queries are timed on the port, uf_connected and
+// cuf_connected. Mops/s (edges or queries) and the speedup over the port are reported.
+//
+// Build:  gcc -O2 -pthread union_find_bench.c -o union_find_bench
+// Usage:  ./union_find_bench [n] [edges_per_vertex] [max_threads]   (defaults: 10000000, 2, 8)
+
+#define _POSIX_C_SOURCE 200809L
+#define DS_NO_MAIN
+
+// --- Includes Section ---
+#include "../array/union_find.c"
+#include "../common/timer.h"
+#include <string.h>
+
+// --- Struct Definitions ---
+typedef enum Stream {
+    STREAM_RANDOM,
+    STREAM_PATH,
+    STREAM_PATH_REVERSED,
+    STREAM_BINOMIAL,
+    STREAM_COUNT
+} Stream;
+
+static const char *stream_names[] = { "random", "path", "path_rev", "binomial" };
+
+// The tricks.py UnionFind: parent[x] == x for a root.
+typedef struct NaiveUnionFind {
+    int32_t *parent;
+    int32_t n;
+} NaiveUnionFind;
+
+// --- Port of tricks.py ---
+
+static void naive_init(NaiveUnionFind *uf, int32_t n) {
+    uf->parent = uf_alloc(n);
+    for (int32_t i = 0; i < n; i++) {
+        uf->parent[i] = i;
+    }
+    uf->n = n;
+}
+
+// Full path compression: find the root, then point the whole path at it.
+static int32_t naive_find(NaiveUnionFind *uf, int32_t x) {
+    int32_t root = x;
+    while (uf->parent[root] != root) {
+        root = uf->parent[root];
+    }
+    while (uf->parent[x] != root) {
+        int32_t next = uf->parent[x];
+        uf->parent[x] = root;
+        x = next;
+    }
+    return root;
+}
+
+static int naive_union(NaiveUnionFind *uf, int32_t p, int32_t q) {
+    int32_t root_p = naive_find(uf, p);
+    int32_t root_q = naive_find(uf, q);
+    if (root_p == root_q) {
+        return 0;
+    }
+    uf->parent[root_p] = root_q;
+    return 1;
+}
+
+// --- Helpers ---
+
+// Number of edges the stream has over n vertices (m is only used by the random stream).
+static long stream_edges(Stream stream, int32_t n, long m) {
+    if (stream == STREAM_RANDOM) {
+        return m;
+    }
+    return n > 0 ? n - 1 : 0;  // A spanning path or a binomial tree
+}
+
+// Fills edges with the stream; returns the number of edges written.
+static long fill_edges(int32_t *edges, Stream stream, int32_t n, long m, uint64_t seed) {
+    long count = 0;
+    switch (stream) {
+    case STREAM_RANDOM:
+        for (; count < m; count++) {
+            uint64_t r = xorshift64(&seed);
+            edges[2 * count] = (int32_t)((r & 0xFFFFFFFFu) % (uint32_t)n);
+            edges[2 * count + 1] = (int32_t)((r >> 32) % (uint32_t)n);
+        }
+        break;
+    case STREAM_PATH:
+        for (int32_t i = 0; i + 1 < n; i++, count++) {
+            edges[2 * count] = i;
+            edges[2 * count + 1] = i + 1;
+        }
+        break;
+    case STREAM_PATH_REVERSED:
+        for (int32_t i = n - 2; i >= 0; i--, count++) {
+            edges[2 * count] = i + 1;
+            edges[2 * count + 1] = i;
+        }
+        break;
+    default:
+        for (long k = 1; k < n; k *= 2) {
+            for (long i = 0; i + k < n; i += 2 * k, count++) {
+                edges[2 * count] = (int32_t)i;
+                edges[2 * count + 1] = (int32_t)(i + k);
+            }
+        }
+        break;
+    }
+    return count;
+}
+
+static int32_t* alloc_edges(long m) {
+    int32_t *edges = (int32_t*)malloc((size_t)(m > 0 ? m : 1) * 2 * sizeof(int32_t));
+    if (!edges) {
+        printf("Memory allocation error!\n");
+        exit(1);
+    }
+    return edges;
+}
+
+// Turns roots[v] (any representative per set) into the smallest vertex of v's set, and
+// returns the number of sets. smallest is scratch of n ints.
+static int32_t canonical_sets(int32_t *roots, int32_t *smallest, int32_t n) {
+    int32_t sets = 0;
+    for (int32_t v = 0; v < n; v++) {
+        smallest[v] = -1;
+    }
+    for (int32_t v = 0; v < n; v++) {
+        if (smallest[roots[v]] < 0) {
+            smallest[roots[v]] = v;  // v ascends, so the first vertex seen is the smallest
+            sets++;
+        }
+    }
+    for (int32_t v = 0; v < n; v++) {
+        roots[v] = smallest[roots[v]];
+    }
+    return sets;
+}
+
+// --- Check ---
+
+static long run_check(int max_threads) {
+    static const int32_t sizes[] = { 1, 2, 3, 100, 1000, 4097, 100000 };
+    int32_t max_n = 100000;
+    int32_t *edges = alloc_edges(4L * max_n);
+    int32_t *expected = uf_alloc(max_n);
+    int32_t *got = uf_alloc(max_n);
+    int32_t *scratch = uf_alloc(max_n);
+    long problems = 0;
+    for (int s = 0; s < (int)(sizeof(sizes) / sizeof(sizes[0])); s++) {
+        int32_t n = sizes[s];
+        // The extra round is a random stream with n / 2 edges, which leaves many sets
+        for (int round = 0; round <= STREAM_COUNT; round++) {
+            Stream stream = round == STREAM_COUNT ? STREAM_RANDOM : (Stream)round;
+            long m = fill_edges(edges, stream, n, round == STREAM_COUNT ? n / 2 : 2L * n,
+                                99u + (uint64_t)n + (uint64_t)round);
+
+            NaiveUnionFind naive;
+            naive_init(&naive, n);
+            for (long i = 0; i < m; i++) {
+                naive_union(&naive, edges[2 * i], edges[2 * i + 1]);
+            }
+            for (int32_t v = 0; v < n; v++) {
+                expected[v] = naive_find(&naive, v);
+            }
+            int32_t sets = canonical_sets(expected, scratch, n);
+
+            UnionFind uf;
+            uf_init(&uf, n);
+            long merged = 0;
+            for (long i = 0; i < m; i++) {
+                merged += uf_union(&uf, edges[2 * i], edges[2 * i + 1]);
+            }
+            for (int32_t v = 0; v < n; v++) {
+                got[v] = uf_find(&uf, v);
+            }
+            problems += canonical_sets(got, scratch, n) != sets || uf.sets != sets || merged != n - sets;
+            problems += memcmp(got, expected, (size_t)n * sizeof(int32_t)) != 0;
+            // Set sizes: count the members of every set under its smallest vertex
+            memset(scratch, 0, (size_t)n * sizeof(int32_t));
+            for (int32_t v = 0; v < n; v++) {
+                scratch[expected[v]]++;
+            }
+            for (int32_t v = 0; v < n; v++) {
+                problems += uf_set_size(&uf, v) != scratch[expected[v]];
+            }
+            uf_free(&uf);
+
+            for (int threads = 1; threads <= max_threads; threads++) {
+                WorkPool pool;
+                pool_init(&pool, threads);
+                ConcurrentUnionFind cuf;
+                cuf_init(&cuf, n);
+                merged = parallel_union_edges(&pool, &cuf, edges, m);
+                pool_free(&pool);
+                for (int32_t v = 0; v < n; v++) {
+                    got[v] = cuf_find(&cuf, v);
+                }
+                problems += cuf_count_sets(&cuf) != sets || merged != n - sets;
+                problems += canonical_sets(got, scratch, n) != sets;
+                problems += memcmp(got, expected, (size_t)n * sizeof(int32_t)) != 0;
+                for (int32_t v = 0; v + 1 < n; v++) {
+                    problems += cuf_connected(&cuf, v, v + 1) != (expected[v] == expected[v + 1]);
+                }
+                cuf_free(&cuf);
+            }
+            free(naive.parent);
+        }
+    }
+    free(edges);
+    free(expected);
+    free(got);
+    free(scratch);
+    return problems;
+}
+
+// --- Benchmark ---
+
+static void print_row(const char *stream, const char *method, long ops, uint64_t ns, uint64_t base_ns) {
+    printf("%-9s %-26s %10.1f %10.1f %8.2fx\n", stream, method, (double)ns / 1e6,
+           (double)ops / 1e6 / ((double)ns / 1e9), (double)base_ns / (double)ns);
+}
+
+static void bench_stream(Stream stream, int32_t n, long m, int max_threads) {
+    long count = stream_edges(stream, n, m);
+    int32_t *edges = alloc_edges(count);
+    fill_edges(edges, stream, n, m, 2024u + (uint64_t)stream);
+    int32_t *queries = alloc_edges(m);
+    fill_edges(queries, STREAM_RANDOM, n, m, 77u + (uint64_t)stream);
+    const char *name = stream_names[stream];
+
+    // Ingestion
+    NaiveUnionFind naive;
+    naive_init(&naive, n);
+    uint64_t t0 = now_ns();
+    for (long i = 0; i < count; i++) {
+        naive_union(&naive, edges[2 * i], edges[2 * i + 1]);
+    }
+    uint64_t base = now_ns() - t0;
+    print_row(name, "tricks.py port", count, base, base);
+
+    UnionFind uf;
+    uf_init(&uf, n);
+    t0 = now_ns();
+    for (long i = 0; i < count; i++) {
+        uf_union(&uf, edges[2 * i], edges[2 * i + 1]);
+    }
+    print_row(name, "uf_union", count, now_ns() - t0, base);
+
+    ConcurrentUnionFind cuf;
+    for (int threads = 1; threads <= max_threads; threads *= 2) {
+        WorkPool pool;
+        pool_init(&pool, threads);
+        cuf_init(&cuf, n);
+        t0 = now_ns();
+        parallel_union_edges(&pool, &cuf, edges, count);
+        uint64_t ns = now_ns() - t0;
+        pool_free(&pool);
+        char label[40];
+        snprintf(label, sizeof(label), "cuf_union, %d thread%s", threads, threads == 1 ? "" : "s");
+        print_row(name, label, count, ns, base);
+        if (cuf_count_sets(&cuf) != uf.sets) {
+            printf("Error: %s gave %d sets instead of %d.\n", label, cuf_count_sets(&cuf), uf.sets);
+            exit(1);
+        }
+        if (threads * 2 <= max_threads) {
+            cuf_free(&cuf);
+        }
+    }
+
+    // Random connected queries on the finished structures; the answers must agree
+    long yes[3] = { 0, 0, 0 };
+    t0 = now_ns();
+    for (long i = 0; i < m; i++) {
+        yes[0] += naive_find(&naive, queries[2 * i]) == naive_find(&naive, queries[2 * i + 1]);
+    }
+    uint64_t query_base = now_ns() - t0;
+    print_row(name, "queries, tricks.py port", m, query_base, query_base);
+    t0 = now_ns();
+    for (long i = 0; i < m; i++) {
+        yes[1] += uf_connected(&uf, queries[2 * i], queries[2 * i + 1]);
+    }
+    print_row(name, "queries, uf_connected", m, now_ns() - t0, query_base);
+    t0 = now_ns();
+    for (long i = 0; i < m; i++) {
+        yes[2] += cuf_connected(&cuf, queries[2 * i], queries[2 * i + 1]);
+    }
+    print_row(name, "queries, cuf_connected", m, now_ns() - t0, query_base);
+    if (yes[0] != yes[1] || yes[0] != yes[2]) {
+        printf("Error: the connected queries disagree.\n");
+        exit(1);
+    }
+
+    free(naive.parent);
+    uf_free(&uf);
+    cuf_free(&cuf);
+    free(edges);
+    free(queries);
+}
+
+// --- Main Function ---
+int main(int argc, char *argv[]) {
+    long n = argc > 1 ? atol(argv[1]) : 10000000;
+    long per_vertex = argc > 2 ? atol(argv[2]) : 2;
+    int max_threads = argc > 3 ? atoi(argv[3]) : 8;
+    if (n < 2 || n > INT32_MAX || per_vertex < 1 || max_threads < 1 || max_threads > POOL_MAX_THREADS) {
+        printf("Error: Bad arguments.\n");
+        return 1;
+    }
+
+    long problems = run_check(max_threads < 4 ? max_threads : 4);
+    printf("Check: %s (%ld problems)\n", problems == 0 ? "passed" : "FAILED", problems);
+
+    long m = n * per_vertex;
+    printf("\n%ld vertices, %ld random edges and queries\n", n, m);
+    printf("%-9s %-26s %10s %10s %9s\n", "edges", "method", "ms", "Mops/s", "vs port");
+    for (int s = 0; s < STREAM_COUNT; s++) {
+        bench_stream((Stream)s, (int32_t)n, m, max_threads);
+    }
+    return problems == 0 ? 0 : 1;
+}
@@ -0,0 +1,99 @@
+// This C program compares the one-int-per-node list from SLL/SLL_FIRTS.c with the unrolled
+// list from SLL/SLL_unrolled.c: build by append, full scans with find, random insert_at and
+// delete_at, and the memory each list takes for the same elements.
+//
+// Build:  gcc -O2 unrolled_bench.c -o unrolled_bench
+// Usage:  ./unrolled_bench [n] [repeats] [edits]   (defaults: n = 1000000, repeats = 20, edits = 2000)
+
+#define _POSIX_C_SOURCE 200809L
+#define DS_NO_MAIN
+
+// --- Includes Section ---
+#include "../SLL/SLL_FIRTS.c"
+#include "../SLL/SLL_unrolled.c"
+#include "../common/timer.h"
+
+// --- Main Function ---
+int main(int argc, char *argv[]) {
+    int n = argc > 1 ? atoi(argv[1]) : 1000000;
+    int repeats = argc > 2 ? atoi(argv[2]) : 20;
+    int edits = argc > 3 ? atoi(argv[3]) : 2000;
+    if (n < 1) n = 1;
+    if (repeats < 1) repeats = 1;
+    if (edits < 0) edits = 0;
+
+    List list;
+    UnrolledList unrolled;
+    init_list(&list);
+    unrolled_init(&unrolled);
+
+    // Build: n appends, values never negative so find(-1) scans everything
+    uint64_t seed = 42;
+    uint64_t t0 = now_ns();
+    for (int i = 0; i < n; i++) append(&list, (int)(xorshift64(&seed) % 1000000));
+    uint64_t t1 = now_ns();
+    seed = 42;
+    for (int i = 0; i < n; i++) unrolled_append(&unrolled, (int)(xorshift64(&seed) % 1000000));
+    uint64_t t2 = now_ns();
+    double build_sll = (double)(t1 - t0) / n, build_unrolled = (double)(t2 - t1) / n;
+
+    // Find: every call misses, so it walks the whole list
+    long misses = 0;
+    t0 = now_ns();
+    for (int r = 0; r < repeats; r++) misses += find(&list, -1) == NULL;
+    t1 = now_ns();
+    for (int r = 0; r < repeats; r++) misses += unrolled_find(&unrolled, -1) == NULL;
+    t2 = now_ns();
+    double find_sll = (double)(t1 - t0) / ((double)n * repeats);
+    double find_unrolled = (double)(t2 - t1) / ((double)n * repeats);
+
+    // Insert then delete at the same random positions; both lists walk to the position
+    int *positions = (int*)malloc((size_t)(edits > 0 ? edits : 1) * sizeof(int));
+    if (!positions) {
+        printf("Memory allocation error!\n");
+        return 1;
+    }
+    for (int i = 0; i < edits; i++) positions[i] = (int)(xorshift64(&seed) % (uint64_t)n);
+    t0 = now_ns();
+    for (int i = 0; i < edits; i++) insert_at(&list, positions[i], i);
+    for (int i = edits - 1; i >= 0; i--) delete_at(&list, positions[i]);
+    t1 = now_ns();
+    for (int i = 0; i < edits; i++) unrolled_insert_at(&unrolled, positions[i], i);
+    for (int i = edits - 1; i >= 0; i--) unrolled_delete_at(&unrolled, positions[i]);
+    t2 = now_ns();
+    double edit_sll = edits ? (double)(t1 - t0) / (2.0 * edits) : 0.0;
+    double edit_unrolled = edits ? (double)(t2 - t1) / (2.0 * edits) : 0.0;
+
+    // Memory: slab slots in use (blocks times slot size) per element. Every block must
+    // start on a cache line, or a scan of one block touches two lines.
+    long blocks = 0, misaligned = 0;
+    for (UnrolledNode *node = unrolled.head; node != NULL; node = node->next) {
+        blocks++;
+        misaligned += (uintptr_t)node % 64 != 0;
+    }
+    double bytes_sll = (double)node_pool.slot_size;
+    double bytes_unrolled = (double)blocks * unrolled_pool.slot_size / unrolled.length;
+
+    // Both lists must still hold the same sequence
+    int same = list.length == unrolled.length;
+    Node *a = list.head;
+    for (UnrolledNode *node = unrolled.head; same && node != NULL; node = node->next) {
+        for (int i = 0; i < node->count; i++, a = a->next) {
+            if (a->data != node->data[i]) same = 0;
+        }
+    }
+
+    printf("n = %d, %d find repeats, %d random insert_at + delete_at\n", n, repeats, edits);
+    printf("%-10s %12s %12s %14s %12s\n", "list", "append ns", "find ns/elem", "edit ns/op", "bytes/elem");
+    printf("%-10s %12.1f %12.3f %14.1f %12.1f\n", "SLL", build_sll, find_sll, edit_sll, bytes_sll);
+    printf("%-10s %12.1f %12.3f %14.1f %12.1f\n", "unrolled", build_unrolled, find_unrolled, edit_unrolled, bytes_unrolled);
+    printf("blocks %ld (%.1f ints per block, %ld not 64-byte aligned), misses %ld, contents %s\n", blocks,
+           (double)unrolled.length / blocks, misaligned, misses, same ? "match" : "DIFFER");
+
+    free(positions);
+    free_list(&list);
+    unrolled_free(&unrolled);
+    slab_destroy(&node_pool);
+    slab_destroy(&unrolled_pool);
+    return same && misaligned == 0 ? 0 : 1;
+}
@@ -0,0 +1,221 @@
+// This header implements the buffered output writer shared by the array, list and tree
+// programs. Printing one element with printf costs a format string parse, a stdio lock and
+// often a system call per element; the writer instead formats ints with a hand-rolled
+// conversion into one large buffer and hands the buffer to write(2) once per MiB.
+//
+// Two dump formats:
+//   DUMP_TEXT    one decimal int per line, which common/ingest.h reads back (INGEST_TEXT)
+//   DUMP_BINARY  raw 32-bit ints in the machine's byte order (INGEST_BINARY)
+// The print_ functions of the programs write their usual "1 -> 2 -> NULL" style text
+// through the same writer (dump_int and dump_text), on the shared stdout writer.
+//
+// Mixing with printf: stdout has its own stdio buffer, so dump_stdout flushes it before
+// handing out the writer, and the print_ functions flush the writer before they return.
+// Output therefore appears in program order.
+
+#ifndef DUMP_H
+#define DUMP_H
+
+// --- Includes Section ---
+#include <errno.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#define DUMP_BUFFER_BYTES (1 << 20)   // Bytes collected per write(2)
+#define DUMP_INT_BYTES 12             // Longest int text: "-2147483648" plus a separator
+
+enum { DUMP_TEXT = 0, DUMP_BINARY = 1 };
+
+// --- Struct Definitions ---
+typedef struct DumpWriter {
+    int fd;
+    int format;                // DUMP_TEXT or DUMP_BINARY, used by dump_value
+    int owns_fd;               // Opened by dump_create, closed by dump_close
+    int failed;                // Set by the first failed write
+    char *buffer;              // DUMP_BUFFER_BYTES bytes
+    size_t used;               // Bytes waiting in buffer
+} DumpWriter;
+
+// --- Writer Operations ---
+
+// 1. Init: O(1)
+// Sets up a writer on an open file descriptor (STDOUT_FILENO, a socket, ...).
+static inline void dump_init(DumpWriter *writer, int fd, int format) {
+    writer->buffer = (char*)malloc(DUMP_BUFFER_BYTES);
+    if (!writer->buffer) {
+        printf("Memory allocation error!\n");
+        exit(1);  // Exit if memory allocation fails
+    }
+    writer->fd = fd;
+    writer->format = format;
+    writer->owns_fd = 0;
+    writer->failed = 0;
+    writer->used = 0;
+}
+
+// 2. Create: O(1)
+// Creates (or truncates) path and sets up a writer on it.
+// Returns 0, or -1 (with an error message) if the file cannot be created.
+static inline int dump_create(DumpWriter *writer, const char *path, int format) {
+    int fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) {
+        printf("Error: Cannot create %s.\n", path);
+        return -1;
+    }
+    dump_init(writer, fd, format);
+    writer->owns_fd = 1;
+    return 0;
+}
+
+// Writes all of data straight to the file, retrying short writes. After a failure the
+// writer keeps accepting output but drops it, and dump_close reports the error.
+static inline void dump_write_all(DumpWriter *writer, const void *data, size_t bytes) {
+    const char *p = (const char*)data;
+    while (bytes > 0 && !writer->failed) {
+        ssize_t written = write(writer->fd, p, bytes);
+        if (written < 0 && errno == EINTR) {
+            continue;
+        }
+        if (written <= 0) {
+            writer->failed = 1;
+            break;
+        }
+        p += written;
+        bytes -= (size_t)written;
+    }
+}
+
+// 3. Flush: O(bytes buffered)
+// Writes the buffered bytes with one write(2).
+static inline void dump_flush(DumpWriter *writer) {
+    dump_write_all(writer, writer->buffer, writer->used);
+    writer->used = 0;
+}
+
+// Pairs of digits "00".."99", so the conversion below does one division per two digits.
+static const char dump_digit_pairs[201] =
+    "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+    "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+    "8081828384858687888990919293949596979899";
+
+// 4. Int to ASCII: O(digits)
+// Writes value in decimal at out (no terminating zero) and returns the number of bytes,
+// at most 11. The length is found first with comparisons, then the digits are written
+// right to left straight into out, two at a time from the pair table.
+static inline size_t dump_itoa(char *out, int value) {
+    uint32_t magnitude = value < 0 ? 0u - (uint32_t)value : (uint32_t)value;  // INT_MIN safe
+    size_t length = (size_t)(value < 0) + 1 + (magnitude >= 10) + (magnitude >= 100) +
+                    (magnitude >= 1000) + (magnitude >= 10000) + (magnitude >= 100000) +
+                    (magnitude >= 1000000) + (magnitude >= 10000000) +
+                    (magnitude >= 100000000) + (magnitude >= 1000000000);
+    char *p = out + length;
+    while (magnitude >= 100) {
+        uint32_t pair = magnitude % 100;
+        magnitude /= 100;
+        p -= 2;
+        memcpy(p, &dump_digit_pairs[pair * 2], 2);
+    }
+    if (magnitude >= 10) {
+        p -= 2;
+        memcpy(p, &dump_digit_pairs[magnitude * 2], 2);
+    } else {
+        *--p = (char)('0' + magnitude);
+    }
+    if (value < 0) {
+        out[0] = '-';
+    }
+    return length;
+}
+
+// 5. Write Int: O(1)
+// Appends value in decimal, with nothing after it.
+static inline void dump_int(DumpWriter *writer, int value) {
+    if (writer->used > DUMP_BUFFER_BYTES - DUMP_INT_BYTES) {
+        dump_flush(writer);
+    }
+    writer->used += dump_itoa(writer->buffer + writer->used, value);
+}
+
+// 6. Write Bytes: O(bytes)
+// Appends raw bytes. A block bigger than the buffer skips the copy and is written directly.
+static inline void dump_bytes(DumpWriter *writer, const void *data, size_t bytes) {
+    if (bytes == 0) {
+        return;
+    }
+    if (writer->used + bytes > DUMP_BUFFER_BYTES) {
+        dump_flush(writer);
+        if (bytes > DUMP_BUFFER_BYTES) {
+            dump_write_all(writer, data, bytes);
+            return;
+        }
+    }
+    memcpy(writer->buffer + writer->used, data, bytes);
+    writer->used += bytes;
+}
+
+// 7. Write Text: O(length)
+// Appends a string, such as the " -> " between printed elements.
+static inline void dump_text(DumpWriter *writer, const char *text) {
+    dump_bytes(writer, text, strlen(text));
+}
+
+// 8. Write Value: O(1)
+// Appends one element in the writer's dump format: a line of text, or 4 raw bytes.
+static inline void dump_value(DumpWriter *writer, int value) {
+    if (writer->used > DUMP_BUFFER_BYTES - DUMP_INT_BYTES) {
+        dump_flush(writer);
+    }
+    if (writer->format == DUMP_BINARY) {
+        int32_t raw = value;
+        memcpy(writer->buffer + writer->used, &raw, sizeof(raw));
+        writer->used += sizeof(raw);
+    } else {
+        writer->used += dump_itoa(writer->buffer + writer->used, value);
+        writer->buffer[writer->used++] = '\n';
+    }
+}
+
+// 9. Close: O(bytes buffered)
+// Flushes, releases the buffer and closes the file if dump_create opened it.
+// Returns 0, or -1 (with an error message) if any write failed.
+static inline int dump_close(DumpWriter *writer) {
+    dump_flush(writer);
+    int failed = writer->failed;
+    if (writer->owns_fd && close(writer->fd) != 0) {
+        failed = 1;
+    }
+    free(writer->buffer);
+    writer->buffer = NULL;
+    if (failed) {
+        printf("Error: Cannot write the dump.\n");
+        return -1;
+    }
+    return 0;
+}
+
+// 10. Shared Stdout Writer: O(1)
+// Returns the program's text writer on stdout, allocating its buffer on first use; the
+// buffer is then reused by every print_ call. Pending printf output is flushed first.
+// The caller flushes the writer (dump_flush) when it is done printing.
+static inline DumpWriter* dump_stdout(void) {
+    static DumpWriter writer;
+    static int ready = 0;
+    if (!ready) {
+        dump_init(&writer, STDOUT_FILENO, DUMP_TEXT);
+        ready = 1;
+    }
+    fflush(stdout);
+    return &writer;
+}
+
+// --- Big O Summary ---
+// 1. Init / Create / Close: O(1) - One allocation and at most one open and close.
+// 2. Write Int / Value: O(1) - At most 5 divisions by 100, no format string, no lock.
+// 3. Write Bytes / Text: O(bytes) - A memcpy into the buffer, or one direct write for big blocks.
+// 4. Flush: O(bytes) - One write(2) per MiB of output.
+
+#endif // DUMP_H
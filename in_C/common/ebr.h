@@ -0,0 +1,133 @@
+// This header implements epoch-based reclamation (EBR), shared by the concurrent list and
+// tree programs. In a lock-free structure a node that was just unlinked may still be read
+// by threads that were already walking over it, so it cannot be freed right away.
+//
+// A thread announces the global epoch when it starts an operation (ebr_enter) and clears
+// its active bit when it is done (ebr_exit). The global epoch can only move from E to E + 1
+// once every active thread has announced E. An unlinked node is tagged with the global
+// epoch read after the unlink; when the global epoch is two past that tag, every thread
+// that was active during the unlink has finished, so nobody can still hold a pointer to it.
+
+#ifndef EBR_H
+#define EBR_H
+
+// --- Includes Section ---
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdatomic.h>
+
+// Threads that may register with one domain, and retired nodes between two collections.
+#define EBR_MAX_THREADS 64
+#define EBR_COLLECT_EVERY 64
+
+// --- Struct Definitions ---
+// Every reclaimable node starts with this header, so free() on the header frees the node.
+typedef struct EbrNode {
+    struct EbrNode *next;          // Link in the owning thread's limbo list once retired
+    unsigned epoch;                // Global epoch at the time the node was unlinked
+} EbrNode;
+
+// Per-thread record. `state` is (epoch << 1) | active and is read by other threads, so
+// each record sits on its own cache line to avoid false sharing.
+typedef struct EbrThread {
+    _Alignas(64) _Atomic unsigned state;  // Epoch announced by this thread, plus the active bit
+    EbrNode *limbo;                // Nodes this thread retired, newest first
+    int limbo_count;               // Retires since the last collection
+} EbrThread;
+
+typedef struct EbrDomain {
+    _Atomic unsigned epoch;        // Global epoch
+    _Atomic int thread_count;      // Registered threads
+    EbrThread threads[EBR_MAX_THREADS];
+} EbrDomain;
+
+// --- EBR Operations ---
+
+// Sets up a domain with no registered threads. Not thread-safe.
+static inline void ebr_init(EbrDomain *domain) {
+    atomic_init(&domain->epoch, 0u);
+    atomic_init(&domain->thread_count, 0);
+    for (int i = 0; i < EBR_MAX_THREADS; i++) {
+        atomic_init(&domain->threads[i].state, 0u);
+        domain->threads[i].limbo = NULL;
+        domain->threads[i].limbo_count = 0;
+    }
+}
+
+// Every thread calls this once and passes the record to each operation. The record
+// lives until ebr_destroy.
+static inline EbrThread* ebr_register(EbrDomain *domain) {
+    int index = atomic_fetch_add(&domain->thread_count, 1);
+    if (index >= EBR_MAX_THREADS) {
+        printf("Error: Too many threads (max %d).\n", EBR_MAX_THREADS);
+        exit(1);
+    }
+    return &domain->threads[index];
+}
+
+static inline void ebr_enter(EbrDomain *domain, EbrThread *self) {
+    unsigned epoch = atomic_load(&domain->epoch);
+    atomic_store(&self->state, (epoch << 1) | 1u);
+}
+
+static inline void ebr_exit(EbrThread *self) {
+    atomic_store(&self->state, 0u);
+}
+
+// Moves the global epoch forward if every active thread has caught up with it.
+// `state` only keeps 31 bits of the epoch, so the comparison masks the top bit off.
+static inline void ebr_try_advance(EbrDomain *domain) {
+    unsigned epoch = atomic_load(&domain->epoch);
+    int count = atomic_load(&domain->thread_count);
+    for (int i = 0; i < count; i++) {
+        unsigned state = atomic_load(&domain->threads[i].state);
+        if ((state & 1u) && (state >> 1) != (epoch & 0x7FFFFFFFu)) {
+            return;  // A thread is still in an older epoch
+        }
+    }
+    atomic_compare_exchange_strong(&domain->epoch, &epoch, epoch + 1);
+}
+
+// Frees the nodes in this thread's limbo list whose tag is at least two epochs old.
+static inline void ebr_collect(EbrDomain *domain, EbrThread *self) {
+    ebr_try_advance(domain);
+    unsigned epoch = atomic_load(&domain->epoch);
+    EbrNode **link = &self->limbo;
+    while (*link != NULL) {
+        EbrNode *node = *link;
+        if (epoch - node->epoch >= 2) {
+            *link = node->next;
+            free(node);
+        } else {
+            link = &node->next;
+        }
+    }
+    self->limbo_count = 0;
+}
+
+// Called by the one thread whose write unlinked the node, inside ebr_enter / ebr_exit.
+static inline void ebr_retire(EbrDomain *domain, EbrThread *self, EbrNode *node) {
+    node->epoch = atomic_load(&domain->epoch);
+    node->next = self->limbo;
+    self->limbo = node;
+    if (++self->limbo_count >= EBR_COLLECT_EVERY) {
+        ebr_collect(domain, self);
+    }
+}
+
+// Frees every retired node. All threads must have stopped using the domain.
+static inline void ebr_destroy(EbrDomain *domain) {
+    for (int i = 0; i < EBR_MAX_THREADS; i++) {
+        EbrNode *node = domain->threads[i].limbo;
+        while (node != NULL) {
+            EbrNode *next = node->next;
+            free(node);
+            node = next;
+        }
+        domain->threads[i].limbo = NULL;
+        domain->threads[i].limbo_count = 0;
+    }
+    atomic_store(&domain->thread_count, 0);
+}
+
+#endif // EBR_H
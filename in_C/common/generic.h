@@ -0,0 +1,34 @@
+// This header holds the small pieces shared by the type-generic structure generators:
+// array/vector_gen.h, DDL/list_gen.h and TREE/tree_gen.h.
+//
+// Each generator is a macro that writes out a complete, type-specialized copy of one
+// structure, the way a C++ template is instantiated:
+//   DEFINE_TREE(PairTree, Pair, int64_t, PAIR_KEY, GEN_LESS)
+// defines PairTree, PairTreeNode and functions PairTree_insert, PairTree_find, ... that
+// store each Pair inside its node and compare keys with inline code. There is no void*
+// per element (no extra allocation, no pointer chase) and no comparator called through a
+// function pointer, so the int instantiation compiles to the same code as the
+// hand-written int programs.
+//
+// Every generator takes the same five arguments:
+//   Name    prefix for the generated types and functions
+//   T       element type stored in the structure (int, int64_t, a struct, ...)
+//   K       key type used by find / insert / delete
+//   KEY_OF  macro or function giving the key of an element, e.g. GEN_SELF or
+//           #define PAIR_KEY(p) ((p).key)
+//   LESS    macro or function, LESS(a, b) is nonzero when key a orders before key b;
+//           two keys are equal when neither is less than the other (GEN_EQUAL)
+
+#ifndef GENERIC_H
+#define GENERIC_H
+
+// KEY_OF for elements that are their own key (int, int64_t, double, ...)
+#define GEN_SELF(x) (x)
+
+// LESS for keys with a built-in < (integers, floating point, pointers)
+#define GEN_LESS(a, b) ((a) < (b))
+
+// Key equality derived from LESS. For integer keys the compiler folds it into one ==.
+#define GEN_EQUAL(LESS, a, b) (!LESS(a, b) && !LESS(b, a))
+
+#endif // GENERIC_H
@@ -0,0 +1,544 @@
+// This header is the benchmark harness behind the bench/suite_*.c programs. A suite lists
+// its operations as BenchCase entries; the harness runs every operation at every size and
+// workload shape with a fixed seed, repeats it, and reports percentiles of the time per
+// operation as a table, CSV or JSON.
+//
+// Measuring one operation:
+//   - build() makes a fresh structure of n keys (not timed), once per repetition
+//   - the operations are split into batches; each batch of run() calls is timed as a whole,
+//     which gives one sample (ns per operation), so the clock costs nothing per operation
+//   - undo() (not timed) puts a changed structure back after each batch, so every batch
+//     sees n elements; destroy() frees the structure at the end of the repetition
+// The percentiles are taken over all samples of all repetitions.
+//
+// Keys and probes: the structure holds the keys 0, 2, 4, ..., 2(n - 1); key k has rank k / 2.
+// Odd values are never present, so "miss" operations probe 2 * rank + 1. The workload
+// decides both the insertion order of the keys and the ranks the operations probe:
+//   sorted    keys inserted in ascending order, probes sweep the ranks in ascending order
+//   random    keys inserted in random order, probes draw ranks uniformly at random
+//   zipfian   keys inserted in random order, probes draw ranks from a Zipf(0.99) law,
+//             the popular ranks scattered over the key range (as in the YCSB workloads)
+// Positional operations (insert at an index, ...) use the probed rank modulo the length.
+//
+// Each operation states its documented complexity. The harness uses it to scale the number
+// of operations (so a sweep from 10^2 to 10^8 takes about the same time per size) and
+// reports ns_per_unit = p50 / f(n), with f(n) = 1, log2 n or n. When the documented
+// complexity is right, ns_per_unit stays roughly flat as n grows (cache effects aside).
+//
+// Built with -DDS_STATS (see common/stats.h), every row also tells where the time went:
+// nodes visited, allocations, frees and rotations per operation, counted over the timed
+// batches only. With -DDS_STATS_PERF as well, cycles and cache misses per operation come
+// from the hardware counters (-1 when the kernel does not provide them). The counters are
+// read between batches, outside the timed region.
+
+#ifndef HARNESS_H
+#define HARNESS_H
+
+// --- Includes Section ---
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>  // getopt
+#include "timer.h"
+#include "stats.h"
+
+#define HARNESS_MAX_OPS (1 << 20)     // Operations per repetition, at most
+#define HARNESS_ZIPF_THETA 0.99       // Skew of the zipfian workload (YCSB default)
+#define HARNESS_ZIPF_EXACT (1 << 20)  // Zeta terms summed one by one before the integral tail
+
+// --- Struct Definitions ---
+typedef enum Workload {
+    WORKLOAD_SORTED,
+    WORKLOAD_RANDOM,
+    WORKLOAD_ZIPFIAN,
+    WORKLOAD_COUNT
+} Workload;
+
+static const char *workload_names[] = { "sorted", "random", "zipfian" };
+
+// Documented cost of one operation, as a function of n.
+typedef enum BenchCost {
+    COST_CONSTANT,             // O(1)
+    COST_LOG,                  // O(log n)
+    COST_LINEAR                // O(n)
+} BenchCost;
+
+static const char *cost_names[] = { "O(1)", "O(log n)", "O(n)" };
+
+// What one repetition of an operation works on. keys and ranks belong to the harness.
+typedef struct BenchInput {
+    int n;                     // Keys in the structure
+    Workload workload;
+    const int *keys;           // The n keys in insertion order
+    const int *ranks;          // Probed ranks in [0, n), one per operation
+    int ops;                   // Operations in this repetition
+} BenchInput;
+
+// One operation of a structure. run and undo get the range [first, first + count) of
+// operations, and run returns a checksum so the compiler cannot drop the work.
+typedef struct BenchCase {
+    const char *name;
+    BenchCost cost;
+    int sorted_max;            // Largest n run with the sorted workload, 0 for no limit
+    void* (*build)(const BenchInput *in);
+    long (*run)(void *state, const BenchInput *in, int first, int count);
+    void (*undo)(void *state, const BenchInput *in, int first, int count);  // NULL if run changes nothing
+    void (*destroy)(void *state);
+} BenchCase;
+
+typedef enum HarnessFormat {
+    FORMAT_TABLE,
+    FORMAT_CSV,
+    FORMAT_JSON
+} HarnessFormat;
+
+typedef struct HarnessOptions {
+    int min_exp;               // Smallest size is 10^min_exp
+    int max_exp;               // Largest size is 10^max_exp
+    int reps;                  // Repetitions (fresh structure each)
+    int batches;               // Timed batches per repetition
+    uint64_t seed;
+    HarnessFormat format;
+    unsigned workloads;        // Bit w set: run workload w
+    const char *only;          // Run only the operation with this name (NULL for all)
+    const char *prefix;        // Also write prefix.csv and prefix.json (NULL for none)
+    double budget;             // Cost units per repetition (see harness_ops)
+} HarnessOptions;
+
+// Result of one (operation, workload, n) cell, in ns per operation.
+typedef struct BenchStats {
+    int ops;                   // Operations per repetition
+    double min, p50, p90, p99, mean;
+    long check;
+    DsStats counters;          // Summed over the timed batches (all 0 without DS_STATS)
+} BenchStats;
+
+// --- Workloads ---
+
+// Zipf sampler (Gray et al., "Quickly generating billion-record synthetic databases", as
+// used by YCSB): rank 0 is the most popular. Setup needs zeta(n) = sum 1 / i^theta; the
+// first terms are summed exactly and the rest from the integral, so it is cheap at 10^8.
+typedef struct ZipfGen {
+    double theta, alpha, zetan, eta;
+    int n;
+} ZipfGen;
+
+// 1. Zipf Init: O(min(n, 2^20))
+static inline void zipf_init(ZipfGen *zipf, int n, double theta) {
+    int exact = n < HARNESS_ZIPF_EXACT ? n : HARNESS_ZIPF_EXACT;
+    double zetan = 0.0;
+    for (int i = 1; i <= exact; i++) {
+        zetan += pow((double)i, -theta);
+    }
+    if (n > exact) {
+        zetan += (pow(n + 0.5, 1.0 - theta) - pow(exact + 0.5, 1.0 - theta)) / (1.0 - theta);
+    }
+    double zeta2 = 1.0 + pow(2.0, -theta);
+    zipf->theta = theta;
+    zipf->alpha = 1.0 / (1.0 - theta);
+    zipf->zetan = zetan;
+    zipf->eta = (1.0 - pow(2.0 / n, 1.0 - theta)) / (1.0 - zeta2 / zetan);
+    zipf->n = n;
+}
+
+// 2. Zipf Next: O(1)
+static inline int zipf_next(const ZipfGen *zipf, uint64_t *seed) {
+    double u = (double)(xorshift64(seed) >> 11) * (1.0 / 9007199254740992.0);  // [0, 1)
+    double uz = u * zipf->zetan;
+    if (uz < 1.0) {
+        return 0;
+    }
+    if (uz < 1.0 + pow(0.5, zipf->theta)) {
+        return zipf->n > 1 ? 1 : 0;
+    }
+    int rank = (int)(zipf->n * pow(zipf->eta * u - zipf->eta + 1.0, zipf->alpha));
+    return rank < zipf->n ? rank : zipf->n - 1;
+}
+
+// 3. Make Keys: O(n)
+// Fills keys with 0, 2, ..., 2(n - 1) in the workload's insertion order.
+static inline void harness_make_keys(int *keys, int n, Workload workload, uint64_t seed) {
+    for (int i = 0; i < n; i++) {
+        keys[i] = 2 * i;
+    }
+    if (workload != WORKLOAD_SORTED) {
+        for (int i = n - 1; i > 0; i--) {  // Fisher-Yates shuffle
+            int j = (int)(xorshift64(&seed) % (uint64_t)(i + 1));
+            int temp = keys[i];
+            keys[i] = keys[j];
+            keys[j] = temp;
+        }
+    }
+}
+
+// 4. Make Ranks: O(count)
+// Fills ranks with the workload's probe sequence over [0, n).
+static inline void harness_make_ranks(int *ranks, int count, int n, Workload workload, uint64_t seed) {
+    if (workload == WORKLOAD_SORTED) {
+        for (int i = 0; i < count; i++) {
+            ranks[i] = i % n;
+        }
+    } else if (workload == WORKLOAD_RANDOM) {
+        for (int i = 0; i < count; i++) {
+            ranks[i] = (int)(xorshift64(&seed) % (uint64_t)n);
+        }
+    } else {
+        ZipfGen zipf;
+        zipf_init(&zipf, n, HARNESS_ZIPF_THETA);
+        for (int i = 0; i < count; i++) {
+            // 2654435761 is prime, so the multiply scatters the hot ranks without collisions
+            ranks[i] = (int)((uint64_t)zipf_next(&zipf, &seed) * 2654435761u % (uint64_t)n);
+        }
+    }
+}
+
+// --- Measurement ---
+
+// Cost units of one operation at size n: 1, log2 n or n.
+static inline double harness_units(BenchCost cost, int n) {
+    if (cost == COST_CONSTANT) {
+        return 1.0;
+    }
+    if (cost == COST_LOG) {
+        return n > 1 ? log2((double)n) : 1.0;
+    }
+    return (double)n;
+}
+
+// 5. Operation Count: O(1)
+// Picks the operations per repetition so they cost about `budget` units, with at least one
+// per batch. An operation with undo never changes the size by more than n / 2 per batch.
+static inline int harness_ops(const BenchCase *bc, int n, const HarnessOptions *opt) {
+    double ops = opt->budget / harness_units(bc->cost, n);
+    if (ops > HARNESS_MAX_OPS) {
+        ops = HARNESS_MAX_OPS;
+    }
+    if (bc->undo != NULL && ops > (double)opt->batches * (n / 2 > 0 ? n / 2 : 1)) {
+        ops = (double)opt->batches * (n / 2 > 0 ? n / 2 : 1);
+    }
+    return ops < opt->batches ? opt->batches : (int)ops;
+}
+
+static int harness_compare_double(const void *a, const void *b) {
+    double x = *(const double*)a, y = *(const double*)b;
+    return (x > y) - (x < y);
+}
+
+// Nearest-rank percentile of sorted samples.
+static inline double harness_percentile(const double *sorted, int count, double p) {
+    int i = (int)ceil(p / 100.0 * count) - 1;
+    return sorted[i < 0 ? 0 : (i >= count ? count - 1 : i)];
+}
+
+#ifdef DS_STATS
+// Adds the counters of one batch to the sum; a hardware counter missing once stays -1.
+static inline void harness_add_counters(DsStats *sum, const DsStats *batch) {
+    sum->nodes_visited += batch->nodes_visited;
+    sum->allocs += batch->allocs;
+    sum->frees += batch->frees;
+    sum->rotations += batch->rotations;
+    sum->cycles = sum->cycles < 0 || batch->cycles < 0 ? -1 : sum->cycles + batch->cycles;
+    sum->cache_misses = sum->cache_misses < 0 || batch->cache_misses < 0 ? -1
+                        : sum->cache_misses + batch->cache_misses;
+}
+#endif
+
+// 6. Run Case: O(reps * (build + ops))
+// Measures one operation at one size and workload. Returns 0 if the case is skipped.
+static inline int harness_run_case(const BenchCase *bc, BenchInput *in, const HarnessOptions *opt,
+                                   BenchStats *stats) {
+    if (bc->sorted_max > 0 && in->workload == WORKLOAD_SORTED && in->n > bc->sorted_max) {
+        return 0;
+    }
+    in->ops = harness_ops(bc, in->n, opt);
+    int per_batch = (in->ops + opt->batches - 1) / opt->batches;
+    int batches = (in->ops + per_batch - 1) / per_batch;
+    double *samples = (double*)malloc((size_t)opt->reps * (size_t)batches * sizeof(double));
+    if (!samples) {
+        printf("Memory allocation error!\n");
+        exit(1);
+    }
+    int count = 0;
+    double total = 0.0;
+    stats->check = 0;
+    memset(&stats->counters, 0, sizeof(stats->counters));
+#ifdef DS_STATS
+    ds_stats_reset();
+#endif
+    for (int rep = 0; rep < opt->reps; rep++) {
+        void *state = bc->build(in);
+        for (int first = 0; first < in->ops; first += per_batch) {
+            int batch = in->ops - first < per_batch ? in->ops - first : per_batch;
+#ifdef DS_STATS
+            DsStats before, after, delta;
+            ds_stats_snapshot(&before);
+#endif
+            uint64_t t0 = now_ns();
+            stats->check += bc->run(state, in, first, batch);
+            uint64_t t1 = now_ns();
+#ifdef DS_STATS
+            ds_stats_snapshot(&after);
+            ds_stats_delta(&after, &before, &delta);
+            harness_add_counters(&stats->counters, &delta);
+#endif
+            samples[count++] = (double)(t1 - t0) / batch;
+            total += (double)(t1 - t0);
+            if (bc->undo != NULL) {
+                bc->undo(state, in, first, batch);
+            }
+        }
+        bc->destroy(state);
+    }
+    qsort(samples, (size_t)count, sizeof(double), harness_compare_double);
+    stats->ops = in->ops;
+    stats->min = samples[0];
+    stats->p50 = harness_percentile(samples, count, 50);
+    stats->p90 = harness_percentile(samples, count, 90);
+    stats->p99 = harness_percentile(samples, count, 99);
+    stats->mean = total / ((double)in->ops * opt->reps);
+    free(samples);
+    return 1;
+}
+
+// --- Output ---
+
+#ifdef DS_STATS
+// Average of a summed counter over every timed operation, -1 when it was not measured.
+static inline double harness_per_op(int64_t total, const BenchStats *s, int reps) {
+    return total < 0 ? -1.0 : (double)total / ((double)s->ops * reps);
+}
+
+// Appends the counter columns of one row (DS_STATS builds only).
+static inline void harness_emit_counters(FILE *out, HarnessFormat format, const BenchStats *s, int reps) {
+    const DsStats *c = &s->counters;
+    double visits = harness_per_op((int64_t)c->nodes_visited, s, reps);
+    double allocs = harness_per_op((int64_t)c->allocs, s, reps);
+    double frees = harness_per_op((int64_t)c->frees, s, reps);
+    double rotations = harness_per_op((int64_t)c->rotations, s, reps);
+    double cycles = harness_per_op(c->cycles, s, reps);
+    double misses = harness_per_op(c->cache_misses, s, reps);
+    if (format == FORMAT_CSV) {
+        fprintf(out, ",%.4g,%.4g,%.4g,%.4g,%.4g,%.4g", visits, allocs, frees, rotations, cycles, misses);
+    } else if (format == FORMAT_JSON) {
+        fprintf(out, ", \"visits_per_op\": %.4g, \"allocs_per_op\": %.4g, \"frees_per_op\": %.4g, "
+                     "\"rotations_per_op\": %.4g, \"cycles_per_op\": %.4g, \"cache_misses_per_op\": %.4g",
+                visits, allocs, frees, rotations, cycles, misses);
+    } else {
+        fprintf(out, " %9.4g %7.3g %7.3g %7.3g %9.4g %8.3g", visits, allocs, frees, rotations, cycles, misses);
+    }
+}
+#endif
+
+// 7. Begin Output: O(1)
+// Writes the header of the chosen format.
+static inline void harness_begin(FILE *out, HarnessFormat format, const char *structure,
+                                 const HarnessOptions *opt) {
+    if (format == FORMAT_CSV) {
+        fprintf(out, "structure,operation,workload,n,cost,ops,reps,min_ns,p50_ns,p90_ns,p99_ns,mean_ns,"
+                     "ns_per_unit,check");
+#ifdef DS_STATS
+        fprintf(out, ",visits_per_op,allocs_per_op,frees_per_op,rotations_per_op,cycles_per_op,"
+                     "cache_misses_per_op");
+#endif
+        fprintf(out, "\n");
+    } else if (format == FORMAT_JSON) {
+        fprintf(out, "{\n  \"structure\": \"%s\",\n  \"seed\": %llu,\n  \"results\": [\n", structure,
+                (unsigned long long)opt->seed);
+    } else {
+        fprintf(out, "seed %llu, %d repetitions x %d batches, percentiles of ns per operation\n",
+                (unsigned long long)opt->seed, opt->reps, opt->batches);
+        fprintf(out, "%-6s %-16s %-8s %10s %-9s %8s %10s %10s %10s %10s %10s", "struct", "operation",
+                "workload", "n", "cost", "ops", "min", "p50", "p90", "p99", "ns/unit");
+#ifdef DS_STATS
+        fprintf(out, " %9s %7s %7s %7s %9s %8s", "visits", "allocs", "frees", "rotates", "cycles", "misses");
+#endif
+        fprintf(out, "\n");
+    }
+}
+
+// 8. Emit Row: O(1)
+// Writes one result. JSON rows go inside the "results" array, separated by commas.
+static inline void harness_emit(FILE *out, HarnessFormat format, const char *structure, const BenchCase *bc,
+                                const BenchInput *in, const BenchStats *s, int reps, int first_row) {
+    double per_unit = s->p50 / harness_units(bc->cost, in->n);
+    if (format == FORMAT_CSV) {
+        fprintf(out, "%s,%s,%s,%d,%s,%d,%d,%.1f,%.1f,%.1f,%.1f,%.1f,%.4g,%ld", structure, bc->name,
+                workload_names[in->workload], in->n, cost_names[bc->cost], s->ops, reps,
+                s->min, s->p50, s->p90, s->p99, s->mean, per_unit, s->check);
+    } else if (format == FORMAT_JSON) {
+        fprintf(out, "%s    {\"structure\": \"%s\", \"operation\": \"%s\", \"workload\": \"%s\", \"n\": %d, "
+                     "\"cost\": \"%s\", \"ops\": %d, \"reps\": %d, \"min_ns\": %.1f, \"p50_ns\": %.1f, "
+                     "\"p90_ns\": %.1f, \"p99_ns\": %.1f, \"mean_ns\": %.1f, \"ns_per_unit\": %.4g, \"check\": %ld",
+                first_row ? "" : ",\n", structure, bc->name, workload_names[in->workload], in->n,
+                cost_names[bc->cost], s->ops, reps, s->min, s->p50, s->p90, s->p99, s->mean,
+                per_unit, s->check);
+    } else {
+        fprintf(out, "%-6s %-16s %-8s %10d %-9s %8d %10.1f %10.1f %10.1f %10.1f %10.4g", structure, bc->name,
+                workload_names[in->workload], in->n, cost_names[bc->cost], s->ops, s->min, s->p50,
+                s->p90, s->p99, per_unit);
+    }
+#ifdef DS_STATS
+    harness_emit_counters(out, format, s, reps);
+#endif
+    fprintf(out, format == FORMAT_JSON ? "}" : "\n");
+    fflush(out);
+}
+
+// 9. End Output: O(1)
+// Closes the JSON document; the other formats need no footer.
+static inline void harness_end(FILE *out, HarnessFormat format, int rows) {
+    if (format == FORMAT_JSON) {
+        fprintf(out, "%s  ]\n}\n", rows > 0 ? "\n" : "");
+    }
+}
+
+// Opens prefix + suffix for writing, or exits.
+static inline FILE* harness_open(const char *prefix, const char *suffix) {
+    char path[4096];
+    snprintf(path, sizeof(path), "%s%s", prefix, suffix);
+    FILE *file = fopen(path, "w");
+    if (!file) {
+        printf("Error: Cannot open %s.\n", path);
+        exit(1);
+    }
+    return file;
+}
+
+static inline void harness_usage(const char *program) {
+    printf("Usage: %s [-f table|csv|json] [-m min_exp] [-M max_exp] [-r reps] [-b batches]\n"
+           "          [-s seed] [-w sorted,random,zipfian] [-o operation] [-u budget] [-p prefix]\n"
+           "Sizes are 10^min_exp .. 10^max_exp (defaults 2 .. 6, at most 8).\n"
+           "With -p the results also go to prefix.csv and prefix.json.\n", program);
+}
+
+// Parses the options; returns 0 after printing the usage if they are not valid.
+static inline int harness_parse(int argc, char *argv[], HarnessOptions *opt) {
+    opt->min_exp = 2;
+    opt->max_exp = 6;
+    opt->reps = 5;
+    opt->batches = 16;
+    opt->seed = 42;
+    opt->format = FORMAT_TABLE;
+    opt->workloads = (1u << WORKLOAD_COUNT) - 1;
+    opt->only = NULL;
+    opt->prefix = NULL;
+    opt->budget = 4e6;
+    int c;
+    while ((c = getopt(argc, argv, "f:m:M:r:b:s:w:o:u:p:h")) != -1) {
+        switch (c) {
+        case 'f':
+            if (strcmp(optarg, "csv") == 0) {
+                opt->format = FORMAT_CSV;
+            } else if (strcmp(optarg, "json") == 0) {
+                opt->format = FORMAT_JSON;
+            } else if (strcmp(optarg, "table") == 0) {
+                opt->format = FORMAT_TABLE;
+            } else {
+                harness_usage(argv[0]);
+                return 0;
+            }
+            break;
+        case 'm': opt->min_exp = atoi(optarg); break;
+        case 'M': opt->max_exp = atoi(optarg); break;
+        case 'r': opt->reps = atoi(optarg); break;
+        case 'b': opt->batches = atoi(optarg); break;
+        case 's': opt->seed = strtoull(optarg, NULL, 10); break;
+        case 'o': opt->only = optarg; break;
+        case 'u': opt->budget = atof(optarg); break;
+        case 'p': opt->prefix = optarg; break;
+        case 'w':
+            opt->workloads = 0;
+            for (int w = 0; w < WORKLOAD_COUNT; w++) {
+                if (strstr(optarg, workload_names[w]) != NULL) {
+                    opt->workloads |= 1u << w;
+                }
+            }
+            break;
+        default:
+            harness_usage(argv[0]);
+            return 0;
+        }
+    }
+    if (opt->min_exp < 1 || opt->max_exp > 8 || opt->min_exp > opt->max_exp || opt->reps < 1 ||
+        opt->batches < 1 || opt->budget <= 0 || opt->workloads == 0) {
+        harness_usage(argv[0]);
+        return 0;
+    }
+    return 1;
+}
+
+// 10. Harness Main: O(sizes * workloads * cases)
+// Runs every case of a suite and writes the results. Returns the exit status for main.
+static inline int harness_main(int argc, char *argv[], const char *structure, const BenchCase *cases,
+                               int case_count) {
+    HarnessOptions opt;
+    if (!harness_parse(argc, argv, &opt)) {
+        return 1;
+    }
+    FILE *csv = opt.prefix != NULL ? harness_open(opt.prefix, ".csv") : NULL;
+    FILE *json = opt.prefix != NULL ? harness_open(opt.prefix, ".json") : NULL;
+    harness_begin(stdout, opt.format, structure, &opt);
+    if (csv != NULL) {
+        harness_begin(csv, FORMAT_CSV, structure, &opt);
+        harness_begin(json, FORMAT_JSON, structure, &opt);
+    }
+
+    int rows = 0;
+    int n = 1;
+    for (int e = 0; e < opt.min_exp; e++) {
+        n *= 10;
+    }
+    for (int e = opt.min_exp; e <= opt.max_exp; e++, n *= 10) {
+        int *keys = (int*)malloc((size_t)n * sizeof(int));
+        int *ranks = (int*)malloc((size_t)HARNESS_MAX_OPS * sizeof(int));
+        if (!keys || !ranks) {
+            printf("Memory allocation error!\n");
+            exit(1);
+        }
+        for (int w = 0; w < WORKLOAD_COUNT; w++) {
+            if (!(opt.workloads & (1u << w))) {
+                continue;
+            }
+            // The same seed gives the same keys and probes for every structure
+            uint64_t seed = opt.seed * 1000003u + (uint64_t)n * 31u + (uint64_t)w;
+            harness_make_keys(keys, n, (Workload)w, seed);
+            harness_make_ranks(ranks, HARNESS_MAX_OPS, n, (Workload)w, seed ^ 0x9E3779B97F4A7C15ull);
+            BenchInput in = { n, (Workload)w, keys, ranks, 0 };
+            for (int c = 0; c < case_count; c++) {
+                if (opt.only != NULL && strcmp(opt.only, cases[c].name) != 0) {
+                    continue;
+                }
+                BenchStats stats;
+                if (!harness_run_case(&cases[c], &in, &opt, &stats)) {
+                    continue;
+                }
+                harness_emit(stdout, opt.format, structure, &cases[c], &in, &stats, opt.reps, rows == 0);
+                if (csv != NULL) {
+                    harness_emit(csv, FORMAT_CSV, structure, &cases[c], &in, &stats, opt.reps, rows == 0);
+                    harness_emit(json, FORMAT_JSON, structure, &cases[c], &in, &stats, opt.reps, rows == 0);
+                }
+                rows++;
+            }
+        }
+        free(keys);
+        free(ranks);
+    }
+    harness_end(stdout, opt.format, rows);
+    if (csv != NULL) {
+        harness_end(json, FORMAT_JSON, rows);
+        fclose(csv);
+        fclose(json);
+    }
+    return 0;
+}
+
+// --- Big O Summary ---
+// 1. Zipf Init: O(min(n, 2^20)) - Exact zeta terms, then the integral tail.
+// 2. Zipf Next / Operation Count / Output: O(1) per row.
+// 3. Make Keys: O(n) - One Fisher-Yates shuffle; Make Ranks: O(ops).
+// 4. Run Case: O(reps * (build + ops)) - Plus one sort of the samples.
+// 5. Harness Main: every size x workload x case, each keys array built once per size and workload.
+
+#endif // HARNESS_H
@@ -0,0 +1,246 @@
+// This header implements an open-addressing hash table from int values to a reference
+// (a node pointer or an array position). The list and array programs use it as an optional
+// index that turns their O(n) find into an O(1) expected lookup.
+//
+// Layout (SwissTable style): the entries sit in one array, and next to it is an array of
+// one control byte per entry:
+//   HASH_EMPTY    0x80    never used, a lookup can stop here
+//   HASH_DELETED  0xFE    erased (a tombstone), a lookup must look past it
+//   0x00..0x7F            in use, the low 7 bits of the key's hash ("h2")
+// A lookup starts at the position given by the other hash bits and reads 16 control bytes
+// at once. One SSE2 compare finds the bytes equal to h2, so only entries whose 7 hash bits
+// already match are compared in full (1 in 128 false hits), and a second compare finds an
+// empty byte, which ends the search. Without SSE2 the 16 bytes are checked in a loop.
+// The table grows (doubles) before it is 7/8 full, so every probe meets an empty byte.
+//
+// An entry stores one distinct value: how often it occurs and where the first occurrence
+// is. Keeping that reference right on insert and delete is the structure's job; this
+// header only stores it.
+
+#ifndef HASH_INDEX_H
+#define HASH_INDEX_H
+
+// --- Includes Section ---
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__SSE2__)
+#define HASH_INDEX_SSE2 1
+#include <emmintrin.h>
+#endif
+
+#define HASH_GROUP 16                 // Control bytes read per probe step
+#define HASH_MIN_CAPACITY 16          // Smallest table (one group)
+#define HASH_EMPTY ((int8_t)-128)     // 0x80
+#define HASH_DELETED ((int8_t)-2)     // 0xFE
+
+// --- Struct Definitions ---
+typedef struct HashEntry {
+    int key;                   // The value being indexed
+    int count;                 // How many elements hold it
+    intptr_t ref;              // First occurrence: a node pointer or an array position
+} HashEntry;
+
+typedef struct HashIndex {
+    int8_t *ctrl;              // capacity + HASH_GROUP control bytes; the last group mirrors the first
+    HashEntry *entries;        // capacity entries
+    size_t capacity;           // Power of two, 0 before the first insert
+    size_t size;               // Entries in use
+    size_t growth_left;        // Inserts left before the table must grow or be cleaned
+} HashIndex;
+
+// --- Hashing ---
+
+// Mixes all 32 bits of the key into 64 (multiply, then fold the high half into the low
+// half), so neighbouring values land far apart.
+static inline uint64_t hash_index_hash(int key) {
+    uint64_t h = (uint64_t)(uint32_t)key * 0x9E3779B97F4A7C15ull;
+    return h ^ (h >> 32);
+}
+
+// Bit i of the result is set when ctrl[i] == byte, for the 16 bytes at ctrl.
+static inline unsigned hash_group_match(const int8_t *ctrl, int8_t byte) {
+#ifdef HASH_INDEX_SSE2
+    __m128i group = _mm_loadu_si128((const __m128i*)ctrl);
+    return (unsigned)_mm_movemask_epi8(_mm_cmpeq_epi8(group, _mm_set1_epi8(byte)));
+#else
+    unsigned mask = 0;
+    for (int i = 0; i < HASH_GROUP; i++) {
+        mask |= (unsigned)(ctrl[i] == byte) << i;
+    }
+    return mask;
+#endif
+}
+
+// Bit i is set when ctrl[i] is empty or deleted (both are negative and below -1).
+static inline unsigned hash_group_free(const int8_t *ctrl) {
+#ifdef HASH_INDEX_SSE2
+    __m128i group = _mm_loadu_si128((const __m128i*)ctrl);
+    return (unsigned)_mm_movemask_epi8(_mm_cmplt_epi8(group, _mm_set1_epi8(-1)));
+#else
+    unsigned mask = 0;
+    for (int i = 0; i < HASH_GROUP; i++) {
+        mask |= (unsigned)(ctrl[i] < -1) << i;
+    }
+    return mask;
+#endif
+}
+
+// Writes a control byte, and its mirror when it is in the first group.
+static inline void hash_set_ctrl(HashIndex *index, size_t i, int8_t byte) {
+    index->ctrl[i] = byte;
+    if (i < HASH_GROUP) {
+        index->ctrl[index->capacity + i] = byte;
+    }
+}
+
+// --- Index Operations ---
+
+// 1. Init: O(1)
+// Sets up an empty index. No memory is allocated until the first insert.
+static inline void hash_index_init(HashIndex *index) {
+    index->ctrl = NULL;
+    index->entries = NULL;
+    index->capacity = 0;
+    index->size = 0;
+    index->growth_left = 0;
+}
+
+// Places an entry known to be absent, in the first free slot of its probe sequence.
+static inline HashEntry* hash_place(HashIndex *index, int key, uint64_t hash) {
+    size_t mask = index->capacity - 1;
+    size_t pos = (size_t)(hash >> 7) & mask;
+    for (size_t step = HASH_GROUP;; step += HASH_GROUP) {
+        unsigned free_mask = hash_group_free(&index->ctrl[pos]);
+        if (free_mask != 0) {
+            size_t i = (pos + (size_t)__builtin_ctz(free_mask)) & mask;
+            if (index->ctrl[i] == HASH_EMPTY) {
+                index->growth_left--;  // Reusing a tombstone does not use up an empty slot
+            }
+            hash_set_ctrl(index, i, (int8_t)(hash & 0x7F));
+            index->entries[i].key = key;
+            index->size++;
+            return &index->entries[i];
+        }
+        pos = (pos + step) & mask;  // Triangular steps visit every group once
+    }
+}
+
+// 2. Rehash: O(capacity)
+// Moves every entry into a fresh table of new_capacity (a power of two), which drops the
+// tombstones as well.
+static inline void hash_index_rehash(HashIndex *index, size_t new_capacity) {
+    HashIndex old = *index;
+    index->ctrl = (int8_t*)malloc(new_capacity + HASH_GROUP);
+    index->entries = (HashEntry*)malloc(new_capacity * sizeof(HashEntry));
+    if (!index->ctrl || !index->entries) {
+        printf("Memory allocation error!\n");
+        exit(1);  // Exit if memory allocation fails
+    }
+    memset(index->ctrl, (unsigned char)HASH_EMPTY, new_capacity + HASH_GROUP);
+    index->capacity = new_capacity;
+    index->size = 0;
+    index->growth_left = new_capacity - new_capacity / 8;
+    for (size_t i = 0; i < old.capacity; i++) {
+        if (old.ctrl[i] >= 0) {
+            HashEntry *entry = hash_place(index, old.entries[i].key, hash_index_hash(old.entries[i].key));
+            entry->count = old.entries[i].count;
+            entry->ref = old.entries[i].ref;
+        }
+    }
+    free(old.ctrl);
+    free(old.entries);
+}
+
+// 3. Reserve: O(capacity)
+// Makes room for at least `count` distinct keys without further growth.
+static inline void hash_index_reserve(HashIndex *index, size_t count) {
+    size_t capacity = HASH_MIN_CAPACITY;
+    while (capacity - capacity / 8 < count) {
+        capacity *= 2;
+    }
+    if (capacity > index->capacity) {
+        hash_index_rehash(index, capacity);
+    }
+}
+
+// 4. Lookup: O(1) expected
+// Returns the entry for key, or NULL if no element holds it.
+static inline HashEntry* hash_index_lookup(const HashIndex *index, int key) {
+    if (index->size == 0) {
+        return NULL;
+    }
+    uint64_t hash = hash_index_hash(key);
+    int8_t h2 = (int8_t)(hash & 0x7F);
+    size_t mask = index->capacity - 1;
+    size_t pos = (size_t)(hash >> 7) & mask;
+    for (size_t step = HASH_GROUP;; step += HASH_GROUP) {
+        const int8_t *group = &index->ctrl[pos];
+        for (unsigned match = hash_group_match(group, h2); match != 0; match &= match - 1) {
+            HashEntry *entry = &index->entries[(pos + (size_t)__builtin_ctz(match)) & mask];
+            if (entry->key == key) {
+                return entry;
+            }
+        }
+        if (hash_group_match(group, HASH_EMPTY) != 0) {
+            return NULL;  // The key would have been placed at or before this empty slot
+        }
+        pos = (pos + step) & mask;
+    }
+}
+
+// 5. Upsert: O(1) amortized
+// Returns the entry for key, adding it with count 0 if it is new. The caller then sets
+// count and ref. Adding grows the table, or rehashes it in place when tombstones fill it.
+static inline HashEntry* hash_index_upsert(HashIndex *index, int key) {
+    HashEntry *entry = hash_index_lookup(index, key);
+    if (entry != NULL) {
+        return entry;
+    }
+    if (index->growth_left == 0) {
+        size_t capacity = index->capacity == 0 ? HASH_MIN_CAPACITY : index->capacity;
+        hash_index_rehash(index, index->size >= capacity / 2 ? capacity * 2 : capacity);
+    }
+    entry = hash_place(index, key, hash_index_hash(key));
+    entry->count = 0;
+    entry->ref = 0;
+    return entry;
+}
+
+// 6. Erase: O(1)
+// Removes an entry returned by lookup or upsert. Its slot becomes a tombstone, because a
+// later key of the same probe sequence may sit behind it.
+static inline void hash_index_erase(HashIndex *index, HashEntry *entry) {
+    hash_set_ctrl(index, (size_t)(entry - index->entries), HASH_DELETED);
+    index->size--;
+}
+
+// 7. Shift References: O(capacity)
+// Adds delta to every ref >= from. The array uses it when an insert or delete moves all
+// the positions after an index by one. The test is computed, not branched on, so the loop
+// runs at memory speed whatever the mix of moved and unmoved entries.
+static inline void hash_index_shift(HashIndex *index, intptr_t from, intptr_t delta) {
+    for (size_t i = 0; i < index->capacity; i++) {
+        intptr_t hit = (index->ctrl[i] >= 0) & (index->entries[i].ref >= from);
+        index->entries[i].ref += delta & -hit;
+    }
+}
+
+// 8. Free: O(1)
+// Releases both arrays and leaves an empty index.
+static inline void hash_index_free(HashIndex *index) {
+    free(index->ctrl);
+    free(index->entries);
+    hash_index_init(index);
+}
+
+// --- Big O Summary ---
+// 1. Init / Free: O(1) - No allocation until the first insert.
+// 2. Lookup: O(1) expected - One 16-byte group compare per probe step, usually one step.
+// 3. Upsert / Erase: O(1) amortized - The table doubles before it is 7/8 full.
+// 4. Reserve / Rehash: O(capacity) - Every entry is placed again.
+// 5. Shift References: O(capacity) - One pass over the control bytes.
+
+#endif // HASH_INDEX_H
@@ -0,0 +1,148 @@
+// This header implements a small fork-join thread pool for the parallel sorts. The worker
+// threads are started once and then sleep on a condition variable; pool_run hands every
+// worker (and the calling thread) the same job, gives each one its own worker id, and
+// returns when all of them are done. A parallel sort is then a sequence of pool_run calls,
+// one per phase, with no thread creation in between.
+//
+// Build with -pthread. Every function is meant to be called from one controlling thread.
+//
+// Usage:
+//   WorkPool pool;
+//   pool_init(&pool, 4);                 // 3 worker threads + the caller
+//   pool_run(&pool, job, &args);         // job(&args, id, 4) for id = 0 .. 3, in parallel
+//   pool_free(&pool);
+
+#ifndef POOL_H
+#define POOL_H
+
+// --- Includes Section ---
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#define POOL_MAX_THREADS 64
+
+// --- Struct Definitions ---
+// A job gets its argument, the id of the thread running it and the number of threads.
+typedef void (*PoolJob)(void *arg, int id, int count);
+
+typedef struct WorkPool {
+    int count;                     // Threads taking part in a job, the caller included
+    pthread_t threads[POOL_MAX_THREADS];
+    pthread_mutex_t lock;
+    pthread_cond_t start;          // Signalled when a new job (or shutdown) is posted
+    pthread_cond_t done;           // Signalled when the last worker finishes the job
+    PoolJob job;
+    void *arg;
+    unsigned long generation;      // Incremented for every job, so workers never run one twice
+    int running;                   // Workers still busy with the current job
+    int stop;                      // Set by pool_free
+} WorkPool;
+
+// Start parameters of one worker: its pool and its id (1 .. count - 1; the caller is 0).
+typedef struct PoolSeat {
+    WorkPool *pool;
+    int id;
+} PoolSeat;
+
+// --- Pool Operations ---
+
+// Worker loop: wait for a new generation, run the job, report back.
+static void* pool_worker(void *arg) {
+    PoolSeat seat = *(PoolSeat*)arg;
+    free(arg);
+    WorkPool *pool = seat.pool;
+    unsigned long seen = 0;
+    pthread_mutex_lock(&pool->lock);
+    for (;;) {
+        while (pool->generation == seen && !pool->stop) {
+            pthread_cond_wait(&pool->start, &pool->lock);
+        }
+        if (pool->stop) {
+            break;
+        }
+        seen = pool->generation;
+        PoolJob job = pool->job;
+        void *job_arg = pool->arg;
+        pthread_mutex_unlock(&pool->lock);
+        job(job_arg, seat.id, pool->count);
+        pthread_mutex_lock(&pool->lock);
+        if (--pool->running == 0) {
+            pthread_cond_signal(&pool->done);
+        }
+    }
+    pthread_mutex_unlock(&pool->lock);
+    return NULL;
+}
+
+// 1. Pool Init: O(threads)
+// Starts threads - 1 workers; a pool of 1 thread runs every job on the caller alone.
+// threads is clamped to [1, POOL_MAX_THREADS].
+static inline void pool_init(WorkPool *pool, int threads) {
+    pool->count = threads < 1 ? 1 : threads > POOL_MAX_THREADS ? POOL_MAX_THREADS : threads;
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->start, NULL);
+    pthread_cond_init(&pool->done, NULL);
+    pool->job = NULL;
+    pool->arg = NULL;
+    pool->generation = 0;
+    pool->running = 0;
+    pool->stop = 0;
+    for (int i = 1; i < pool->count; i++) {
+        PoolSeat *seat = (PoolSeat*)malloc(sizeof(PoolSeat));
+        if (!seat) {
+            printf("Memory allocation error!\n");
+            exit(1);
+        }
+        seat->pool = pool;
+        seat->id = i;
+        if (pthread_create(&pool->threads[i], NULL, pool_worker, seat) != 0) {
+            printf("Error: Cannot start a pool thread.\n");
+            exit(1);
+        }
+    }
+}
+
+// 2. Pool Run: O(job)
+// Runs job(arg, id, count) on every thread of the pool, the caller as id 0, and waits for
+// all of them. The pool's mutex orders everything the workers wrote before the return.
+static inline void pool_run(WorkPool *pool, PoolJob job, void *arg) {
+    if (pool->count > 1) {
+        pthread_mutex_lock(&pool->lock);
+        pool->job = job;
+        pool->arg = arg;
+        pool->running = pool->count - 1;
+        pool->generation++;
+        pthread_cond_broadcast(&pool->start);
+        pthread_mutex_unlock(&pool->lock);
+    }
+    job(arg, 0, pool->count);
+    if (pool->count > 1) {
+        pthread_mutex_lock(&pool->lock);
+        while (pool->running > 0) {
+            pthread_cond_wait(&pool->done, &pool->lock);
+        }
+        pthread_mutex_unlock(&pool->lock);
+    }
+}
+
+// 3. Pool Free: O(threads)
+// Stops and joins the workers.
+static inline void pool_free(WorkPool *pool) {
+    pthread_mutex_lock(&pool->lock);
+    pool->stop = 1;
+    pthread_cond_broadcast(&pool->start);
+    pthread_mutex_unlock(&pool->lock);
+    for (int i = 1; i < pool->count; i++) {
+        pthread_join(pool->threads[i], NULL);
+    }
+    pthread_mutex_destroy(&pool->lock);
+    pthread_cond_destroy(&pool->start);
+    pthread_cond_destroy(&pool->done);
+}
+
+// --- Big O Summary ---
+// 1. Pool Init / Free: O(threads) - One pthread_create / pthread_join per worker, once.
+// 2. Pool Run: O(job) - Plus one broadcast and one wake-up per worker, no thread creation.
+
+#endif // POOL_H
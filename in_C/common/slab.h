@@ -0,0 +1,161 @@
+// This header implements a fixed-size slab (pool) allocator shared by the linked list
+// and tree programs. Instead of calling malloc once per 16-24 byte node, the pool grabs
+// big blocks from malloc and carves them into equal-sized slots. Freed slots go on a
+// free list and are reused first, and the whole arena can be released in one go.
+// A pool made with SLAB_POOL_INIT_ALIGNED takes its blocks from aligned_alloc and pads the
+// block header, so every slot starts on the requested boundary (e.g. one cache line).
+
+#ifndef SLAB_H
+#define SLAB_H
+
+// --- Includes Section ---
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "stats.h"  // Opt-in allocation counters (compiled out by default)
+
+// Every block obtained from malloc is this many bytes (64 KiB = 16 pages).
+#ifndef SLAB_BLOCK_BYTES
+#define SLAB_BLOCK_BYTES (64 * 1024)
+#endif
+
+// Slots are rounded up to pointer alignment, so a 24 byte node uses 24 bytes, not 32.
+#define SLAB_ALIGN sizeof(void*)
+#define SLAB_ROUND(n) (((n) + SLAB_ALIGN - 1) / SLAB_ALIGN * SLAB_ALIGN)
+#define SLAB_ROUND_TO(n, a) (((n) + (a) - 1) / (a) * (a))
+
+// --- Struct Definitions ---
+// Each block starts with this header; the slots follow right after it.
+typedef struct SlabBlock {
+    struct SlabBlock *next;    // Pointer to the previously allocated block
+} SlabBlock;
+
+// A free slot is reused to store the link to the next free slot.
+typedef struct SlabFree {
+    struct SlabFree *next;     // Pointer to the next free slot
+} SlabFree;
+
+typedef struct SlabPool {
+    size_t slot_size;          // Size of each slot, big enough for the node and a free link
+    SlabBlock *blocks;         // Every block allocated so far, for bulk teardown
+    char *cursor;              // Next never-used slot in the newest block
+    char *limit;               // End of the newest block
+    SlabFree *free_list;       // Slots given back by slab_free, reused first
+    size_t align;              // Slot alignment for aligned pools (a power of two), else 0
+} SlabPool;
+
+// Static initializer, e.g. static SlabPool pool = SLAB_POOL_INIT(sizeof(Node));
+#define SLAB_POOL_INIT(size) \
+    { SLAB_ROUND((size) > sizeof(SlabFree) ? (size) : sizeof(SlabFree)), NULL, NULL, NULL, NULL, 0 }
+
+// Same, with every slot starting on an `align` byte boundary; slots are rounded up to a
+// multiple of align. E.g. SLAB_POOL_INIT_ALIGNED(sizeof(Block), 64) for one line per slot.
+#define SLAB_POOL_INIT_ALIGNED(size, align) \
+    { SLAB_ROUND_TO((size) > sizeof(SlabFree) ? (size) : sizeof(SlabFree), (align)), NULL, NULL, NULL, NULL, (align) }
+
+// --- Pool Operations ---
+
+// Bytes from the start of a block to its first slot: the header, padded to the alignment.
+static inline size_t slab_header(const SlabPool *pool) {
+    return pool->align > SLAB_ALIGN ? pool->align : SLAB_ROUND(sizeof(SlabBlock));
+}
+
+// One block of `bytes` from malloc, or from aligned_alloc for aligned pools.
+static inline SlabBlock* slab_block_alloc(const SlabPool *pool, size_t bytes) {
+    if (pool->align > SLAB_ALIGN) {
+        return (SlabBlock*)aligned_alloc(pool->align, SLAB_ROUND_TO(bytes, pool->align));
+    }
+    return (SlabBlock*)malloc(bytes);
+}
+
+// 1. Init Pool: O(1)
+// Prepares an empty pool for objects of the given size. No memory is allocated yet.
+static inline void slab_init(SlabPool *pool, size_t size) {
+    SlabPool empty = SLAB_POOL_INIT(size);
+    *pool = empty;
+}
+
+// 2. Grow Pool: O(1)
+// Allocates one more block from malloc and makes it the current carving block.
+static inline void slab_grow(SlabPool *pool) {
+    SlabBlock *block = slab_block_alloc(pool, SLAB_BLOCK_BYTES);
+    if (!block) {
+        printf("Memory allocation error!\n");
+        exit(1);  // Exit if memory allocation fails, like create_node does
+    }
+    block->next = pool->blocks;
+    pool->blocks = block;
+    pool->cursor = (char*)block + slab_header(pool);
+    pool->limit = (char*)block + SLAB_BLOCK_BYTES;
+}
+
+// 3. Allocate Slot: O(1) amortized
+// Pops a slot from the free list, or bumps the cursor in the current block.
+// Consecutive allocations are adjacent in memory, which helps traversals.
+static inline void* slab_alloc(SlabPool *pool) {
+    STAT_ALLOC(1);
+    if (pool->free_list != NULL) {
+        SlabFree *slot = pool->free_list;
+        pool->free_list = slot->next;
+        return slot;
+    }
+    if (pool->cursor == NULL || pool->cursor + pool->slot_size > pool->limit) {
+        slab_grow(pool);
+    }
+    void *slot = pool->cursor;
+    pool->cursor += pool->slot_size;
+    return slot;
+}
+
+// 4. Free Slot: O(1)
+// Pushes the slot onto the free list. The memory stays owned by the pool.
+static inline void slab_free(SlabPool *pool, void *ptr) {
+    if (ptr == NULL) return;
+    STAT_FREE();
+    SlabFree *slot = (SlabFree*)ptr;
+    slot->next = pool->free_list;
+    pool->free_list = slot;
+}
+
+// 5. Allocate Array: O(1)
+// Allocates `count` adjacent slots in a dedicated block of exactly that size, for bulk
+// builds that want all their nodes in one contiguous run. The block is linked into the
+// pool, so slab_free works on each slot and slab_destroy releases the whole block.
+static inline void* slab_alloc_array(SlabPool *pool, size_t count) {
+    size_t header = slab_header(pool);
+    SlabBlock *block = slab_block_alloc(pool, header + count * pool->slot_size);
+    if (!block) {
+        printf("Memory allocation error!\n");
+        exit(1);
+    }
+    STAT_ALLOC(count);
+    block->next = pool->blocks;  // Behind the carving block, which stays current
+    pool->blocks = block;
+    return (char*)block + header;
+}
+
+// 6. Destroy Pool: O(number of blocks)
+// Gives every block back to malloc at once, without visiting individual nodes.
+// The pool is left empty and can be used again.
+static inline void slab_destroy(SlabPool *pool) {
+    SlabBlock *block = pool->blocks;
+    while (block != NULL) {
+        SlabBlock *next = block->next;
+        free(block);
+        block = next;
+    }
+    pool->blocks = NULL;
+    pool->cursor = NULL;
+    pool->limit = NULL;
+    pool->free_list = NULL;
+}
+
+// --- Big O Summary ---
+// 1. Init Pool: O(1) - Only fills in the pool header.
+// 2. Grow Pool: O(1) - One malloc call per SLAB_BLOCK_BYTES of nodes.
+// 3. Allocate Slot: O(1) amortized - A free list pop or a pointer bump.
+// 4. Free Slot: O(1) - A free list push.
+// 5. Allocate Array: O(1) - One malloc for any number of adjacent slots.
+// 6. Destroy Pool: O(b) - b is the number of blocks, not the number of nodes.
+
+#endif // SLAB_H
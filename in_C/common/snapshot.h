@@ -0,0 +1,358 @@
+// This header implements the on-disk snapshot format shared by the array, list and tree
+// programs. A snapshot is a 64 byte header followed by fixed-size records, written in the
+// machine's own byte order, so a reader can mmap the file and use the records in place:
+// opening a snapshot costs a few system calls, not one allocation and insert per element.
+//
+// Layout of a file:
+//   bytes 0..63   SnapshotHeader (magic, version, kind, record size, count, checksum, ...)
+//   bytes 64..    count records of record_size bytes each
+// Links between records (list next/prev, tree left/right) are record indexes instead of
+// pointers, with SNAPSHOT_NIL for "no record", so they stay valid wherever the file is mapped.
+//
+// Snapshots are written to "<path>.tmp" and renamed over <path> only once they are
+// complete, so a crash while saving never leaves a half-written snapshot behind.
+
+#ifndef SNAPSHOT_H
+#define SNAPSHOT_H
+
+// --- Includes Section ---
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+// "\r\n" in the magic catches files mangled by text-mode transfers, as in PNG.
+#define SNAPSHOT_MAGIC "DSSNAP\r\n"
+#define SNAPSHOT_VERSION 1u
+#define SNAPSHOT_BYTE_ORDER 0x01020304u  // Reads back differently on a machine of the other endianness
+#define SNAPSHOT_NIL UINT32_MAX          // Record index meaning "no record"
+#define SNAPSHOT_BUFFER_BYTES (256 * 1024)
+
+// What the records describe. Readers check it, so a tree file is never opened as a list.
+enum { SNAPSHOT_ARRAY = 1, SNAPSHOT_LIST = 2, SNAPSHOT_TREE = 3 };
+
+// --- Struct Definitions ---
+typedef struct SnapshotHeader {
+    char magic[8];             // SNAPSHOT_MAGIC, without the terminating zero
+    uint32_t version;          // SNAPSHOT_VERSION; bumped whenever a record layout changes
+    uint32_t byte_order;       // SNAPSHOT_BYTE_ORDER as written by the saving machine
+    uint32_t kind;             // SNAPSHOT_ARRAY, SNAPSHOT_LIST or SNAPSHOT_TREE
+    uint32_t record_size;      // Bytes per record
+    uint64_t count;            // Number of records
+    uint64_t root;             // Kind specific: first list record, or tree root record
+    uint64_t extra;            // Kind specific: last list record
+    uint64_t checksum;         // snapshot_checksum of the records
+    uint64_t reserved;         // Zero; pads the header to 64 bytes so records start on a cache line
+} SnapshotHeader;
+
+// Running checksum: four independent multiply-xorshift lanes over 8 byte words, so the
+// loop is not one long dependency chain. Input that does not fill a 32 byte block waits
+// in `pending`.
+typedef struct SnapshotHash {
+    uint64_t lanes[4];
+    uint64_t bytes;            // Total bytes hashed
+    unsigned char pending[32];
+    size_t pending_bytes;
+} SnapshotHash;
+
+// Streams records into a new snapshot file.
+typedef struct SnapshotWriter {
+    int fd;
+    char *path;                // Final name
+    char *temp_path;           // "<path>.tmp", renamed to path by snapshot_finish
+    SnapshotHeader header;
+    SnapshotHash hash;
+    unsigned char *buffer;     // Records waiting to be written
+    size_t used;               // Bytes in buffer
+    size_t hashed;             // Bytes at the start of buffer already hashed (or not hashed at all)
+    int failed;                // Set by the first failed write
+} SnapshotWriter;
+
+// A snapshot mapped into memory, read-only.
+typedef struct SnapshotView {
+    void *map;                 // Start of the mapping (the header)
+    size_t map_bytes;
+    const SnapshotHeader *header;
+    const void *records;       // First record, 64 bytes into the mapping
+} SnapshotView;
+
+// --- Checksum Operations ---
+
+static inline uint64_t snapshot_mix(uint64_t lane, uint64_t word) {
+    lane = (lane ^ word) * 0x9E3779B97F4A7C15ull;
+    return lane ^ (lane >> 29);
+}
+
+// 1. Hash Init: O(1)
+static inline void snapshot_hash_init(SnapshotHash *hash) {
+    hash->lanes[0] = 0x243F6A8885A308D3ull;  // Digits of pi, so the lanes start different
+    hash->lanes[1] = 0x13198A2E03707344ull;
+    hash->lanes[2] = 0xA4093822299F31D0ull;
+    hash->lanes[3] = 0x082EFA98EC4E6C89ull;
+    hash->bytes = 0;
+    hash->pending_bytes = 0;
+}
+
+static inline void snapshot_hash_block(SnapshotHash *hash, const unsigned char *block) {
+    for (int i = 0; i < 4; i++) {
+        uint64_t word;
+        memcpy(&word, block + 8 * i, 8);  // memcpy: the data need not be 8 byte aligned
+        hash->lanes[i] = snapshot_mix(hash->lanes[i], word);
+    }
+}
+
+// 2. Hash Update: O(bytes)
+// Adds bytes to the checksum. Any split of the same data gives the same result.
+static inline void snapshot_hash_update(SnapshotHash *hash, const void *data, size_t bytes) {
+    const unsigned char *p = (const unsigned char*)data;
+    hash->bytes += bytes;
+    if (hash->pending_bytes > 0) {
+        size_t take = 32 - hash->pending_bytes;
+        if (take > bytes) take = bytes;
+        memcpy(hash->pending + hash->pending_bytes, p, take);
+        hash->pending_bytes += take;
+        p += take;
+        bytes -= take;
+        if (hash->pending_bytes < 32) {
+            return;
+        }
+        snapshot_hash_block(hash, hash->pending);
+        hash->pending_bytes = 0;
+    }
+    for (; bytes >= 32; p += 32, bytes -= 32) {
+        snapshot_hash_block(hash, p);
+    }
+    memcpy(hash->pending, p, bytes);
+    hash->pending_bytes = bytes;
+}
+
+// 3. Hash Final: O(1)
+// Pads the last partial block with zeros, then folds the lanes and the length together.
+static inline uint64_t snapshot_hash_final(SnapshotHash *hash) {
+    if (hash->pending_bytes > 0) {
+        memset(hash->pending + hash->pending_bytes, 0, 32 - hash->pending_bytes);
+        snapshot_hash_block(hash, hash->pending);
+        hash->pending_bytes = 0;
+    }
+    uint64_t result = hash->bytes;
+    for (int i = 0; i < 4; i++) {
+        result = snapshot_mix(result, hash->lanes[i]);
+    }
+    return result;
+}
+
+// 4. Checksum: O(bytes)
+// One-shot form of the three functions above.
+static inline uint64_t snapshot_checksum(const void *data, size_t bytes) {
+    SnapshotHash hash;
+    snapshot_hash_init(&hash);
+    snapshot_hash_update(&hash, data, bytes);
+    return snapshot_hash_final(&hash);
+}
+
+// --- Writer Operations ---
+
+// Writes all of data, retrying short writes. Returns 0, or -1 on error.
+static inline int snapshot_write_all(int fd, const void *data, size_t bytes) {
+    const char *p = (const char*)data;
+    while (bytes > 0) {
+        ssize_t written = write(fd, p, bytes);
+        if (written <= 0) {
+            return -1;
+        }
+        p += written;
+        bytes -= (size_t)written;
+    }
+    return 0;
+}
+
+// Hashes and writes the buffered bytes.
+static inline void snapshot_flush(SnapshotWriter *writer) {
+    snapshot_hash_update(&writer->hash, writer->buffer + writer->hashed, writer->used - writer->hashed);
+    writer->hashed = 0;
+    if (!writer->failed && snapshot_write_all(writer->fd, writer->buffer, writer->used) != 0) {
+        writer->failed = 1;
+    }
+    writer->used = 0;
+}
+
+// 5. Create: O(1)
+// Opens "<path>.tmp" for a snapshot of the given kind and record size.
+// Returns 0, or -1 (with an error message) if the file cannot be created.
+static inline int snapshot_create(SnapshotWriter *writer, const char *path, uint32_t kind,
+                                  uint32_t record_size) {
+    size_t length = strlen(path);
+    writer->path = (char*)malloc(length + 1);
+    writer->temp_path = (char*)malloc(length + 5);
+    writer->buffer = (unsigned char*)malloc(SNAPSHOT_BUFFER_BYTES);
+    if (!writer->path || !writer->temp_path || !writer->buffer) {
+        printf("Memory allocation error!\n");
+        exit(1);  // Exit if memory allocation fails
+    }
+    memcpy(writer->path, path, length + 1);
+    memcpy(writer->temp_path, path, length);
+    memcpy(writer->temp_path + length, ".tmp", 5);
+
+    memset(&writer->header, 0, sizeof(SnapshotHeader));
+    memcpy(writer->header.magic, SNAPSHOT_MAGIC, 8);
+    writer->header.version = SNAPSHOT_VERSION;
+    writer->header.byte_order = SNAPSHOT_BYTE_ORDER;
+    writer->header.kind = kind;
+    writer->header.record_size = record_size;
+    snapshot_hash_init(&writer->hash);
+    writer->used = 0;
+    writer->failed = 0;
+
+    writer->fd = open(writer->temp_path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (writer->fd < 0) {
+        printf("Error: Cannot create %s.\n", writer->temp_path);
+        free(writer->path);
+        free(writer->temp_path);
+        free(writer->buffer);
+        return -1;
+    }
+    // Room for the header, which is only known at the end and is not part of the checksum
+    writer->used = sizeof(SnapshotHeader);
+    writer->hashed = writer->used;
+    memset(writer->buffer, 0, writer->used);
+    return 0;
+}
+
+// 6. Put: O(1) amortized
+// Appends one record of header.record_size bytes. The checksum is computed per buffer
+// when it is flushed, not per record.
+static inline void snapshot_put(SnapshotWriter *writer, const void *record) {
+    size_t size = writer->header.record_size;
+    if (writer->used + size > SNAPSHOT_BUFFER_BYTES) {
+        snapshot_flush(writer);
+    }
+    memcpy(writer->buffer + writer->used, record, size);
+    writer->used += size;
+    writer->header.count++;
+}
+
+// Appends count records stored back to back, in buffer-sized pieces.
+static inline void snapshot_put_many(SnapshotWriter *writer, const void *records, size_t count) {
+    const unsigned char *p = (const unsigned char*)records;
+    size_t size = writer->header.record_size;
+    while (count > 0) {
+        size_t room = (SNAPSHOT_BUFFER_BYTES - writer->used) / size;
+        if (room == 0) {
+            snapshot_flush(writer);
+            continue;
+        }
+        size_t take = room < count ? room : count;
+        memcpy(writer->buffer + writer->used, p, take * size);
+        writer->used += take * size;
+        writer->header.count += take;
+        p += take * size;
+        count -= take;
+    }
+}
+
+// 7. Finish: O(1) plus the last flush
+// Writes the header, syncs the file to disk and renames it over the final path.
+// Returns 0, or -1 (with an error message) if anything failed; the old snapshot at path,
+// if any, is then left untouched.
+static inline int snapshot_finish(SnapshotWriter *writer, uint64_t root, uint64_t extra) {
+    snapshot_flush(writer);
+    writer->header.root = root;
+    writer->header.extra = extra;
+    writer->header.checksum = snapshot_hash_final(&writer->hash);
+    int failed = writer->failed ||
+                 lseek(writer->fd, 0, SEEK_SET) != 0 ||
+                 snapshot_write_all(writer->fd, &writer->header, sizeof(SnapshotHeader)) != 0 ||
+                 fsync(writer->fd) != 0;
+    failed |= close(writer->fd) != 0;
+    if (!failed && rename(writer->temp_path, writer->path) != 0) {
+        failed = 1;
+    }
+    if (failed) {
+        printf("Error: Cannot write %s.\n", writer->path);
+        unlink(writer->temp_path);
+    }
+    free(writer->path);
+    free(writer->temp_path);
+    free(writer->buffer);
+    return failed ? -1 : 0;
+}
+
+// --- Reader Operations ---
+
+// 8. Open: O(1), or O(n) with verify
+// Maps a snapshot read-only and checks its header: magic, version, byte order, kind,
+// record size and file size. With verify set, the checksum of the records is checked
+// too, which reads the whole file once; without it, pages are only read when touched.
+// Returns 0, or -1 (with an error message) if the file is missing or does not match.
+static inline int snapshot_open(SnapshotView *view, const char *path, uint32_t kind,
+                                uint32_t record_size, int verify) {
+    view->map = NULL;
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        printf("Error: Cannot open %s.\n", path);
+        return -1;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(SnapshotHeader)) {
+        printf("Error: %s is not a snapshot.\n", path);
+        close(fd);
+        return -1;
+    }
+    view->map_bytes = (size_t)st.st_size;
+    void *map = mmap(NULL, view->map_bytes, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);  // The mapping keeps the file alive
+    if (map == MAP_FAILED) {
+        printf("Error: Cannot map %s.\n", path);
+        return -1;
+    }
+
+    const SnapshotHeader *header = (const SnapshotHeader*)map;
+    const char *problem = NULL;
+    if (memcmp(header->magic, SNAPSHOT_MAGIC, 8) != 0) {
+        problem = "is not a snapshot";
+    } else if (header->version != SNAPSHOT_VERSION) {
+        problem = "has an unsupported version";
+    } else if (header->byte_order != SNAPSHOT_BYTE_ORDER) {
+        problem = "was written with the other byte order";
+    } else if (header->kind != kind || header->record_size != record_size) {
+        problem = "holds a different structure";
+    } else if (header->count > (view->map_bytes - sizeof(SnapshotHeader)) / record_size ||
+               sizeof(SnapshotHeader) + header->count * record_size != view->map_bytes) {
+        problem = "is truncated or has trailing bytes";
+    } else if (verify && snapshot_checksum((const char*)map + sizeof(SnapshotHeader),
+                                           view->map_bytes - sizeof(SnapshotHeader)) != header->checksum) {
+        problem = "is corrupted (checksum mismatch)";
+    }
+    if (problem != NULL) {
+        printf("Error: %s %s.\n", path, problem);
+        munmap(map, view->map_bytes);
+        return -1;
+    }
+
+    view->map = map;
+    view->header = header;
+    view->records = (const char*)map + sizeof(SnapshotHeader);
+    return 0;
+}
+
+// 9. Close: O(1)
+// Unmaps the snapshot. Pointers into its records become invalid.
+static inline void snapshot_close(SnapshotView *view) {
+    if (view->map != NULL) {
+        munmap(view->map, view->map_bytes);
+        view->map = NULL;
+    }
+}
+
+// --- Big O Summary ---
+// 1-4. Checksum: O(bytes) - Four independent lanes, about one cycle per 8 bytes.
+// 5-7. Writer: O(n) for n records - Buffered writes, one fsync and one rename at the end.
+// 8. Open: O(1) without verify - The records are used in place, nothing is rebuilt.
+//    O(n) with verify - One sequential read of the file to check the checksum.
+// 9. Close: O(1).
+
+#endif // SNAPSHOT_H
@@ -0,0 +1,180 @@
+// This header is the opt-in instrumentation layer of the list and tree programs. It answers
+// "why is this find slow": because it walked many nodes, because it allocated, or because
+// its nodes missed the cache.
+//
+// Built with -DDS_STATS, the node operations count the nodes they step onto, the slab
+// allocator counts the slots it hands out and takes back, and the AVL code counts its
+// rotations. With -DDS_STATS_PERF as well (Linux only), a snapshot also reads this thread's
+// hardware counters through perf_event_open: cycles, instructions, cache misses and branch
+// misses. The perf build needs -D_DEFAULT_SOURCE on the command line too, for syscall(): it
+// has to be set before the first system header of the program, which is not this one.
+// Without DS_STATS the STAT_ macros expand to nothing, so a default build has no
+// counters in its hot loops; the snapshot API still compiles and reports zeros.
+//
+// The counters are plain globals: the instrumented programs are single threaded, or call the
+// node operations behind one lock (the mutex baselines of the concurrent benchmarks).
+//
+// Usage:
+//   ds_stats_reset();                    // Zero the counters, restart the hardware counters
+//   ... operations ...
+//   DsStats stats;
+//   tree_stats(root, &stats);            // Or list_stats: a snapshot plus the shape
+//   ds_stats_print(&stats);
+
+#ifndef STATS_H
+#define STATS_H
+
+// --- Includes Section ---
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#ifdef DS_STATS_PERF
+#if !defined(_DEFAULT_SOURCE) && !defined(_GNU_SOURCE)
+#error "DS_STATS_PERF needs -D_DEFAULT_SOURCE (or -D_GNU_SOURCE) for syscall()"
+#endif
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>   // syscall(), declared with _DEFAULT_SOURCE; glibc has no perf_event_open wrapper
+#endif
+
+// --- Struct Definitions ---
+typedef struct DsStats {
+    uint64_t nodes_visited;    // Nodes (and skip-list lanes) a walk stepped onto
+    uint64_t allocs;           // Slab slots handed out
+    uint64_t frees;            // Slab slots given back
+    uint64_t rotations;        // AVL single rotations (a double rotation counts two)
+    int64_t length;            // Elements in the structure, filled by list_stats / tree_stats
+    int64_t height;            // Height of the tree (0 for a list)
+    // Hardware counters since ds_stats_reset, -1 when not measured
+    int64_t cycles;
+    int64_t instructions;
+    int64_t cache_misses;
+    int64_t branch_misses;
+} DsStats;
+
+#define DS_STATS_HW 4  // Hardware counters per snapshot
+
+// --- Counters ---
+static DsStats ds_stats_counters;
+
+#ifdef DS_STATS
+#define STAT_VISIT(n) (ds_stats_counters.nodes_visited += (uint64_t)(n))
+#define STAT_ALLOC(n) (ds_stats_counters.allocs += (uint64_t)(n))
+#define STAT_FREE() (ds_stats_counters.frees++)
+#define STAT_ROTATE() (ds_stats_counters.rotations++)
+#else
+#define STAT_VISIT(n) ((void)0)
+#define STAT_ALLOC(n) ((void)0)
+#define STAT_FREE() ((void)0)
+#define STAT_ROTATE() ((void)0)
+#endif
+
+// --- Hardware Counters ---
+#ifdef DS_STATS_PERF
+// File descriptor per counter: -2 before the first open, -1 if the kernel refused it
+// (no PMU, perf_event_paranoid too strict, or a container without the syscall).
+static int ds_perf_fd[DS_STATS_HW] = { -2, -2, -2, -2 };
+
+// Opens the four counters for this thread, user space only, once.
+static inline void ds_perf_open(void) {
+    static const uint64_t configs[DS_STATS_HW] = {
+        PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS,
+        PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_HW_BRANCH_MISSES
+    };
+    if (ds_perf_fd[0] != -2) {
+        return;
+    }
+    for (int i = 0; i < DS_STATS_HW; i++) {
+        struct perf_event_attr attr;
+        memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.config = configs[i];
+        attr.disabled = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        ds_perf_fd[i] = (int)syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0);
+    }
+}
+#endif
+
+// --- Stats Operations ---
+
+// 1. Reset: O(1)
+// Zeroes the software counters and restarts the hardware counters from 0.
+static inline void ds_stats_reset(void) {
+    memset(&ds_stats_counters, 0, sizeof(ds_stats_counters));
+#ifdef DS_STATS_PERF
+    ds_perf_open();
+    for (int i = 0; i < DS_STATS_HW; i++) {
+        if (ds_perf_fd[i] >= 0) {
+            ioctl(ds_perf_fd[i], PERF_EVENT_IOC_RESET, 0);
+            ioctl(ds_perf_fd[i], PERF_EVENT_IOC_ENABLE, 0);
+        }
+    }
+#endif
+}
+
+// 2. Snapshot: O(1)
+// Copies the counters into *stats. The shape fields are 0; list_stats and tree_stats fill
+// them. Hardware counters are -1 unless built with DS_STATS_PERF and the kernel allows it.
+static inline void ds_stats_snapshot(DsStats *stats) {
+    *stats = ds_stats_counters;
+    stats->length = 0;
+    stats->height = 0;
+    int64_t *hw[DS_STATS_HW] = { &stats->cycles, &stats->instructions, &stats->cache_misses,
+                                 &stats->branch_misses };
+    for (int i = 0; i < DS_STATS_HW; i++) {
+        *hw[i] = -1;
+#ifdef DS_STATS_PERF
+        uint64_t value;
+        if (ds_perf_fd[i] >= 0 && read(ds_perf_fd[i], &value, sizeof(value)) == (ssize_t)sizeof(value)) {
+            *hw[i] = (int64_t)value;
+        }
+#endif
+    }
+}
+
+// 3. Delta: O(1)
+// Stores after - before in *out, for the cost of the operations between two snapshots.
+// A hardware counter stays -1 if either snapshot lacks it; the shape is taken from after.
+static inline void ds_stats_delta(const DsStats *after, const DsStats *before, DsStats *out) {
+    out->nodes_visited = after->nodes_visited - before->nodes_visited;
+    out->allocs = after->allocs - before->allocs;
+    out->frees = after->frees - before->frees;
+    out->rotations = after->rotations - before->rotations;
+    out->length = after->length;
+    out->height = after->height;
+    out->cycles = after->cycles < 0 || before->cycles < 0 ? -1 : after->cycles - before->cycles;
+    out->instructions = after->instructions < 0 || before->instructions < 0 ? -1
+                        : after->instructions - before->instructions;
+    out->cache_misses = after->cache_misses < 0 || before->cache_misses < 0 ? -1
+                        : after->cache_misses - before->cache_misses;
+    out->branch_misses = after->branch_misses < 0 || before->branch_misses < 0 ? -1
+                         : after->branch_misses - before->branch_misses;
+}
+
+// 4. Print: O(1)
+// Prints a snapshot (or a delta) in two lines.
+static inline void ds_stats_print(const DsStats *stats) {
+    printf("Stats: %llu nodes visited, %llu allocs, %llu frees, %llu rotations, length %lld, height %lld\n",
+           (unsigned long long)stats->nodes_visited, (unsigned long long)stats->allocs,
+           (unsigned long long)stats->frees, (unsigned long long)stats->rotations,
+           (long long)stats->length, (long long)stats->height);
+    if (stats->cycles < 0 && stats->cache_misses < 0) {
+        printf("       hardware counters not measured\n");
+    } else {
+        printf("       %lld cycles, %lld instructions, %lld cache misses, %lld branch misses\n",
+               (long long)stats->cycles, (long long)stats->instructions,
+               (long long)stats->cache_misses, (long long)stats->branch_misses);
+    }
+}
+
+// --- Big O Summary ---
+// 1. STAT_ counters: O(1) - One add to a global, or nothing without DS_STATS.
+// 2. Reset / Snapshot: O(1) - Plus one ioctl or read(2) per hardware counter with DS_STATS_PERF.
+// 3. Delta / Print: O(1).
+
+#endif // STATS_H
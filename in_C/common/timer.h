@@ -0,0 +1,29 @@
+// This header holds the small timing helpers used by the benchmark programs.
+
+#ifndef TIMER_H
+#define TIMER_H
+
+// --- Includes Section ---
+#include <stdint.h>
+#include <time.h>
+
+// 1. Now: O(1)
+// Returns a monotonic timestamp in nanoseconds.
+static inline uint64_t now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+// 2. Random Number: O(1)
+// A tiny xorshift64 generator so benchmarks are repeatable with a fixed seed.
+static inline uint64_t xorshift64(uint64_t *state) {
+    uint64_t x = *state;
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    *state = x;
+    return x;
+}
+
+#endif // TIMER_H